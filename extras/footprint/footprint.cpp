@@ -0,0 +1,170 @@
+
+/**
+ * @file    footprint.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Objects Size Report Unit (built by footprint.sh).
+ *
+ * Each class of the enabled components gets a symbol with its size, so the
+ * RAM used by each object is read from the symbols table (nm -S) without
+ * running code on the target.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+
+/*****************************************************************************/
+
+/* Ease Macros */
+
+/* Symbol of the size of an object (footprint__<component>__<class>) */
+#define THE_HAL_FOOTPRINT(component, type) \
+    extern const char footprint__##component##__##type[sizeof(type)]; \
+    const char footprint__##component##__##type[sizeof(type)] = { 0 };
+
+/* DigitalOutBus is not available on bare metal AVR */
+#if !defined(__AVR__) or defined(ARDUINO)
+    #define THE_HAL_FOOTPRINT_DIGITAL_OUT_BUS
+#endif
+
+/*****************************************************************************/
+
+/* PCINT Dispatcher */
+
+/* The dispatcher is header only (its code is generated for the handlers of
+ * the application), so it is built alone as a one pin dispatcher */
+#if defined(THE_HAL_FOOTPRINT_PCINT_DISPATCHER)
+
+#if (THE_HAL_COMPONENT_PCINT_DISPATCHER == 1) and defined(__AVR__)
+    static void footprint_on_change(const bool) {}
+    typedef PcintDispatcher<0, PcintHandler<THE_HAL_PCINT_PORT_B, 0,
+            footprint_on_change>> FootprintPcint;
+    THE_HAL_PCINT_ISR(0, FootprintPcint)
+    void footprint_pcint_setup(void) { FootprintPcint::setup(); }
+#else
+    #error "PCINT Dispatcher is only available on AVR devices"
+#endif
+
+#else
+
+/*****************************************************************************/
+
+/* Objects */
+
+#if THE_HAL_COMPONENT_DIGITAL_OUT == 1
+    THE_HAL_FOOTPRINT(digital_out, DigitalOut)
+    #if defined(THE_HAL_FOOTPRINT_DIGITAL_OUT_BUS)
+        THE_HAL_FOOTPRINT(digital_out, DigitalOutBus)
+    #endif
+    #if defined(__AVR__)
+        THE_HAL_FOOTPRINT(digital_out, DigitalOutPacked)
+    #endif
+#endif
+
+#if THE_HAL_COMPONENT_DIGITAL_IN == 1
+    THE_HAL_FOOTPRINT(digital_in, DigitalIn)
+    THE_HAL_FOOTPRINT(digital_in, DigitalInBus)
+#endif
+
+#if THE_HAL_COMPONENT_ENCODER == 1
+    THE_HAL_FOOTPRINT(encoder, Encoder)
+#endif
+
+#if THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE == 1
+    THE_HAL_FOOTPRINT(digital_out_queue, DigitalOutQueue)
+#endif
+
+#if THE_HAL_COMPONENT_ASYNC == 1
+    THE_HAL_FOOTPRINT(async, AsyncExecutor)
+    THE_HAL_FOOTPRINT(async, AsyncDigitalIn)
+#endif
+
+#if THE_HAL_COMPONENT_TIMER_WHEEL == 1
+    THE_HAL_FOOTPRINT(timer_wheel, TimerWheel)
+    THE_HAL_FOOTPRINT(timer_wheel, TimedAction)
+#endif
+
+#if THE_HAL_COMPONENT_LOGIC_CAPTURE == 1
+    THE_HAL_FOOTPRINT(logic_capture, LogicCapture)
+    THE_HAL_FOOTPRINT(logic_capture, LogicCaptureReader)
+#endif
+
+#if THE_HAL_COMPONENT_GLITCH_FILTER == 1
+    THE_HAL_FOOTPRINT(glitch_filter, GlitchFilter)
+    THE_HAL_FOOTPRINT(glitch_filter, GlitchFilterBus)
+#endif
+
+#if THE_HAL_COMPONENT_DISPLAY_MUX == 1
+    THE_HAL_FOOTPRINT(display_mux, DisplayMux)
+#endif
+
+#if THE_HAL_COMPONENT_KEYPAD == 1
+    THE_HAL_FOOTPRINT(keypad, Keypad)
+#endif
+
+#if THE_HAL_COMPONENT_STEPPER == 1
+    THE_HAL_FOOTPRINT(stepper, Stepper)
+#endif
+
+#if THE_HAL_COMPONENT_SHIFT_REGISTER == 1
+    THE_HAL_FOOTPRINT(shift_register, ShiftRegisterImage)
+    THE_HAL_FOOTPRINT(shift_register, ShiftRegisterOut)
+#endif
+
+#if THE_HAL_COMPONENT_LATENCY == 1
+    THE_HAL_FOOTPRINT(latency, LatencyHistogram)
+    THE_HAL_FOOTPRINT(latency, JitterProbe)
+#endif
+
+#if (THE_HAL_COMPONENT_DDS == 1) and \
+    defined(THE_HAL_FOOTPRINT_DIGITAL_OUT_BUS)
+    THE_HAL_FOOTPRINT(dds, Dds)
+#endif
+
+#if THE_HAL_COMPONENT_SOFT_SPI == 1
+    THE_HAL_FOOTPRINT(soft_spi, SoftSpiPins)
+    THE_HAL_FOOTPRINT(soft_spi, SoftSpi)
+#endif
+
+#if THE_HAL_COMPONENT_SOFT_I2C == 1
+    THE_HAL_FOOTPRINT(soft_i2c, SoftI2cLines)
+    THE_HAL_FOOTPRINT(soft_i2c, SoftI2c)
+#endif
+
+#if THE_HAL_COMPONENT_PULSE == 1
+    THE_HAL_FOOTPRINT(pulse, PreciseDelay)
+    THE_HAL_FOOTPRINT(pulse, PrecisePulse)
+#endif
+
+#if THE_HAL_COMPONENT_PIN_EVENT_BUS == 1
+    THE_HAL_FOOTPRINT(pin_event_bus, PinEventBus)
+#endif
+
+#endif /* THE_HAL_FOOTPRINT_PCINT_DISPATCHER */
+
+/*****************************************************************************/
@@ -0,0 +1,204 @@
+#!/usr/bin/env bash
+
+# @file    footprint.sh
+# @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+# @date    19-10-2026
+# @version 1.0.0
+#
+# @section DESCRIPTION
+#
+# RAM and Flash Footprint Report of TheHAL components for each backend.
+#
+# Each component is built alone (just with the digital out/in components it
+# depends on) and the size of its objects is reported:
+#
+#   - Flash: text + data of the component objects (before linking, so it is
+#     an upper bound, the linker drops the unused functions).
+#   - RAM: data + bss of the component objects (static memory).
+#   - Object: sizeof() of each component class (RAM of each instance).
+#
+# The PCINT dispatcher (AVR only) has no objects of its own, its code is
+# generated for the handlers, so it is reported as a one pin dispatcher.
+#
+# Usage:
+#
+#   extras/footprint/footprint.sh [host] [linux] [avr]
+#
+# Backends which toolchain is not installed are skipped. The AVR device is
+# selected with AVR_MCU (atmega328p by default).
+#
+# @section LICENSE
+#
+# Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+###############################################################################
+
+set -u
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+SRC_DIR="$(cd "${SCRIPT_DIR}/../../src" && pwd)"
+AVR_MCU="${AVR_MCU:-atmega328p}"
+BUILD_DIR="$(mktemp -d)"
+trap 'rm -rf "${BUILD_DIR}"' EXIT
+
+# Components that every other component may depend on
+BASE_COMPONENTS="THE_HAL_COMPONENT_DIGITAL_OUT THE_HAL_COMPONENT_DIGITAL_IN"
+
+###############################################################################
+
+# Select toolchain of a backend (returns 1 if it is not installed)
+set_backend()
+{
+    case "$1" in
+        host)
+            CXX="g++"; SIZE="size"; NM="nm"
+            CXXFLAGS="-std=c++20 -Os"
+            ;;
+        linux)
+            CXX="g++"; SIZE="size"; NM="nm"
+            CXXFLAGS="-std=c++20 -Os -DLINUX_GPIO"
+            ;;
+        avr)
+            CXX="avr-g++"; SIZE="avr-size"; NM="avr-nm"
+            CXXFLAGS="-std=gnu++17 -Os -mmcu=${AVR_MCU}"
+            ;;
+        *)
+            echo "Unknown backend: $1" >&2
+            return 1
+            ;;
+    esac
+    command -v "${CXX}" > /dev/null || return 1
+    CXXFLAGS="${CXXFLAGS} -ffunction-sections -fdata-sections"
+    return 0
+}
+
+# Write thehal.h of the build copy enabling just the given components
+configure()
+{
+    local flags="${BASE_COMPONENTS} $*"
+    local config="${BUILD_DIR}/src/thehal.h"
+
+    sed -E 's/^(#define THE_HAL_COMPONENT_[A-Z0-9_]+) 1$/\1 0/' \
+        "${SRC_DIR}/thehal.h" > "${config}"
+    for flag in ${flags}; do
+        sed -i -E "s/^(#define ${flag}) 0$/\1 1/" "${config}"
+    done
+}
+
+# Build all sources of a component directory and print "flash ram"
+build_component()
+{
+    local dir="$1"
+    local out="${BUILD_DIR}/obj/$(basename "${dir}")"
+    local objs=()
+    local n=0
+
+    mkdir -p "${out}"
+    while IFS= read -r source; do
+        n=$((n + 1))
+        "${CXX}" ${CXXFLAGS} -I"${BUILD_DIR}/src" -c "${source}" \
+            -o "${out}/${n}.o" 2> "${out}/${n}.log" || return 1
+        objs+=("${out}/${n}.o")
+    done < <(find "${dir}" -name '*.cpp' -not -path '*/examples/*')
+
+    [ ${#objs[@]} -eq 0 ] && return 1
+    "${SIZE}" -t "${objs[@]}" | tail -n 1 | \
+        awk '{ print ($1 + $2) " " ($2 + $3) }'
+}
+
+# Build a one pin PCINT dispatcher (header only) and print "flash ram"
+build_pcint_dispatcher()
+{
+    local out="${BUILD_DIR}/obj/pcint_dispatcher"
+
+    mkdir -p "${out}"
+    "${CXX}" ${CXXFLAGS} -I"${BUILD_DIR}/src" \
+        -DTHE_HAL_FOOTPRINT_PCINT_DISPATCHER -c "${SCRIPT_DIR}/footprint.cpp" \
+        -o "${out}/1.o" 2> "${out}/1.log" || return 1
+    "${SIZE}" -t "${out}/1.o" | tail -n 1 | \
+        awk '{ print ($1 + $2) " " ($2 + $3) }'
+}
+
+# Print objects size of the components that were built
+report_objects()
+{
+    local unit="${BUILD_DIR}/footprint.o"
+
+    configure "$@"
+    "${CXX}" ${CXXFLAGS} -I"${BUILD_DIR}/src" -c \
+        "${SCRIPT_DIR}/footprint.cpp" -o "${unit}" 2> /dev/null || return 1
+
+    printf "\n  %-40s %8s\n" "Object" "RAM"
+    "${NM}" -S --defined-only "${unit}" | \
+        while read -r address size type symbol; do
+            [[ "${symbol}" == footprint__* ]] || continue
+            symbol="${symbol#footprint__}"
+            printf "  %-40s %8d\n" "${symbol/__//}" "$((16#${size}))"
+        done
+}
+
+# Print the footprint report of a backend
+report_backend()
+{
+    local built=""
+    local sizes flag dir
+
+    echo "Backend: $1 (${CXX})"
+    printf "\n  %-40s %8s %8s\n" "Component" "Flash" "RAM"
+
+    for flag in $(grep -oE '^#define THE_HAL_COMPONENT_[A-Z0-9_]+' \
+            "${SRC_DIR}/thehal.h" | awk '{ print $2 }'); do
+        dir="${flag#THE_HAL_COMPONENT_}"
+        dir="${BUILD_DIR}/src/components/${dir,,}_controller"
+        configure "${flag}"
+        if [ "${flag}" == "THE_HAL_COMPONENT_PCINT_DISPATCHER" ]; then
+            sizes="$(build_pcint_dispatcher)" || sizes="- -"
+            printf "  %-40s %8s %8s\n" "pcint_dispatcher" ${sizes}
+        elif sizes="$(build_component "${dir}")"; then
+            built="${built} ${flag}"
+            printf "  %-40s %8s %8s\n" "$(basename "${dir}")" ${sizes}
+        else
+            printf "  %-40s %8s %8s\n" "$(basename "${dir}")" "-" "-"
+        fi
+    done
+
+    # Backends support code (simulated ports, linux GPIO character device)
+    configure
+    for dir in host_sim linux_gpio; do
+        dir="${BUILD_DIR}/src/components/${dir}_controller"
+        sizes="$(build_component "${dir}")" || continue
+        if [ "${sizes}" != "0 0" ]; then
+            printf "  %-40s %8s %8s\n" "$(basename "${dir}")" ${sizes}
+        fi
+    done
+
+    report_objects ${built} || echo "  Objects size report build failed"
+    echo ""
+}
+
+###############################################################################
+
+cp -r "${SRC_DIR}" "${BUILD_DIR}/src"
+
+for backend in ${@:-host linux avr}; do
+    if set_backend "${backend}"; then
+        report_backend "${backend}"
+    else
+        echo "Backend: ${backend} (skipped, toolchain not found)"
+        echo ""
+    fi
+done
@@ -0,0 +1,314 @@
+
+/**
+ * @file    async_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Coroutines Asynchronous Controller Host Test.
+ *
+ * Coroutines wait for pin edges, pin levels and time on the simulated
+ * ports and virtual clock. It checks that an edge resumes its waiter at
+ * the next run_once() (also a pulse between two calls, reported with
+ * on_edge() from a simulated device watching the pin), that a level wait
+ * resumes with true when the level comes and with false at its timeout,
+ * that sleep_for() resumes at its virtual time and not before, and that
+ * the executor destroys the coroutines that did not end.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN_INPUT 4
+
+#define LEVEL_TIMEOUT_MS 100
+#define SLEEP_MS 250
+
+/* Nanoseconds of a millisecond of the virtual clock */
+#define NS_PER_MS 1000000ULL
+
+/*****************************************************************************/
+
+/* Coroutines */
+
+/* Result of a coroutine wait */
+typedef struct
+{
+    bool resumed;
+    bool result;
+    uint32_t time_ms;
+    uint8_t num_edges;
+} the_hal_async_test_wait;
+
+/* Counts the destroyed coroutine frames (passed by value, it is moved into
+ * the frame, so only the frame copy counts) */
+class DestroyCounter
+{
+    public:
+        DestroyCounter(uint8_t* count) { this->count = count; }
+        DestroyCounter(DestroyCounter&& counter)
+        {
+            this->count = counter.count;
+            counter.count = nullptr;
+        }
+        DestroyCounter(const DestroyCounter&) = delete;
+        ~DestroyCounter()
+        {
+            if(this->count != nullptr)
+                *(this->count) = *(this->count) + 1;
+        }
+
+    private:
+        uint8_t* count;
+};
+
+/* Record the wait result and the time it resumed at */
+static void resumed(the_hal_async_test_wait* wait, const bool result)
+{
+    wait->resumed = true;
+    wait->result = result;
+    wait->time_ms = AsyncExecutor::get_time_ms();
+}
+
+/* Wait for rising edges */
+static AsyncTask wait_rising_edges(AsyncDigitalIn* in,
+        the_hal_async_test_wait* wait)
+{
+    while(true)
+    {
+        co_await in->rising_edge();
+        wait->num_edges = wait->num_edges + 1;
+        resumed(wait, true);
+    }
+}
+
+/* Wait for the high level with a timeout */
+static AsyncTask wait_high(AsyncDigitalIn* in, the_hal_async_test_wait* wait)
+{
+    resumed(wait, co_await in->level(true, LEVEL_TIMEOUT_MS));
+}
+
+/* Sleep on the virtual clock */
+static AsyncTask wait_sleep(the_hal_async_test_wait* wait)
+{
+    resumed(wait, co_await sleep_for(SLEEP_MS));
+}
+
+/* Wait for an edge that never comes, counting the frame destruction */
+static AsyncTask wait_forever(AsyncDigitalIn* in, DestroyCounter)
+{
+    co_await in->falling_edge();
+}
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Report the input edges as a pin change interrupt would do */
+static void on_input_edge(void* arg, const uint8_t, const uint32_t rising,
+        const uint32_t)
+{
+    AsyncDigitalIn* in = (AsyncDigitalIn*)(arg);
+
+    in->on_edge(rising != 0);
+}
+
+/* Clear a wait result */
+static void clear(the_hal_async_test_wait* wait)
+{
+    wait->resumed = false;
+    wait->result = false;
+    wait->time_ms = 0;
+    wait->num_edges = 0;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* A rising edge resumes its waiter, also a pulse between two run_once()
+ * when the edges are reported with on_edge() */
+static void test_rising_edge(AsyncDigitalIn* in)
+{
+    the_hal_async_test_wait wait;
+    HostSimDevice device;
+
+    HostSim::reset();
+    clear(&wait);
+    {
+        AsyncExecutor Executor;
+
+        THE_HAL_TEST_CHECK(Executor.spawn(wait_rising_edges(in, &wait)));
+        Executor.run_once();
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(!wait.resumed);
+
+        HostSim::write_pin(PIN_INPUT, true);
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(wait.resumed && (wait.num_edges == 1));
+        HostSim::write_pin(PIN_INPUT, false);
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(wait.num_edges == 1);
+
+        // Without reported edges a pulse between two samples is missed
+        HostSim::write_pin(PIN_INPUT, true);
+        HostSim::write_pin(PIN_INPUT, false);
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(wait.num_edges == 1);
+
+        device.setup(on_input_edge, nullptr, in);
+        THE_HAL_TEST_CHECK(HostSimDevices::attach(&device));
+        THE_HAL_TEST_CHECK(HostSimDevices::watch_pin(&device, PIN_INPUT));
+        HostSim::write_pin(PIN_INPUT, true);
+        HostSim::write_pin(PIN_INPUT, false);
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(wait.num_edges == 2);
+        HostSimDevices::detach(&device);
+    }
+}
+
+/* A level wait resumes with true when the level comes, with false at its
+ * timeout, and does not suspend if the level is already there */
+static void test_level(AsyncDigitalIn* in)
+{
+    the_hal_async_test_wait wait;
+    AsyncExecutor Executor;
+
+    HostSim::reset();
+    clear(&wait);
+    THE_HAL_TEST_CHECK(Executor.spawn(wait_high(in, &wait)));
+    Executor.run_once();
+    HostSim::advance_time_ns(50 * NS_PER_MS);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(!wait.resumed);
+    HostSim::write_pin(PIN_INPUT, true);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(wait.resumed && wait.result && (wait.time_ms == 50));
+    THE_HAL_TEST_CHECK(Executor.is_idle());
+
+    // Timeout
+    HostSim::write_pin(PIN_INPUT, false);
+    clear(&wait);
+    THE_HAL_TEST_CHECK(Executor.spawn(wait_high(in, &wait)));
+    Executor.run_once();
+    HostSim::advance_time_ns((LEVEL_TIMEOUT_MS - 1) * NS_PER_MS);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(!wait.resumed);
+    HostSim::advance_time_ns(NS_PER_MS);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(wait.resumed && !wait.result);
+    THE_HAL_TEST_CHECK(wait.time_ms == (50 + LEVEL_TIMEOUT_MS));
+
+    // Level already there
+    HostSim::write_pin(PIN_INPUT, true);
+    clear(&wait);
+    THE_HAL_TEST_CHECK(Executor.spawn(wait_high(in, &wait)));
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(wait.resumed && wait.result && Executor.is_idle());
+}
+
+/* Sleeps resume at their virtual time, reached through the executor next
+ * deadline as an idle loop would do */
+static void test_sleep(void)
+{
+    the_hal_async_test_wait wait;
+    AsyncExecutor Executor;
+    uint32_t deadline_ms;
+
+    HostSim::reset();
+    HostSim::set_time_ns(10 * NS_PER_MS);
+    clear(&wait);
+    THE_HAL_TEST_CHECK(Executor.spawn(wait_sleep(&wait)));
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(Executor.get_next_deadline(&deadline_ms));
+    THE_HAL_TEST_CHECK(deadline_ms == (10 + SLEEP_MS));
+
+    HostSim::set_time_ns((deadline_ms * NS_PER_MS) - 1);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(!wait.resumed);
+    HostSim::set_time_ns(deadline_ms * NS_PER_MS);
+    Executor.run_once();
+    THE_HAL_TEST_CHECK(wait.resumed && wait.result);
+    THE_HAL_TEST_CHECK(wait.time_ms == (10 + SLEEP_MS));
+    THE_HAL_TEST_CHECK(Executor.is_idle());
+    THE_HAL_TEST_CHECK(!Executor.get_next_deadline(&deadline_ms));
+}
+
+/* The executor destroys its waiting and not started coroutines, and a
+ * task that is never spawned destroys its own */
+static void test_destroy(AsyncDigitalIn* in)
+{
+    uint8_t destroyed = 0;
+
+    HostSim::reset();
+    {
+        AsyncExecutor Executor;
+
+        THE_HAL_TEST_CHECK(Executor.spawn(wait_forever(in,
+                DestroyCounter(&destroyed))));
+        Executor.run_once();
+        THE_HAL_TEST_CHECK(Executor.spawn(wait_forever(in,
+                DestroyCounter(&destroyed))));
+        THE_HAL_TEST_CHECK(!Executor.is_idle() && (destroyed == 0));
+    }
+    THE_HAL_TEST_CHECK(destroyed == 2);
+
+    {
+        AsyncTask task = wait_forever(in, DestroyCounter(&destroyed));
+        THE_HAL_TEST_CHECK(destroyed == 2);
+    }
+    THE_HAL_TEST_CHECK(destroyed == 3);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalIn Input(PIN_INPUT);
+    AsyncDigitalIn AsyncInput(&Input);
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Input.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+
+    test_rising_edge(&AsyncInput);
+    test_level(&AsyncInput);
+    test_sleep();
+    test_destroy(&AsyncInput);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,74 @@
+
+/**
+ * @file    interrupt.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host mock of the avr-libc <avr/interrupt.h> (cli() and sei() change the
+ * mocked SREG I bit, and cli() calls are counted).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_AVR_MOCK_INTERRUPT_H_
+#define THE_HAL_AVR_MOCK_INTERRUPT_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+
+#include "io.h"
+
+/*****************************************************************************/
+
+/* Functions */
+
+/* Number of cli() calls */
+static inline uint32_t* the_hal_avr_mock_cli_count(void)
+{
+    static uint32_t count = 0;
+    return &count;
+}
+
+/* Disable interrupts */
+static inline void cli(void)
+{
+    SREG = SREG & 0x7f;
+    *the_hal_avr_mock_cli_count() = *the_hal_avr_mock_cli_count() + 1;
+}
+
+/* Enable interrupts */
+static inline void sei(void)
+{
+    SREG = SREG | 0x80;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_MOCK_INTERRUPT_H_ */
@@ -0,0 +1,165 @@
+
+/**
+ * @file    io.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host mock of the avr-libc <avr/io.h> registers (only the ones used by
+ * the AVR port operations).
+ *
+ * The data memory of the device is mapped at a fixed host address that is
+ * aligned to 64 KiB (see the_hal_avr_mock_map()), so the low 16 bits of a
+ * register address are its AVR data memory address and the registers are
+ * compile time constants, as with the real avr-libc. Registers are plain
+ * memory, writing PINx does not toggle PORTx.
+ *
+ * The device is selected as with avr-gcc (i.e. -D__AVR_ATmega2560__).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_AVR_MOCK_IO_H_
+#define THE_HAL_AVR_MOCK_IO_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Host address of the mocked data memory (64 KiB aligned) */
+#define THE_HAL_AVR_MOCK_BASE 0x40000000UL
+
+/* Size of the mocked data memory */
+#define THE_HAL_AVR_MOCK_SIZE 0x10000UL
+
+/*****************************************************************************/
+
+/* Registers Access Macros */
+
+#define __SFR_OFFSET 0x20
+
+#define _MMIO_BYTE(mem_addr) \
+    (*(volatile uint8_t*)(THE_HAL_AVR_MOCK_BASE + (mem_addr)))
+#define _SFR_IO8(io_addr) _MMIO_BYTE((io_addr) + __SFR_OFFSET)
+#define _SFR_MEM8(mem_addr) _MMIO_BYTE(mem_addr)
+#define _SFR_MEM_ADDR(sfr) ((uint16_t)(uintptr_t)(&(sfr)))
+
+/*****************************************************************************/
+
+/* Devices Registers */
+
+#define SREG _SFR_IO8(0x3F)
+
+#if defined(__AVR_ATmega2560__)
+
+    #define PINA _SFR_IO8(0x00)
+    #define DDRA _SFR_IO8(0x01)
+    #define PORTA _SFR_IO8(0x02)
+    #define PINB _SFR_IO8(0x03)
+    #define DDRB _SFR_IO8(0x04)
+    #define PORTB _SFR_IO8(0x05)
+    #define PINC _SFR_IO8(0x06)
+    #define DDRC _SFR_IO8(0x07)
+    #define PORTC _SFR_IO8(0x08)
+    #define PIND _SFR_IO8(0x09)
+    #define DDRD _SFR_IO8(0x0A)
+    #define PORTD _SFR_IO8(0x0B)
+    #define PINE _SFR_IO8(0x0C)
+    #define DDRE _SFR_IO8(0x0D)
+    #define PORTE _SFR_IO8(0x0E)
+    #define PINF _SFR_IO8(0x0F)
+    #define DDRF _SFR_IO8(0x10)
+    #define PORTF _SFR_IO8(0x11)
+    #define PING _SFR_IO8(0x12)
+    #define DDRG _SFR_IO8(0x13)
+    #define PORTG _SFR_IO8(0x14)
+    #define PINH _SFR_MEM8(0x100)
+    #define DDRH _SFR_MEM8(0x101)
+    #define PORTH _SFR_MEM8(0x102)
+    #define PINJ _SFR_MEM8(0x103)
+    #define DDRJ _SFR_MEM8(0x104)
+    #define PORTJ _SFR_MEM8(0x105)
+    #define PINK _SFR_MEM8(0x106)
+    #define DDRK _SFR_MEM8(0x107)
+    #define PORTK _SFR_MEM8(0x108)
+    #define PINL _SFR_MEM8(0x109)
+    #define DDRL _SFR_MEM8(0x10A)
+    #define PORTL _SFR_MEM8(0x10B)
+
+#elif defined(__AVR_ATmega128__)
+
+    #define PINA _SFR_IO8(0x19)
+    #define DDRA _SFR_IO8(0x1A)
+    #define PORTA _SFR_IO8(0x1B)
+    #define PINB _SFR_IO8(0x16)
+    #define DDRB _SFR_IO8(0x17)
+    #define PORTB _SFR_IO8(0x18)
+    #define PINC _SFR_IO8(0x13)
+    #define DDRC _SFR_IO8(0x14)
+    #define PORTC _SFR_IO8(0x15)
+    #define PIND _SFR_IO8(0x10)
+    #define DDRD _SFR_IO8(0x11)
+    #define PORTD _SFR_IO8(0x12)
+    #define PINE _SFR_IO8(0x01)
+    #define DDRE _SFR_IO8(0x02)
+    #define PORTE _SFR_IO8(0x03)
+    #define DDRF _SFR_MEM8(0x61)
+    #define PORTF _SFR_MEM8(0x62)
+    #define PING _SFR_MEM8(0x63)
+    #define DDRG _SFR_MEM8(0x64)
+    #define PORTG _SFR_MEM8(0x65)
+
+#else
+
+    #error "AVR mock device not supported"
+
+#endif
+
+/*****************************************************************************/
+
+/* Functions */
+
+/* Map the mocked data memory (all registers cleared) */
+static inline bool the_hal_avr_mock_map(void)
+{
+    void* memory = mmap((void*)THE_HAL_AVR_MOCK_BASE, THE_HAL_AVR_MOCK_SIZE,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    return (memory == (void*)THE_HAL_AVR_MOCK_BASE);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_MOCK_IO_H_ */
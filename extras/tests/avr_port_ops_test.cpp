@@ -0,0 +1,276 @@
+
+/**
+ * @file    avr_port_ops_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * AVR Port Operations Host Test.
+ *
+ * The port operations header is built for an AVR device against a mock of
+ * the avr-libc registers (avr_mock/), and each operation is run on the
+ * mocked data memory. The path that a pin got is told apart by its side
+ * effects: SBI/CBI writes PORTx alone, PIN_TOGGLE writes PINx and
+ * ATOMIC_BLOCK disables interrupts (restoring SREG). It is built for a
+ * device with PINx toggle (ATmega2560) and for one without it (ATmega128).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "components/digital_out_controller/avr/avr_port_ops.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* SREG with interrupts enabled */
+#define SREG_I 0x80
+
+static const char* const OP_NAMES[3] =
+{ "SBI/CBI", "PIN_TOGGLE", "ATOMIC_BLOCK" };
+
+static const char PORT_LETTERS[11] =
+{ 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'J', 'K', 'L' };
+
+/*****************************************************************************/
+
+/* Observation */
+
+/* State before an operation */
+typedef struct
+{
+    volatile uint8_t* port;
+    uint32_t cli_count;
+} the_hal_avr_mock_observation;
+
+/* PORTx register through a volatile pointer (not a compile time constant,
+ * as the ports of DigitalOut) */
+static volatile uint8_t* get_run_time_port(volatile uint8_t* port)
+{
+    volatile uint8_t* volatile run_time_port = port;
+    return run_time_port;
+}
+
+/* Prepare the observation of an operation on a port */
+static void observe(the_hal_avr_mock_observation* observation,
+        volatile uint8_t* port)
+{
+    observation->port = port;
+    observation->cli_count = *the_hal_avr_mock_cli_count();
+    *(port - 2) = 0;
+    SREG = SREG_I;
+}
+
+/* Get the path taken by the observed operation from its side effects */
+static the_hal_avr_port_op get_path(
+        const the_hal_avr_mock_observation* observation)
+{
+    // Interrupts state is always restored
+    THE_HAL_TEST_CHECK(SREG == SREG_I);
+
+    if(*the_hal_avr_mock_cli_count() != observation->cli_count)
+        return THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK;
+    if(*(observation->port - 2) != 0)
+        return THE_HAL_AVR_PORT_OP_PIN_TOGGLE;
+    return THE_HAL_AVR_PORT_OP_SBI_CBI;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Print and check the operation of each port of the device */
+static void test_ports_table(const the_hal_avr_port_op* expected)
+{
+    volatile uint8_t* port;
+    the_hal_avr_port_op op;
+
+    for(uint8_t i = 0; i <= THE_HAL_AVR_PORT_L; i++)
+    {
+        port = avr_port_register_at(i);
+        if(port == nullptr)
+            continue;
+
+        op = avr_port_op(port);
+        THE_HAL_TEST_CHECK(op == expected[i]);
+        printf("PORT%c (0x%03x): %s\n", PORT_LETTERS[i],
+                (unsigned)(_SFR_MEM_ADDR(*port)), OP_NAMES[op]);
+    }
+}
+
+/* Compile time pins of the I/O space use sbi/cbi */
+static void test_compile_time_pin(void)
+{
+    typedef AvrPortPin<THE_HAL_AVR_PORT_B, 5> Pin;
+    the_hal_avr_mock_observation observation;
+
+    PORTB = 0x01;
+    DDRB = 0x01;
+    observe(&observation, &PORTB);
+    Pin::setup(0);
+    THE_HAL_TEST_CHECK(get_path(&observation) == THE_HAL_AVR_PORT_OP_SBI_CBI);
+    THE_HAL_TEST_CHECK((PORTB == 0x01) && (DDRB == 0x21));
+
+    observe(&observation, &PORTB);
+    Pin::set_high();
+    THE_HAL_TEST_CHECK(get_path(&observation) == THE_HAL_AVR_PORT_OP_SBI_CBI);
+    THE_HAL_TEST_CHECK(PORTB == 0x21);
+
+    observe(&observation, &PORTB);
+    Pin::set_low();
+    THE_HAL_TEST_CHECK(get_path(&observation) == THE_HAL_AVR_PORT_OP_SBI_CBI);
+    THE_HAL_TEST_CHECK(PORTB == 0x01);
+}
+
+/* Compile time pins of the extended I/O space can't use sbi/cbi */
+static void test_compile_time_extended_pin(const the_hal_avr_port_op expected)
+{
+#if defined(__AVR_ATmega2560__)
+    typedef AvrPortPin<THE_HAL_AVR_PORT_H, 3> Pin;
+    volatile uint8_t* port = &PORTH;
+#else
+    typedef AvrPortPin<THE_HAL_AVR_PORT_F, 3> Pin;
+    volatile uint8_t* port = &PORTF;
+#endif
+    the_hal_avr_mock_observation observation;
+
+    *port = 0x00;
+    observe(&observation, port);
+    Pin::set_high();
+    THE_HAL_TEST_CHECK(get_path(&observation) == expected);
+    THE_HAL_TEST_CHECK(Pin::get_op() == expected);
+}
+
+/* Run time pins of the I/O space can't use sbi/cbi */
+static void test_run_time_pin(void)
+{
+    volatile uint8_t* port = get_run_time_port(&PORTB);
+    the_hal_avr_mock_observation observation;
+
+    PORTB = 0x01;
+    observe(&observation, port);
+    avr_port_write(port, 0x20, true);
+#if defined(THE_HAL_AVR_PIN_TOGGLE)
+    THE_HAL_TEST_CHECK(get_path(&observation) ==
+            THE_HAL_AVR_PORT_OP_PIN_TOGGLE);
+    THE_HAL_TEST_CHECK((PINB == 0x20) && (PORTB == 0x01));
+
+    // A pin that already has the level is not toggled
+    observe(&observation, port);
+    avr_port_write(port, 0x01, true);
+    THE_HAL_TEST_CHECK(PINB == 0x00);
+#else
+    THE_HAL_TEST_CHECK(get_path(&observation) ==
+            THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK);
+    THE_HAL_TEST_CHECK(PORTB == 0x21);
+#endif
+
+    observe(&observation, port);
+    avr_port_toggle(port, 0x01);
+#if defined(THE_HAL_AVR_PIN_TOGGLE)
+    THE_HAL_TEST_CHECK(get_path(&observation) ==
+            THE_HAL_AVR_PORT_OP_PIN_TOGGLE);
+    THE_HAL_TEST_CHECK(PINB == 0x01);
+#else
+    THE_HAL_TEST_CHECK(get_path(&observation) ==
+            THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK);
+    THE_HAL_TEST_CHECK(PORTB == 0x20);
+#endif
+}
+
+/* Pins of the extended I/O space never use sbi/cbi */
+static void test_extended_pin(volatile uint8_t* port,
+        const the_hal_avr_port_op expected)
+{
+    the_hal_avr_mock_observation observation;
+
+    *port = 0x00;
+    observe(&observation, port);
+    avr_port_write(port, 0x08, true);
+    THE_HAL_TEST_CHECK(get_path(&observation) == expected);
+    if(expected == THE_HAL_AVR_PORT_OP_PIN_TOGGLE)
+        THE_HAL_TEST_CHECK(*(port - 2) == 0x08);
+    else
+        THE_HAL_TEST_CHECK(*port == 0x08);
+
+    // DDRx of the extended I/O space is written with interrupts disabled
+    *(port - 1) = 0x01;
+    observe(&observation, port);
+    avr_port_set_output(port, 0x08, true);
+    THE_HAL_TEST_CHECK(get_path(&observation) ==
+            THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK);
+    THE_HAL_TEST_CHECK(*(port - 1) == 0x09);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+#if defined(__AVR_ATmega2560__)
+    const the_hal_avr_port_op expected[11] =
+    {
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_SBI_CBI,
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_SBI_CBI,
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_SBI_CBI,
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_PIN_TOGGLE,
+        THE_HAL_AVR_PORT_OP_PIN_TOGGLE, THE_HAL_AVR_PORT_OP_PIN_TOGGLE,
+        THE_HAL_AVR_PORT_OP_PIN_TOGGLE
+    };
+    volatile uint8_t* extended_port = &PORTH;
+    the_hal_avr_port_op extended_op = THE_HAL_AVR_PORT_OP_PIN_TOGGLE;
+    printf("ATmega2560:\n");
+#else
+    const the_hal_avr_port_op expected[11] =
+    {
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_SBI_CBI,
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_SBI_CBI,
+        THE_HAL_AVR_PORT_OP_SBI_CBI, THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK,
+        THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK
+    };
+    volatile uint8_t* extended_port = &PORTF;
+    the_hal_avr_port_op extended_op = THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK;
+    printf("ATmega128:\n");
+#endif
+
+    if(!the_hal_avr_mock_map())
+    {
+        printf("Mock data memory could not be mapped\n");
+        return 1;
+    }
+
+    test_ports_table(expected);
+    test_compile_time_pin();
+    test_compile_time_extended_pin(extended_op);
+    test_run_time_pin();
+    test_extended_pin(get_run_time_port(extended_port), extended_op);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,141 @@
+
+/**
+ * @file    digital_out_inline_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * DigitalOut Inline vs Out-of-Line Benchmark.
+ *
+ * The same program is built against the header-only library and against
+ * the regular library. In the header-only build the DigitalOut methods and
+ * the HostSim pin and port access inline into this file, so each pin write
+ * is the simulated port atomic operation (only one of the two, the masks
+ * being constant) plus the devices notification call. In the regular build
+ * each pin operation is a call to DigitalOut and another one to HostSim,
+ * and the port write tests the masks at run time. The rows give the cost
+ * of each pin operation and of the same write done with HostSim::write_pin()
+ * from this file, inline or not as the DigitalOut ones.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN 5
+
+/* Pin operations of each measure (even, so the toggles end low) */
+#define NUM_OPERATIONS 4000000
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Cost of a toggle() (ns per operation) */
+static double measure_toggle(DigitalOut* pin)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+
+    for(uint32_t i = 0; i < NUM_OPERATIONS; i++)
+        pin->toggle();
+
+    return (double)(the_hal_test_now_ns() - start_ns) / NUM_OPERATIONS;
+}
+
+/* Cost of alternate set_high() and set_low() (ns per operation) */
+static double measure_set(DigitalOut* pin)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+
+    for(uint32_t i = 0; i < NUM_OPERATIONS; i = i + 2)
+    {
+        pin->set_high();
+        pin->set_low();
+    }
+
+    return (double)(the_hal_test_now_ns() - start_ns) / NUM_OPERATIONS;
+}
+
+/* Cost of the same writes done directly on the simulated port */
+static double measure_direct(void)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+
+    for(uint32_t i = 0; i < NUM_OPERATIONS; i = i + 2)
+    {
+        HostSim::write_pin(PIN, true);
+        HostSim::write_pin(PIN, false);
+    }
+
+    return (double)(the_hal_test_now_ns() - start_ns) / NUM_OPERATIONS;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalOut Pin(PIN);
+    double direct_ns;
+    double toggle_ns;
+    double set_ns;
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Pin.setup(0));
+
+    direct_ns = measure_direct();
+    toggle_ns = measure_toggle(&Pin);
+    THE_HAL_TEST_CHECK(!HostSim::read_pin(PIN));
+    set_ns = measure_set(&Pin);
+    THE_HAL_TEST_CHECK(!HostSim::read_pin(PIN));
+
+    // The pin operations still drive the pin
+    THE_HAL_TEST_CHECK(Pin.set_high() && HostSim::read_pin(PIN));
+    THE_HAL_TEST_CHECK(Pin.toggle() && !HostSim::read_pin(PIN));
+
+#if THE_HAL_HEADER_ONLY == 1
+    printf("Header-only build (DigitalOut and HostSim port write inline, "
+            "one port atomic per write):\n");
+#else
+    printf("Regular build (calls to DigitalOut and to HostSim port write, "
+            "masks tested at run time):\n");
+#endif
+    printf("%-24s %8s\n", "Operation", "ns/op");
+    printf("%-24s %8.2f\n", "HostSim::write_pin()", direct_ns);
+    printf("%-24s %8.2f\n", "set_high()/set_low()", set_ns);
+    printf("%-24s %8.2f\n", "toggle()", toggle_ns);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,230 @@
+
+/**
+ * @file    digital_out_queue_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Digital Output Commands Queue Host Benchmark.
+ *
+ * A GPIO owner thread runs process() while 1 to MAX_PRODUCERS producer
+ * threads push commands for their own bus pin. A push that finds the queue
+ * full is retried, so every command gets applied. For each number of
+ * producers it reports the applied commands per second and the push
+ * latency percentiles (time from the first push() attempt of a command
+ * until it is queued), which show the cost of the contention between
+ * producers. Results depend on the host cores (with a single core the
+ * tail is the scheduler time slice).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Maximum number of producer threads (each one owns a bus pin) */
+#define MAX_PRODUCERS 4
+
+/* Commands pushed by each producer */
+#define PRODUCER_COMMANDS 100000
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Producer thread state */
+typedef struct
+{
+    DigitalOutQueue* queue;
+    uint64_t* latencies_ns;
+    uint32_t retries;
+    uint8_t bus_pin;
+} the_hal_queue_producer;
+
+/* GPIO owner thread state */
+typedef struct
+{
+    DigitalOutQueue* queue;
+    uint32_t expected_commands;
+    uint32_t applied_commands;
+} the_hal_queue_consumer;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static uint64_t Latencies_ns[MAX_PRODUCERS * PRODUCER_COMMANDS];
+
+/*****************************************************************************/
+
+/* Threads */
+
+/* Push high/low commands for the producer pin (ends with the pin low) */
+static void* producer_thread(void* arg)
+{
+    the_hal_queue_producer* producer = (the_hal_queue_producer*)(arg);
+    uint64_t start_ns;
+    bool queued;
+
+    for(uint32_t i = 0; i < PRODUCER_COMMANDS; i++)
+    {
+        start_ns = the_hal_test_now_ns();
+        while(true)
+        {
+            if(i & 1)
+                queued = producer->queue->set_low(producer->bus_pin);
+            else
+                queued = producer->queue->set_high(producer->bus_pin);
+            if(queued)
+                break;
+            producer->retries = producer->retries + 1;
+            sched_yield();
+        }
+        producer->latencies_ns[i] = the_hal_test_now_ns() - start_ns;
+    }
+
+    return nullptr;
+}
+
+/* Apply the queued commands until all of them have been applied */
+static void* consumer_thread(void* arg)
+{
+    the_hal_queue_consumer* consumer = (the_hal_queue_consumer*)(arg);
+    uint16_t num_commands;
+
+    while(consumer->applied_commands < consumer->expected_commands)
+    {
+        num_commands = consumer->queue->process();
+        consumer->applied_commands = consumer->applied_commands +
+                num_commands;
+        if(num_commands == 0)
+            sched_yield();
+    }
+
+    return nullptr;
+}
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Sort order of the latencies */
+static int compare_latencies(const void* a, const void* b)
+{
+    uint64_t latency_a = *(const uint64_t*)(a);
+    uint64_t latency_b = *(const uint64_t*)(b);
+
+    return (latency_a > latency_b) - (latency_a < latency_b);
+}
+
+/* Print the commands rate and push latency percentiles of a run */
+static void report(const uint8_t num_producers, const uint32_t commands,
+        const uint64_t elapsed_ns)
+{
+    uint64_t* latencies = Latencies_ns;
+
+    qsort(latencies, commands, sizeof(uint64_t), compare_latencies);
+    printf("%10u %14llu %9llu %9llu %10llu %10llu\n",
+            (unsigned)(num_producers),
+            (unsigned long long)((commands * 1000000000ULL) / elapsed_ns),
+            (unsigned long long)(latencies[commands / 2]),
+            (unsigned long long)(latencies[(commands * 99ULL) / 100]),
+            (unsigned long long)(latencies[(commands * 999ULL) / 1000]),
+            (unsigned long long)(latencies[commands - 1]));
+}
+
+/* Run the GPIO owner and a number of producers until all the commands
+ * have been applied */
+static void run(const uint8_t num_producers)
+{
+    static const int8_t BUS_PINS[MAX_PRODUCERS] = { 0, 1, 2, 3 };
+    the_hal_queue_producer producers[MAX_PRODUCERS];
+    pthread_t threads[MAX_PRODUCERS + 1];
+    the_hal_queue_consumer consumer;
+    uint32_t commands = num_producers * PRODUCER_COMMANDS;
+    uint32_t retries = 0;
+    uint64_t start_ns;
+    uint64_t elapsed_ns;
+
+    HostSim::reset();
+    DigitalOutBus Bus(BUS_PINS, MAX_PRODUCERS);
+    DigitalOutQueue Queue(&Bus);
+    THE_HAL_TEST_CHECK(Bus.setup(0));
+
+    consumer.queue = &Queue;
+    consumer.expected_commands = commands;
+    consumer.applied_commands = 0;
+    start_ns = the_hal_test_now_ns();
+    pthread_create(&threads[0], nullptr, consumer_thread, &consumer);
+    for(uint8_t i = 0; i < num_producers; i++)
+    {
+        producers[i].queue = &Queue;
+        producers[i].latencies_ns = &Latencies_ns[i * PRODUCER_COMMANDS];
+        producers[i].retries = 0;
+        producers[i].bus_pin = i;
+        pthread_create(&threads[i + 1], nullptr, producer_thread,
+                &producers[i]);
+    }
+    for(uint8_t i = 0; i <= num_producers; i++)
+        pthread_join(threads[i], nullptr);
+    elapsed_ns = the_hal_test_now_ns() - start_ns;
+
+    for(uint8_t i = 0; i < num_producers; i++)
+        retries = retries + producers[i].retries;
+    THE_HAL_TEST_CHECK(consumer.applied_commands == commands);
+    THE_HAL_TEST_CHECK(Queue.get_dropped_commands() == retries);
+    THE_HAL_TEST_CHECK(Queue.process() == 0);
+    for(uint8_t i = 0; i < num_producers; i++)
+        THE_HAL_TEST_CHECK(HostSim::read_pin(BUS_PINS[i]) == 0);
+
+    report(num_producers, commands, elapsed_ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    printf("%10s %14s %9s %9s %10s %10s\n", "producers", "commands/s",
+            "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+    for(uint8_t num_producers = 1; num_producers <= MAX_PRODUCERS;
+            num_producers++)
+        run(num_producers);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
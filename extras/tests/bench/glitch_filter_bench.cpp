@@ -0,0 +1,248 @@
+
+/**
+ * @file    glitch_filter_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Glitch Filter Host Benchmark.
+ *
+ * 32 simulated inputs with slow level changes and single sample spikes are
+ * filtered each tick by a bit-sliced GlitchFilterBus and by 32 GlitchFilter
+ * (one per pin). It reports the cost per tick of each one, with and without
+ * the GPIOs reads (a loop that only reads the pins is measured apart), and
+ * checks both filters against a reference majority vote of the window.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define NUM_PINS 32
+
+/* Samples of the vote window */
+#define WINDOW 15
+
+/* Simulated ticks */
+#define NUM_TICKS 100000
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+/* Input levels of each tick */
+static uint32_t Samples[NUM_TICKS];
+
+/* Filtered values of each tick */
+static uint32_t Bus_Filtered[NUM_TICKS];
+static uint32_t Pins_Filtered[NUM_TICKS];
+
+/*****************************************************************************/
+
+/* Stimulus */
+
+/* Get a pseudo random number (xorshift) */
+static uint32_t random_number(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state = state ^ (state << 13);
+    state = state ^ (state >> 17);
+    state = state ^ (state << 5);
+    return state;
+}
+
+/* Build the input levels: a random pin changes every few ticks and about
+ * one pin of each tick gets a spike of a single sample */
+static void build_samples(void)
+{
+    uint32_t levels = 0;
+
+    for(uint32_t tick = 0; tick < NUM_TICKS; tick++)
+    {
+        if((random_number() & 0x07) == 0)
+            levels = levels ^ (1UL << (random_number() % NUM_PINS));
+        Samples[tick] = levels ^ (1UL << (random_number() % NUM_PINS));
+    }
+}
+
+/* Get the majority vote of the window that ends in a tick (the samples
+ * before the first tick are the setup() levels, all low) */
+static uint32_t reference_vote(const uint32_t tick)
+{
+    uint32_t filtered = 0;
+    uint8_t ones;
+
+    for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+    {
+        ones = 0;
+        for(uint32_t i = 0; (i < WINDOW) && (i <= tick); i++)
+            ones = ones + ((Samples[tick - i] >> pin) & 1);
+        if(ones > (WINDOW >> 1))
+            filtered = filtered | (1UL << pin);
+    }
+
+    return filtered;
+}
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Cost of driving the inputs and reading them (per tick) */
+static uint64_t measure_reads(DigitalInBus* bus, DigitalIn** pins,
+        const bool bus_reads)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+    volatile uint32_t sink = 0;
+
+    for(uint32_t tick = 0; tick < NUM_TICKS; tick++)
+    {
+        HostSim::write_port(0, 0xffffffff, Samples[tick]);
+        if(bus_reads)
+            sink = sink + bus->read();
+        else
+        {
+            for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+                sink = sink + pins[pin]->read();
+        }
+    }
+
+    return (the_hal_test_now_ns() - start_ns) / NUM_TICKS;
+}
+
+/* Cost of filtering the inputs with the bus filter (per tick) */
+static uint64_t measure_bus_filter(GlitchFilterBus* filter)
+{
+    uint64_t start_ns;
+
+    HostSim::write_port(0, 0xffffffff, 0);
+    THE_HAL_TEST_CHECK(filter->setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+
+    start_ns = the_hal_test_now_ns();
+    for(uint32_t tick = 0; tick < NUM_TICKS; tick++)
+    {
+        HostSim::write_port(0, 0xffffffff, Samples[tick]);
+        Bus_Filtered[tick] = filter->update();
+    }
+
+    return (the_hal_test_now_ns() - start_ns) / NUM_TICKS;
+}
+
+/* Cost of filtering the inputs with a filter for each pin (per tick) */
+static uint64_t measure_pin_filters(GlitchFilter** filters)
+{
+    uint64_t start_ns;
+    uint32_t filtered;
+
+    HostSim::write_port(0, 0xffffffff, 0);
+    for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+        THE_HAL_TEST_CHECK(filters[pin]->setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+
+    start_ns = the_hal_test_now_ns();
+    for(uint32_t tick = 0; tick < NUM_TICKS; tick++)
+    {
+        HostSim::write_port(0, 0xffffffff, Samples[tick]);
+        filtered = 0;
+        for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+            filtered = filtered | ((uint32_t)(filters[pin]->update()) << pin);
+        Pins_Filtered[tick] = filtered;
+    }
+
+    return (the_hal_test_now_ns() - start_ns) / NUM_TICKS;
+}
+
+/* Print the cost per tick of a filter */
+static void report(const char* name, const uint64_t total_ns,
+        const uint64_t reads_ns)
+{
+    uint64_t filter_ns = (total_ns > reads_ns) ? (total_ns - reads_ns) : 0;
+
+    printf("%-22s %10llu %10llu %12llu\n", name,
+            (unsigned long long)(total_ns), (unsigned long long)(reads_ns),
+            (unsigned long long)(filter_ns));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    static const int8_t BUS_PINS[NUM_PINS] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+    };
+    DigitalInBus Bus(BUS_PINS, NUM_PINS);
+    GlitchFilterBus BusFilter(&Bus, WINDOW);
+    DigitalIn* pins[NUM_PINS];
+    GlitchFilter* filters[NUM_PINS];
+    uint64_t bus_ns;
+    uint64_t pins_ns;
+    uint32_t mismatches = 0;
+
+    HostSim::reset();
+    build_samples();
+    for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+    {
+        pins[pin] = new DigitalIn(BUS_PINS[pin]);
+        filters[pin] = new GlitchFilter(pins[pin], WINDOW);
+    }
+
+    bus_ns = measure_bus_filter(&BusFilter);
+    pins_ns = measure_pin_filters(filters);
+    for(uint32_t tick = 0; tick < NUM_TICKS; tick++)
+    {
+        if((Bus_Filtered[tick] != reference_vote(tick)) ||
+                (Pins_Filtered[tick] != Bus_Filtered[tick]))
+            mismatches = mismatches + 1;
+    }
+    THE_HAL_TEST_CHECK(mismatches == 0);
+
+    printf("%u pins, window of %u samples (ns per tick)\n",
+            (unsigned)(NUM_PINS), (unsigned)(WINDOW));
+    printf("%-22s %10s %10s %12s\n", "filter", "total", "reads",
+            "filtering");
+    report("GlitchFilterBus", bus_ns, measure_reads(&Bus, pins, true));
+    report("32 x GlitchFilter", pins_ns, measure_reads(&Bus, pins, false));
+
+    for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+    {
+        delete filters[pin];
+        delete pins[pin];
+    }
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,223 @@
+
+/**
+ * @file    pin_event_bus_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Pin Events Bus Host Benchmark.
+ *
+ * All the pins of a 32 pins bus toggle each round and the 32 queued events
+ * are dispatched to 1 to 16 subscribers. It reports the dispatch cost per
+ * event (sample() is left out of the measure) of subscribers bound in a
+ * constant table and added with subscribe(), when each pin has a single
+ * subscriber (the cost of looking through the subscribers) and when all
+ * subscribers want all the pins (a callback per subscriber). The number
+ * of callbacks of each subscriber is checked.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define NUM_PINS 32
+
+/* Subscribers counts measured (1, 2, 4, 8 and 16) */
+#define MAX_SUBSCRIBERS THE_HAL_PIN_EVENT_BUS_MAX_SUBSCRIBERS
+
+/* Toggles of all the pins of each measure */
+#define NUM_ROUNDS 20000
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+/* Callbacks received by each subscriber */
+static uint32_t Callbacks[MAX_SUBSCRIBERS];
+
+/*****************************************************************************/
+
+/* Subscribers */
+
+/* Count the event */
+static void on_event(void* arg, const the_hal_pin_event*)
+{
+    uint32_t* count = (uint32_t*)(arg);
+    *count = *count + 1;
+}
+
+/* Pins of a subscriber: every pin, or the pins of its index modulo the
+ * subscribers (each pin with a single subscriber) */
+static uint32_t subscriber_pins(const uint8_t index,
+        const uint8_t num_subscribers, const bool all_pins)
+{
+    uint32_t pins = 0;
+
+    if(all_pins)
+        return 0xffffffff;
+    for(uint8_t pin = index; pin < NUM_PINS; pin = pin + num_subscribers)
+        pins = pins | (1UL << pin);
+
+    return pins;
+}
+
+/* Check the callbacks of each subscriber */
+static bool callbacks_are(const uint8_t num_subscribers,
+        const bool all_pins)
+{
+    uint32_t expected = NUM_ROUNDS * NUM_PINS;
+
+    for(uint8_t i = 0; i < num_subscribers; i++)
+    {
+        if(!all_pins)
+        {
+            expected = NUM_ROUNDS *
+                    ((NUM_PINS - i + num_subscribers - 1) / num_subscribers);
+        }
+        if(Callbacks[i] != expected)
+            return false;
+    }
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Cost of dispatching the events of all the rounds (per event) */
+static uint64_t measure_dispatch(PinEventBus* events)
+{
+    uint64_t elapsed_ns = 0;
+    uint64_t start_ns;
+    uint32_t levels = 0;
+    uint16_t dispatched;
+
+    for(uint32_t round = 0; round < NUM_ROUNDS; round++)
+    {
+        levels = ~levels;
+        HostSim::write_port(0, 0xffffffff, levels);
+        THE_HAL_TEST_CHECK(events->sample() == NUM_PINS);
+
+        start_ns = the_hal_test_now_ns();
+        dispatched = events->dispatch();
+        elapsed_ns = elapsed_ns + (the_hal_test_now_ns() - start_ns);
+        THE_HAL_TEST_CHECK(dispatched == NUM_PINS);
+    }
+    THE_HAL_TEST_CHECK(events->get_dropped_events() == 0);
+
+    return elapsed_ns / ((uint64_t)(NUM_ROUNDS) * NUM_PINS);
+}
+
+/* Cost with the subscribers bound in a constant table */
+static uint64_t measure_table(DigitalInBus* bus,
+        const uint8_t num_subscribers, const bool all_pins)
+{
+    the_hal_pin_subscriber table[MAX_SUBSCRIBERS];
+    uint64_t event_ns;
+
+    for(uint8_t i = 0; i < num_subscribers; i++)
+    {
+        Callbacks[i] = 0;
+        table[i].callback = on_event;
+        table[i].arg = &(Callbacks[i]);
+        table[i].pins = subscriber_pins(i, num_subscribers, all_pins);
+        table[i].edges = THE_HAL_PIN_EVENT_BOTH;
+    }
+
+    HostSim::write_port(0, 0xffffffff, 0);
+    PinEventBus Events(bus, table, num_subscribers);
+    THE_HAL_TEST_CHECK(Events.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    event_ns = measure_dispatch(&Events);
+    THE_HAL_TEST_CHECK(callbacks_are(num_subscribers, all_pins));
+
+    return event_ns;
+}
+
+/* Cost with the subscribers added at run time */
+static uint64_t measure_subscribed(DigitalInBus* bus,
+        const uint8_t num_subscribers, const bool all_pins)
+{
+    uint64_t event_ns;
+
+    HostSim::write_port(0, 0xffffffff, 0);
+    PinEventBus Events(bus);
+    THE_HAL_TEST_CHECK(Events.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    for(uint8_t i = 0; i < num_subscribers; i++)
+    {
+        Callbacks[i] = 0;
+        THE_HAL_TEST_CHECK(Events.subscribe(on_event, &(Callbacks[i]),
+                subscriber_pins(i, num_subscribers, all_pins),
+                THE_HAL_PIN_EVENT_BOTH));
+    }
+    event_ns = measure_dispatch(&Events);
+    THE_HAL_TEST_CHECK(callbacks_are(num_subscribers, all_pins));
+
+    return event_ns;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    static const int8_t BUS_PINS[NUM_PINS] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+    };
+    DigitalInBus Bus(BUS_PINS, NUM_PINS);
+    uint64_t table_ns;
+    uint64_t subscribed_ns;
+    uint64_t all_pins_ns;
+
+    HostSim::reset();
+
+    printf("%u pins toggled, dispatch ns per event\n", (unsigned)(NUM_PINS));
+    printf("%-12s %10s %12s %12s\n", "subscribers", "table", "subscribed",
+            "all pins");
+    for(uint8_t n = 1; n <= MAX_SUBSCRIBERS; n = n * 2)
+    {
+        table_ns = measure_table(&Bus, n, false);
+        subscribed_ns = measure_subscribed(&Bus, n, false);
+        all_pins_ns = measure_subscribed(&Bus, n, true);
+        printf("%-12u %10llu %12llu %12llu\n", (unsigned)(n),
+                (unsigned long long)(table_ns),
+                (unsigned long long)(subscribed_ns),
+                (unsigned long long)(all_pins_ns));
+    }
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,193 @@
+
+/**
+ * @file    soft_i2c_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged I2C Master Benchmark.
+ *
+ * SoftI2c drives a simulated 24LC256 EEPROM (HostSimI2cEeprom) through two
+ * open-drain DigitalOut lines of the simulated ports. Pages are written
+ * (waiting the write cycle with ACK polling on the virtual clock) and read
+ * back with sequential reads, and the host time of the transfers gives the
+ * bytes per second of the master and model together. The data read back is
+ * checked against the written one.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+#include "components/host_sim_controller/host_sim_models.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN_SCL 0
+#define PIN_SDA 1
+
+#define EEPROM_ADDRESS 0x50
+#define EEPROM_SIZE 32768
+#define PAGE_SIZE THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE
+
+/* EEPROM write cycle (virtual nanoseconds) */
+#define WRITE_TIME_NS 5000000
+
+/* Transferred bytes (pages written and read back) */
+#define NUM_BYTES 8192
+
+/* Sequential reads length */
+#define READ_LENGTH 256
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static uint8_t Memory[EEPROM_SIZE];
+static uint8_t Written[NUM_BYTES];
+static uint8_t Read[NUM_BYTES];
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Write a page (memory address and data in a single burst) */
+static bool write_page(SoftI2c* i2c, const uint16_t address)
+{
+    uint8_t burst[2 + PAGE_SIZE];
+
+    burst[0] = (uint8_t)(address >> 8);
+    burst[1] = (uint8_t)(address & 0xff);
+    for(uint16_t i = 0; i < PAGE_SIZE; i++)
+        burst[2 + i] = Written[address + i];
+
+    return i2c->write(EEPROM_ADDRESS, burst, sizeof(burst));
+}
+
+/* Cost of writing all pages (the write cycles are waited on the virtual
+ * clock, out of the measure) */
+static uint64_t measure_writes(SoftI2c* i2c, HostSimI2cEeprom* eeprom)
+{
+    uint64_t elapsed_ns = 0;
+    uint64_t start_ns;
+    bool written;
+
+    for(uint16_t address = 0; address < NUM_BYTES;
+            address = address + PAGE_SIZE)
+    {
+        start_ns = the_hal_test_now_ns();
+        written = write_page(i2c, address);
+        elapsed_ns = elapsed_ns + (the_hal_test_now_ns() - start_ns);
+        THE_HAL_TEST_CHECK(written);
+
+        // ACK polling: no answer during the write cycle
+        THE_HAL_TEST_CHECK(eeprom->is_busy() &&
+                !i2c->probe(EEPROM_ADDRESS));
+        HostSim::advance_time_ns(WRITE_TIME_NS);
+        THE_HAL_TEST_CHECK(i2c->probe(EEPROM_ADDRESS));
+    }
+
+    return elapsed_ns;
+}
+
+/* Cost of reading back all bytes with sequential reads */
+static uint64_t measure_reads(SoftI2c* i2c)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+    uint8_t address[2];
+    bool read;
+
+    for(uint16_t i = 0; i < NUM_BYTES; i = i + READ_LENGTH)
+    {
+        address[0] = (uint8_t)(i >> 8);
+        address[1] = (uint8_t)(i & 0xff);
+        read = i2c->write_read(EEPROM_ADDRESS, address, sizeof(address),
+                &(Read[i]), READ_LENGTH);
+        THE_HAL_TEST_CHECK(read);
+    }
+
+    return the_hal_test_now_ns() - start_ns;
+}
+
+/* Print the bytes per second of a transfer */
+static void report(const char* name, const uint64_t elapsed_ns)
+{
+    double seconds = (double)(elapsed_ns) / 1000000000.0;
+
+    printf("%-22s %10.2f %12.0f\n", name, seconds * 1000.0,
+            (double)(NUM_BYTES) / seconds);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalOut Scl(PIN_SCL);
+    DigitalOut Sda(PIN_SDA);
+    SoftI2c I2c(&Scl, &Sda);
+    HostSimI2cEeprom Eeprom(PIN_SCL, PIN_SDA, EEPROM_ADDRESS, Memory,
+            EEPROM_SIZE);
+    uint64_t writes_ns;
+    uint64_t reads_ns;
+    uint32_t state = 0x2545f491;
+
+    for(uint32_t i = 0; i < NUM_BYTES; i++)
+    {
+        state = state ^ (state << 13);
+        state = state ^ (state >> 17);
+        state = state ^ (state << 5);
+        Written[i] = (uint8_t)(state);
+    }
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Eeprom.setup(WRITE_TIME_NS));
+    THE_HAL_TEST_CHECK(I2c.setup(0));
+    THE_HAL_TEST_CHECK(I2c.probe(EEPROM_ADDRESS));
+    THE_HAL_TEST_CHECK(!I2c.probe(EEPROM_ADDRESS + 1));
+
+    writes_ns = measure_writes(&I2c, &Eeprom);
+    reads_ns = measure_reads(&I2c);
+    THE_HAL_TEST_CHECK(Eeprom.get_num_writes() == (NUM_BYTES / PAGE_SIZE));
+    for(uint32_t i = 0; i < NUM_BYTES; i++)
+    {
+        if(!THE_HAL_TEST_CHECK(Read[i] == Written[i]))
+            break;
+    }
+
+    printf("%-22s %10s %12s\n", "Transfer", "ms", "bytes/s");
+    report("Page writes (64 B)", writes_ns);
+    report("Sequential reads", reads_ns);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
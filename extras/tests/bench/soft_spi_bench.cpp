@@ -0,0 +1,262 @@
+/**
+ * @file    soft_spi_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged SPI Master Benchmark.
+ *
+ * SoftSpi exchanges bursts with a fake slave, a simulated device that
+ * watches SCK and MOSI on the simulated ports and drives MISO, in each of
+ * the four SPI modes. The slave follows the mode on its own (data out on
+ * one clock edge, sampling on the other one) and counts the MOSI changes
+ * done on the edge where it must be stable, so a master that gets the clock
+ * polarity or phase wrong reads and writes shifted bytes or breaks the
+ * timing. The host time of the bursts gives the bytes per second of the
+ * master and slave together.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN_SCK 0
+#define PIN_MOSI 1
+#define PIN_MISO 2
+
+/* Transferred bytes in each mode */
+#define NUM_BYTES 16384
+
+/* Burst length */
+#define BURST_LENGTH 256
+
+/* Mode bits */
+#define MODE_CPOL 0x02
+#define MODE_CPHA 0x01
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Fake SPI slave (sends its own data while receiving the master one) */
+typedef struct
+{
+    HostSimDevice device;
+    bool cpol;
+    bool cpha;
+    const uint8_t* tx_data;
+    uint8_t* rx_data;
+    uint32_t num_bits;
+    uint32_t wrong_mosi_changes;
+} the_hal_soft_spi_bench_slave;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static uint8_t MasterTx[NUM_BYTES];
+static uint8_t MasterRx[NUM_BYTES];
+static uint8_t SlaveTx[NUM_BYTES];
+static uint8_t SlaveRx[NUM_BYTES];
+
+/*****************************************************************************/
+
+/* Fake Slave */
+
+/* Check if an edge of the callback is on a pin */
+static bool pin_changed(const int8_t pin, const uint8_t port,
+        const uint32_t bits)
+{
+    return ((HostSim::get_pin_port(pin) == port) &&
+            ((bits & HostSim::get_pin_mask(pin)) != 0));
+}
+
+/* Drive MISO with the next bit to send (released after the last one) */
+static void slave_shift_out(the_hal_soft_spi_bench_slave* slave)
+{
+    uint32_t byte = slave->num_bits / 8;
+    uint8_t bit = (uint8_t)(7 - (slave->num_bits % 8));
+    bool low = false;
+
+    if(byte < NUM_BYTES)
+        low = ((slave->tx_data[byte] & (1 << bit)) == 0);
+    HostSimDevices::pull_low(&(slave->device), PIN_MISO, low);
+}
+
+/* Store the MOSI bit and move to the next one */
+static void slave_sample(the_hal_soft_spi_bench_slave* slave)
+{
+    uint32_t byte = slave->num_bits / 8;
+    uint8_t bit = (uint8_t)(7 - (slave->num_bits % 8));
+
+    if((byte < NUM_BYTES) && HostSim::read_pin(PIN_MOSI))
+        slave->rx_data[byte] = slave->rx_data[byte] | (uint8_t)(1 << bit);
+    slave->num_bits = slave->num_bits + 1;
+}
+
+/* Follow the bus: CPHA 0 samples on the leading edge and shifts out on the
+ * trailing one, CPHA 1 shifts out on the leading edge and samples on the
+ * trailing one (MOSI must only change on the shift out half of the clock,
+ * while it is idle with CPHA 0 and active with CPHA 1) */
+static void on_slave_edge(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t falling)
+{
+    the_hal_soft_spi_bench_slave* slave =
+            (the_hal_soft_spi_bench_slave*)(arg);
+    bool active = (HostSim::read_pin(PIN_SCK) != slave->cpol);
+
+    if(pin_changed(PIN_MOSI, port, rising | falling) &&
+       (active != slave->cpha))
+        slave->wrong_mosi_changes = slave->wrong_mosi_changes + 1;
+    if(!pin_changed(PIN_SCK, port, rising | falling))
+        return;
+
+    if(active != slave->cpha)
+        slave_sample(slave);
+    else
+        slave_shift_out(slave);
+}
+
+/* Attach the slave for a mode (clock must be at its idle level) */
+static bool slave_setup(the_hal_soft_spi_bench_slave* slave,
+        const uint8_t mode)
+{
+    slave->cpol = ((mode & MODE_CPOL) != 0);
+    slave->cpha = ((mode & MODE_CPHA) != 0);
+    slave->tx_data = SlaveTx;
+    slave->rx_data = SlaveRx;
+    slave->num_bits = 0;
+    slave->wrong_mosi_changes = 0;
+    for(uint32_t i = 0; i < NUM_BYTES; i++)
+        SlaveRx[i] = 0;
+
+    if(HostSim::read_pin(PIN_SCK) != slave->cpol)
+        return false;
+    slave->device.setup(on_slave_edge, nullptr, slave);
+    if(!HostSimDevices::attach(&(slave->device)))
+        return false;
+    if(!HostSimDevices::watch_pin(&(slave->device), PIN_SCK) ||
+       !HostSimDevices::watch_pin(&(slave->device), PIN_MOSI))
+        return false;
+
+    // CPHA 0 has the first bit on the line before the first clock edge
+    if(!slave->cpha)
+        slave_shift_out(slave);
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Exchange all the bytes with the slave in a mode and check them, get the
+ * host time of the bursts */
+static uint64_t measure_mode(SoftSpi* spi, const uint8_t mode)
+{
+    the_hal_soft_spi_bench_slave slave;
+    uint64_t start_ns;
+    uint64_t elapsed_ns = 0;
+    bool transferred;
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(spi->setup(mode));
+    // MISO line idles high, the slave pulls it low to send zeros
+    HostSim::write_pin(PIN_MISO, true);
+    THE_HAL_TEST_CHECK(slave_setup(&slave, mode));
+
+    for(uint32_t i = 0; i < NUM_BYTES; i = i + BURST_LENGTH)
+    {
+        start_ns = the_hal_test_now_ns();
+        transferred = spi->transfer(&(MasterTx[i]), &(MasterRx[i]),
+                BURST_LENGTH);
+        elapsed_ns = elapsed_ns + (the_hal_test_now_ns() - start_ns);
+        THE_HAL_TEST_CHECK(transferred);
+    }
+    HostSimDevices::detach(&(slave.device));
+
+    THE_HAL_TEST_CHECK(slave.num_bits == (NUM_BYTES * 8));
+    THE_HAL_TEST_CHECK(slave.wrong_mosi_changes == 0);
+    THE_HAL_TEST_CHECK(HostSim::read_pin(PIN_SCK) == slave.cpol);
+    for(uint32_t i = 0; i < NUM_BYTES; i++)
+    {
+        if(!THE_HAL_TEST_CHECK((MasterRx[i] == SlaveTx[i]) &&
+                (SlaveRx[i] == MasterTx[i])))
+            break;
+    }
+
+    return elapsed_ns;
+}
+
+/* Print the bytes per second of a mode */
+static void report(const uint8_t mode, const uint64_t elapsed_ns)
+{
+    double seconds = (double)(elapsed_ns) / 1000000000.0;
+
+    printf("Mode %u (CPOL %u CPHA %u) %10.2f %12.0f\n", mode,
+            (mode & MODE_CPOL) ? 1 : 0, (mode & MODE_CPHA) ? 1 : 0,
+            seconds * 1000.0, (double)(NUM_BYTES) / seconds);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalOut Sck(PIN_SCK);
+    DigitalOut Mosi(PIN_MOSI);
+    DigitalIn Miso(PIN_MISO);
+    SoftSpi Spi(&Sck, &Mosi, &Miso);
+    uint64_t elapsed_ns[THE_HAL_SOFT_SPI_MODE_3 + 1];
+    uint32_t state = 0x2545f491;
+
+    for(uint32_t i = 0; i < NUM_BYTES; i++)
+    {
+        state = state ^ (state << 13);
+        state = state ^ (state >> 17);
+        state = state ^ (state << 5);
+        MasterTx[i] = (uint8_t)(state);
+        SlaveTx[i] = (uint8_t)(state >> 8);
+    }
+
+    for(uint8_t mode = 0; mode <= THE_HAL_SOFT_SPI_MODE_3; mode++)
+        elapsed_ns[mode] = measure_mode(&Spi, mode);
+
+    printf("%-22s %10s %12s\n", "Transfer", "ms", "bytes/s");
+    for(uint8_t mode = 0; mode <= THE_HAL_SOFT_SPI_MODE_3; mode++)
+        report(mode, elapsed_ns[mode]);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
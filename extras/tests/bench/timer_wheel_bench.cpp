@@ -0,0 +1,349 @@
+
+/**
+ * @file    timer_wheel_bench.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Timer Wheel Scheduler Host Benchmark.
+ *
+ * NUM_TIMERS periodic callback actions with random first delays (up to
+ * the upper wheel levels) and random periods are scheduled, the wheel is
+ * advanced past the longest first delay plus a period and then all of them
+ * are cancelled. It reports the schedule and cancel cost, the average and
+ * worst tick() cost (which includes the cascades) and checks that every
+ * action ran exactly at its expire ticks and none of them was missed. It
+ * also checks that the set, clear, toggle and pulse actions change their
+ * DigitalOut level at the right ticks, and that an action that re-schedules
+ * itself with no delay from its callback runs once per tick.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Number of scheduled actions */
+#define NUM_TIMERS 10000
+
+/* Maximum first delay and period of the actions (ticks) */
+#define MAX_DELAY (1UL << 20)
+#define MAX_PERIOD 10000
+
+/* Number of ticks to run (every action runs at least once) */
+#define NUM_TICKS (MAX_DELAY + MAX_PERIOD)
+
+/* DigitalOut actions pins */
+#define PIN_SET 0
+#define PIN_CLEAR 1
+#define PIN_TOGGLE 2
+#define PIN_PULSE 3
+
+/* DigitalOut actions ticks (first ones spread over the wheel levels) */
+#define SET_TICK 5000
+#define CLEAR_TICK 300000
+#define TOGGLE_TICK 100
+#define TOGGLE_PERIOD 4099
+#define PULSE_TICK 40
+#define PULSE_WIDTH 70
+#define PULSE_PERIOD 4100
+
+/* Number of ticks of the DigitalOut actions check */
+#define PIN_CHECK_TICKS (CLEAR_TICK + 10000)
+
+/* Number of ticks of the zero delay re-schedule check */
+#define ZERO_DELAY_TICKS 100
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Expected runs of an action */
+typedef struct
+{
+    TimerWheel* wheel;
+    uint32_t next_tick;
+    uint32_t period;
+    uint32_t runs;
+    uint32_t wrong_ticks;
+} the_hal_timer_bench;
+
+/* Action that re-schedules itself with no delay */
+typedef struct
+{
+    TimerWheel* wheel;
+    TimedAction* action;
+    uint32_t runs;
+} the_hal_timer_reschedule;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static TimedAction Actions[NUM_TIMERS];
+static the_hal_timer_bench Timers[NUM_TIMERS];
+
+/*****************************************************************************/
+
+/* Callbacks */
+
+/* Check that the action runs at its expected tick */
+static void on_timer(void* arg)
+{
+    the_hal_timer_bench* timer = (the_hal_timer_bench*)(arg);
+
+    if(timer->wheel->get_time() != timer->next_tick)
+        timer->wrong_ticks = timer->wrong_ticks + 1;
+    timer->next_tick = timer->next_tick + timer->period;
+    timer->runs = timer->runs + 1;
+}
+
+/* Re-schedule the action for the current tick */
+static void on_reschedule(void* arg)
+{
+    the_hal_timer_reschedule* reschedule =
+            (the_hal_timer_reschedule*)(arg);
+
+    reschedule->runs = reschedule->runs + 1;
+    reschedule->wheel->schedule_in(reschedule->action, 0);
+}
+
+/*****************************************************************************/
+
+/* Benchmark */
+
+/* Get a pseudo random number (xorshift) */
+static uint32_t random_number(void)
+{
+    static uint32_t state = 0x12345678;
+
+    state = state ^ (state << 13);
+    state = state ^ (state >> 17);
+    state = state ^ (state << 5);
+    return state;
+}
+
+/* Set up the actions with random first delays and periods */
+static void setup_timers(TimerWheel* wheel)
+{
+    for(uint32_t i = 0; i < NUM_TIMERS; i++)
+    {
+        Timers[i].wheel = wheel;
+        Timers[i].next_tick = 1 + (random_number() % MAX_DELAY);
+        Timers[i].period = 1 + (random_number() % MAX_PERIOD);
+        Timers[i].runs = 0;
+        Timers[i].wrong_ticks = 0;
+        Actions[i].setup_callback(on_timer, &Timers[i], Timers[i].period);
+    }
+}
+
+/* Run all the ticks, get their total and worst cost */
+static uint64_t measure_ticks(TimerWheel* wheel, uint64_t* max_tick_ns)
+{
+    uint64_t start_ns;
+    uint64_t tick_ns;
+    uint64_t run_ns = 0;
+
+    *max_tick_ns = 0;
+    for(uint32_t i = 0; i < NUM_TICKS; i++)
+    {
+        start_ns = the_hal_test_now_ns();
+        wheel->tick();
+        tick_ns = the_hal_test_now_ns() - start_ns;
+        run_ns = run_ns + tick_ns;
+        if(tick_ns > *max_tick_ns)
+            *max_tick_ns = tick_ns;
+    }
+
+    return run_ns;
+}
+
+/* Cancel all the actions (all of them are periodic, so still pending) */
+static uint64_t measure_cancel(TimerWheel* wheel)
+{
+    uint64_t start_ns = the_hal_test_now_ns();
+    uint64_t cancel_ns;
+    uint32_t cancelled = 0;
+
+    for(uint32_t i = 0; i < NUM_TIMERS; i++)
+    {
+        if(wheel->cancel(&Actions[i]))
+            cancelled = cancelled + 1;
+    }
+    cancel_ns = the_hal_test_now_ns() - start_ns;
+    THE_HAL_TEST_CHECK(cancelled == NUM_TIMERS);
+
+    return cancel_ns;
+}
+
+/* Check that every action ran at its ticks and that no due run was
+ * missed (next expected tick is past the last ran tick), get the runs */
+static uint64_t check_timers(void)
+{
+    uint64_t runs = 0;
+    uint32_t wrong_ticks = 0;
+    uint32_t missed = 0;
+
+    for(uint32_t i = 0; i < NUM_TIMERS; i++)
+    {
+        runs = runs + Timers[i].runs;
+        wrong_ticks = wrong_ticks + Timers[i].wrong_ticks;
+        if((Timers[i].runs == 0) || (Timers[i].next_tick < NUM_TICKS))
+            missed = missed + 1;
+    }
+    THE_HAL_TEST_CHECK(wrong_ticks == 0);
+    THE_HAL_TEST_CHECK(missed == 0);
+
+    return runs;
+}
+
+/* Schedule, run and cancel the actions */
+static void bench_wheel(void)
+{
+    TimerWheel Wheel;
+    uint64_t start_ns;
+    uint64_t schedule_ns;
+    uint64_t run_ns;
+    uint64_t max_tick_ns;
+    uint64_t cancel_ns;
+    uint64_t runs;
+
+    setup_timers(&Wheel);
+
+    start_ns = the_hal_test_now_ns();
+    for(uint32_t i = 0; i < NUM_TIMERS; i++)
+        Wheel.schedule_at(&Actions[i], Timers[i].next_tick);
+    schedule_ns = the_hal_test_now_ns() - start_ns;
+
+    run_ns = measure_ticks(&Wheel, &max_tick_ns);
+    cancel_ns = measure_cancel(&Wheel);
+    runs = check_timers();
+
+    printf("Timers: %u, ticks: %u, runs: %llu\n", (unsigned)(NUM_TIMERS),
+            (unsigned)(NUM_TICKS), (unsigned long long)(runs));
+    printf("schedule(): %llu ns\n",
+            (unsigned long long)(schedule_ns / NUM_TIMERS));
+    printf("tick(): %llu ns average, %llu ns worst\n",
+            (unsigned long long)(run_ns / NUM_TICKS),
+            (unsigned long long)(max_tick_ns));
+    printf("cancel(): %llu ns\n",
+            (unsigned long long)(cancel_ns / NUM_TIMERS));
+}
+
+/* Count the ticks where a pin level is not the expected one */
+static void check_level(const int8_t pin, const bool expected,
+        uint32_t* wrong_levels)
+{
+    if(HostSim::read_pin(pin) != expected)
+        *wrong_levels = *wrong_levels + 1;
+}
+
+/* The DigitalOut actions drive their pins at their ticks (the level after
+ * the tick() of a tick is checked against the expected one) */
+static void check_pin_actions(void)
+{
+    DigitalOut PinSet(PIN_SET);
+    DigitalOut PinClear(PIN_CLEAR);
+    DigitalOut PinToggle(PIN_TOGGLE);
+    DigitalOut PinPulse(PIN_PULSE);
+    TimedAction Set;
+    TimedAction Clear;
+    TimedAction Toggle;
+    TimedAction Pulse;
+    TimerWheel Wheel;
+    uint32_t wrong_levels = 0;
+    uint32_t tick;
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(PinSet.setup(0) && PinClear.setup(1) &&
+            PinToggle.setup(0) && PinPulse.setup(0));
+    THE_HAL_TEST_CHECK(
+            Set.setup(&PinSet, THE_HAL_TIMED_ACTION_SET) &&
+            Clear.setup(&PinClear, THE_HAL_TIMED_ACTION_CLEAR) &&
+            Toggle.setup(&PinToggle, THE_HAL_TIMED_ACTION_TOGGLE,
+                    TOGGLE_PERIOD) &&
+            Pulse.setup_pulse(&PinPulse, PULSE_WIDTH, PULSE_PERIOD));
+    THE_HAL_TEST_CHECK(Wheel.schedule_at(&Set, SET_TICK) &&
+            Wheel.schedule_at(&Clear, CLEAR_TICK) &&
+            Wheel.schedule_at(&Toggle, TOGGLE_TICK) &&
+            Wheel.schedule_at(&Pulse, PULSE_TICK));
+
+    for(uint32_t i = 0; i < PIN_CHECK_TICKS; i++)
+    {
+        tick = Wheel.get_time();
+        Wheel.tick();
+        check_level(PIN_SET, (tick >= SET_TICK), &wrong_levels);
+        check_level(PIN_CLEAR, (tick < CLEAR_TICK), &wrong_levels);
+        check_level(PIN_TOGGLE, (tick >= TOGGLE_TICK) &&
+                ((((tick - TOGGLE_TICK) / TOGGLE_PERIOD) % 2) == 0),
+                &wrong_levels);
+        check_level(PIN_PULSE, (tick >= PULSE_TICK) &&
+                (((tick - PULSE_TICK) % PULSE_PERIOD) < PULSE_WIDTH),
+                &wrong_levels);
+    }
+    THE_HAL_TEST_CHECK(wrong_levels == 0);
+    THE_HAL_TEST_CHECK(!Set.is_pending() && !Clear.is_pending());
+    THE_HAL_TEST_CHECK(Wheel.cancel(&Toggle) && Wheel.cancel(&Pulse));
+}
+
+/* An action re-scheduled with no delay from its callback runs once per
+ * tick (and tick() ends) */
+static void check_zero_delay_reschedule(void)
+{
+    TimerWheel Wheel;
+    TimedAction Action;
+    the_hal_timer_reschedule reschedule;
+
+    reschedule.wheel = &Wheel;
+    reschedule.action = &Action;
+    reschedule.runs = 0;
+    Action.setup_callback(on_reschedule, &reschedule);
+    Wheel.schedule_in(&Action, 0);
+
+    Wheel.tick_until(ZERO_DELAY_TICKS);
+    THE_HAL_TEST_CHECK(reschedule.runs == ZERO_DELAY_TICKS);
+    THE_HAL_TEST_CHECK(Wheel.cancel(&Action));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    check_zero_delay_reschedule();
+    check_pin_actions();
+    bench_wheel();
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
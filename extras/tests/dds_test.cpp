@@ -0,0 +1,296 @@
+
+/**
+ * @file    dds_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Direct Digital Synthesis Host Test.
+ *
+ * tick() is called at the timer rate on the simulated ports virtual clock,
+ * and a simulated frequency counter records the virtual time of the edges
+ * of each channel output. The measured output frequencies are checked
+ * against the requested ones (the average over many periods only differs
+ * in the tuning word rounding), as well as the duty cycle, the channels
+ * alignment after sync() and the glitch free retuning.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define NUM_CHANNELS 4
+
+/* Timer interrupt rate and period on the virtual clock */
+#define TICK_HZ 20000
+#define TICK_NS (1000000000ULL / TICK_HZ)
+
+/* Measured time of each frequency (virtual nanoseconds) */
+#define MEASURE_NS 10000000000ULL
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Recorded output edges of a channel */
+typedef struct
+{
+    uint64_t first_rise_ns;
+    uint64_t last_rise_ns;
+    uint64_t last_edge_ns;
+    uint64_t high_ns;
+    uint64_t high_at_last_rise_ns;
+    uint64_t min_half_period_ns;
+    uint32_t num_rises;
+    uint32_t num_edges;
+} the_hal_dds_channel_counter;
+
+/* Simulated frequency counter of all channels */
+typedef struct
+{
+    HostSimDevice device;
+    the_hal_dds_channel_counter channels[NUM_CHANNELS];
+} the_hal_dds_sim;
+
+/* Record the virtual time of the edges of each channel */
+static void on_output_edge(void* arg, const uint8_t, const uint32_t rising,
+        const uint32_t falling)
+{
+    the_hal_dds_sim* sim = (the_hal_dds_sim*)(arg);
+    the_hal_dds_channel_counter* channel;
+    uint64_t now_ns = HostSim::get_time_ns();
+    uint64_t half_period_ns;
+
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        channel = &(sim->channels[i]);
+        if(((rising | falling) & (1UL << i)) == 0)
+            continue;
+
+        // Half periods are measured between edges, the first one is not
+        // a whole half period
+        half_period_ns = now_ns - channel->last_edge_ns;
+        if((channel->num_edges > 0) &&
+           (half_period_ns < channel->min_half_period_ns))
+            channel->min_half_period_ns = half_period_ns;
+        if((falling & (1UL << i)) && (channel->num_rises > 0))
+            channel->high_ns = channel->high_ns + half_period_ns;
+        channel->last_edge_ns = now_ns;
+        channel->num_edges = channel->num_edges + 1;
+
+        if(rising & (1UL << i))
+        {
+            if(channel->num_rises == 0)
+                channel->first_rise_ns = now_ns;
+            channel->last_rise_ns = now_ns;
+            channel->high_at_last_rise_ns = channel->high_ns;
+            channel->num_rises = channel->num_rises + 1;
+        }
+    }
+}
+
+/* Clear the recorded edges of all channels */
+static void clear_counters(the_hal_dds_sim* sim)
+{
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        sim->channels[i].first_rise_ns = 0;
+        sim->channels[i].last_rise_ns = 0;
+        sim->channels[i].last_edge_ns = HostSim::get_time_ns();
+        sim->channels[i].high_ns = 0;
+        sim->channels[i].high_at_last_rise_ns = 0;
+        sim->channels[i].min_half_period_ns = 0xffffffffffffffffULL;
+        sim->channels[i].num_rises = 0;
+        sim->channels[i].num_edges = 0;
+    }
+}
+
+/* Call tick() at the timer rate during a virtual time */
+static void run(Dds* dds, const uint64_t duration_ns)
+{
+    for(uint64_t elapsed_ns = 0; elapsed_ns < duration_ns;
+            elapsed_ns = elapsed_ns + TICK_NS)
+    {
+        HostSim::advance_time_ns(TICK_NS);
+        dds->tick();
+    }
+}
+
+/* Get the measured frequency of a channel in thousandths of Hz (average of
+ * all the periods between the first and last rising edges) */
+static uint64_t measured_millihz(const the_hal_dds_channel_counter* channel)
+{
+    uint64_t duration_ns = channel->last_rise_ns - channel->first_rise_ns;
+
+    if((channel->num_rises < 2) || (duration_ns == 0))
+        return 0;
+
+    return (((uint64_t)(channel->num_rises - 1) * 1000000000000ULL) +
+            (duration_ns / 2)) / duration_ns;
+}
+
+/* Check if a measured frequency is the requested one (the average over
+ * the measure only differs by a period more or less of the tick jitter
+ * and by the tuning word rounding) */
+static bool is_requested_frequency(const uint64_t measured,
+        const uint32_t requested)
+{
+    uint64_t tolerance = ((uint64_t)requested / 10000) + 1;
+
+    return ((measured + tolerance >= requested) &&
+            (measured <= requested + tolerance));
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Output frequencies measured on the virtual clock */
+static void test_frequencies(Dds* dds, the_hal_dds_sim* sim)
+{
+    const uint32_t requested[NUM_CHANNELS] =
+            { 1000000, 440000, 1234567, 7500 };
+    uint64_t measured;
+
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+        THE_HAL_TEST_CHECK(dds->set_frequency(i, requested[i]));
+    dds->sync();
+    clear_counters(sim);
+    run(dds, MEASURE_NS);
+
+    printf("%-8s %14s %14s\n", "Channel", "Requested mHz", "Measured mHz");
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        measured = measured_millihz(&(sim->channels[i]));
+        THE_HAL_TEST_CHECK(is_requested_frequency(measured, requested[i]));
+        THE_HAL_TEST_CHECK(is_requested_frequency(dds->get_frequency(i),
+                requested[i]));
+        printf("%-8u %14lu %14llu\n", (unsigned)(i),
+                (unsigned long)(requested[i]),
+                (unsigned long long)(measured));
+    }
+
+    // Outputs are square waves (half the time high, within a 1%)
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        uint64_t periods_ns = sim->channels[i].last_rise_ns -
+                sim->channels[i].first_rise_ns;
+        uint64_t high_ns = 2 * sim->channels[i].high_at_last_rise_ns;
+
+        THE_HAL_TEST_CHECK((high_ns + (periods_ns / 100) >= periods_ns) &&
+                (high_ns <= periods_ns + (periods_ns / 100)));
+    }
+}
+
+/* Channels which tuning words are multiples share their edges after
+ * sync() (312.5 Hz and 625 Hz, a rise every 64 and 32 ticks) */
+static void test_sync(Dds* dds, the_hal_dds_sim* sim)
+{
+    const uint64_t half_period_ns = 16 * TICK_NS;
+    uint64_t sync_ns;
+
+    THE_HAL_TEST_CHECK(dds->set_tuning_word(0, 0x08000000UL));
+    THE_HAL_TEST_CHECK(dds->set_tuning_word(1, 0x04000000UL));
+    run(dds, 3 * TICK_NS);
+    dds->sync();
+    sync_ns = HostSim::get_time_ns();
+    clear_counters(sim);
+    run(dds, 1000000000ULL);
+
+    THE_HAL_TEST_CHECK(sim->channels[0].first_rise_ns ==
+            sync_ns + half_period_ns);
+    THE_HAL_TEST_CHECK(sim->channels[1].first_rise_ns ==
+            sync_ns + (2 * half_period_ns));
+    THE_HAL_TEST_CHECK(((sim->channels[1].last_rise_ns - sync_ns) %
+            half_period_ns) == 0);
+}
+
+/* Retuning keeps the phase, so no half period is shorter than a half
+ * period of the highest of both frequencies (50 Hz and 200 Hz retuned
+ * every 3 ms) */
+static void test_retune(Dds* dds, the_hal_dds_sim* sim)
+{
+    const uint64_t fast_half_period_ns = 1000000000ULL / (2 * 200);
+
+    THE_HAL_TEST_CHECK(dds->set_frequency(2, 50000));
+    clear_counters(sim);
+    for(uint32_t i = 0; i < 200; i++)
+    {
+        THE_HAL_TEST_CHECK(dds->set_frequency(2, (i & 1) ? 200000 : 50000));
+        run(dds, 3000000ULL);
+    }
+
+    THE_HAL_TEST_CHECK(sim->channels[2].num_edges > 10);
+    THE_HAL_TEST_CHECK(sim->channels[2].min_half_period_ns + TICK_NS >=
+            fast_half_period_ns);
+}
+
+/* Frequencies from the Nyquist limit (tick_hz / 2) are rejected */
+static void test_limits(Dds* dds)
+{
+    THE_HAL_TEST_CHECK(!dds->set_frequency(0, (TICK_HZ / 2) * 1000UL));
+    THE_HAL_TEST_CHECK(dds->set_frequency(0, (TICK_HZ / 2) * 1000UL - 1000));
+    THE_HAL_TEST_CHECK(!dds->set_frequency(NUM_CHANNELS, 1000));
+    THE_HAL_TEST_CHECK(dds->set_frequency(0, 0));
+    THE_HAL_TEST_CHECK(dds->get_frequency(0) == 0);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    const int8_t pins[NUM_CHANNELS] = { 0, 1, 2, 3 };
+    DigitalOutBus Outputs(pins, NUM_CHANNELS);
+    Dds Generator(&Outputs, NUM_CHANNELS, TICK_HZ);
+    static the_hal_dds_sim sim;
+
+    HostSim::reset();
+    sim.device.setup(on_output_edge, nullptr, &sim);
+    HostSimDevices::attach(&sim.device);
+    for(uint8_t i = 0; i < NUM_CHANNELS; i++)
+        HostSimDevices::watch_pin(&sim.device, pins[i]);
+
+    THE_HAL_TEST_CHECK(Generator.setup());
+    test_frequencies(&Generator, &sim);
+    test_sync(&Generator, &sim);
+    test_retune(&Generator, &sim);
+    test_limits(&Generator);
+
+    HostSimDevices::detach(&sim.device);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,247 @@
+
+/**
+ * @file    encoder_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Quadrature Encoder Host Test.
+ *
+ * A simulated encoder drives both channels on the virtual clock and a pin
+ * change interrupt model calls Encoder::isr() a latency after the first
+ * edge that sets its flag (edges that come while the flag is set are
+ * merged, as in a real pin change interrupt). The signal rate is raised
+ * until counts are lost, giving the maximum count rate that the decoder
+ * follows for the isr() cost measured on this host.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN_A 0
+#define PIN_B 1
+
+/* Steps of each simulated run */
+#define NUM_STEPS 4000
+
+/* Calls to measure the isr() cost */
+#define COST_CALLS 1000000
+
+/* Channels levels (B << 1 | A) of each step of a forward rotation */
+static const uint8_t GRAY_CODE[4] = { 0x00, 0x01, 0x03, 0x02 };
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Simulated encoder signal and pin change interrupt */
+typedef struct
+{
+    Encoder* encoder;
+    HostSimDevice signal;
+    HostSimDevice interrupt;
+    uint64_t period_ns;
+    uint64_t latency_ns;
+    uint32_t remaining_steps;
+    uint8_t phase;
+    bool forward;
+} the_hal_encoder_sim;
+
+/* Move the simulated shaft one step and schedule the next one */
+static void on_signal(void* arg, const uint64_t)
+{
+    the_hal_encoder_sim* sim = (the_hal_encoder_sim*)(arg);
+    uint8_t levels;
+
+    sim->phase = (sim->phase + ((sim->forward) ? 1 : 3)) & 0x03;
+    levels = GRAY_CODE[sim->phase];
+    HostSim::write_port(0, 0x03, levels);
+
+    sim->remaining_steps = sim->remaining_steps - 1;
+    if(sim->remaining_steps > 0)
+        HostSimDevices::schedule_in(&sim->signal, sim->period_ns);
+}
+
+/* Channel edge sets the interrupt flag (merged while it is pending) */
+static void on_edge(void* arg, const uint8_t, const uint32_t, const uint32_t)
+{
+    the_hal_encoder_sim* sim = (the_hal_encoder_sim*)(arg);
+
+    if(!sim->interrupt.is_scheduled())
+        HostSimDevices::schedule_in(&sim->interrupt, sim->latency_ns);
+}
+
+/* Interrupt handler runs */
+static void on_interrupt(void* arg, const uint64_t)
+{
+    the_hal_encoder_sim* sim = (the_hal_encoder_sim*)(arg);
+
+    sim->encoder->isr();
+}
+
+/* Run a number of steps at a period and get the lost counts */
+static uint32_t run(Encoder* encoder, const uint64_t period_ns,
+        const uint64_t latency_ns, const uint32_t steps, const bool forward)
+{
+    the_hal_encoder_sim sim;
+    int32_t expected;
+    int32_t position;
+
+    HostSim::reset();
+    encoder->setup(THE_HAL_DIGITAL_IN_PULL_NONE);
+
+    sim.encoder = encoder;
+    sim.period_ns = period_ns;
+    sim.latency_ns = latency_ns;
+    sim.remaining_steps = steps;
+    sim.phase = 0;
+    sim.forward = forward;
+    sim.signal.setup(nullptr, on_signal, &sim);
+    sim.interrupt.setup(on_edge, on_interrupt, &sim);
+    HostSimDevices::attach(&sim.signal);
+    HostSimDevices::attach(&sim.interrupt);
+    HostSimDevices::watch_pin(&sim.interrupt, PIN_A);
+    HostSimDevices::watch_pin(&sim.interrupt, PIN_B);
+
+    HostSimDevices::schedule_in(&sim.signal, period_ns);
+    while(HostSimDevices::advance_to_next());
+
+    HostSimDevices::detach(&sim.signal);
+    HostSimDevices::detach(&sim.interrupt);
+
+    expected = (forward) ? (int32_t)(steps) : -(int32_t)(steps);
+    position = encoder->get_position();
+    if(position == expected)
+        return 0;
+    return (uint32_t)((position > expected) ? (position - expected) :
+            (expected - position));
+}
+
+/* Measure the average cost of isr() on this host (the cost of moving the
+ * simulated channels is measured apart and subtracted) */
+static uint64_t measure_isr_ns(Encoder* encoder)
+{
+    uint64_t start_ns;
+    uint64_t signal_ns;
+    uint64_t total_ns;
+
+    HostSim::reset();
+    encoder->setup(THE_HAL_DIGITAL_IN_PULL_NONE);
+
+    start_ns = the_hal_test_now_ns();
+    for(uint32_t i = 0; i < COST_CALLS; i++)
+        HostSim::write_port(0, 0x03, GRAY_CODE[i & 0x03]);
+    signal_ns = the_hal_test_now_ns() - start_ns;
+
+    start_ns = the_hal_test_now_ns();
+    for(uint32_t i = 0; i < COST_CALLS; i++)
+    {
+        HostSim::write_port(0, 0x03, GRAY_CODE[i & 0x03]);
+        encoder->isr();
+    }
+    total_ns = the_hal_test_now_ns() - start_ns;
+
+    if(total_ns <= (signal_ns + COST_CALLS))
+        return 1;
+    return (total_ns - signal_ns) / COST_CALLS;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Slow rotations in both directions are decoded without errors */
+static void test_decoding(Encoder* encoder)
+{
+    THE_HAL_TEST_CHECK(run(encoder, 10000, 100, NUM_STEPS, true) == 0);
+    THE_HAL_TEST_CHECK(encoder->get_illegal_transitions() == 0);
+    THE_HAL_TEST_CHECK(run(encoder, 10000, 100, NUM_STEPS, false) == 0);
+    THE_HAL_TEST_CHECK(encoder->get_illegal_transitions() == 0);
+}
+
+/* Two steps between interrupts are reported as illegal transitions */
+static void test_illegal_transitions(Encoder* encoder)
+{
+    uint32_t lost = run(encoder, 1000, 1500, NUM_STEPS, true);
+
+    THE_HAL_TEST_CHECK(lost > 0);
+    THE_HAL_TEST_CHECK(encoder->get_illegal_transitions() > 0);
+}
+
+/* Raise the count rate until counts are lost */
+static void test_max_count_rate(Encoder* encoder)
+{
+    uint64_t latency_ns = measure_isr_ns(encoder);
+    uint64_t period_ns = 8 * latency_ns;
+    uint64_t min_period_ns = 0;
+
+    // The period where counts start to be lost is found with 1 ns steps
+    // from a safe period down
+    while(period_ns > 0)
+    {
+        if(run(encoder, period_ns, latency_ns, NUM_STEPS, true) != 0)
+            break;
+        min_period_ns = period_ns;
+        period_ns = period_ns - 1;
+    }
+
+    THE_HAL_TEST_CHECK(min_period_ns > 0);
+    THE_HAL_TEST_CHECK(min_period_ns <= (2 * latency_ns));
+    THE_HAL_TEST_CHECK(run(encoder, min_period_ns, latency_ns, NUM_STEPS,
+            false) == 0);
+    if(min_period_ns == 0)
+        return;
+
+    printf("isr() cost: %llu ns\n", (unsigned long long)(latency_ns));
+    printf("Maximum count rate: %llu counts/s (%llu ns between edges)\n",
+            (unsigned long long)(1000000000ULL / min_period_ns),
+            (unsigned long long)(min_period_ns));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    Encoder MyEncoder(PIN_A, PIN_B);
+
+    test_decoding(&MyEncoder);
+    test_illegal_transitions(&MyEncoder);
+    test_max_count_rate(&MyEncoder);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
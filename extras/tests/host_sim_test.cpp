@@ -0,0 +1,703 @@
+
+/**
+ * @file    host_sim_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Devices Host Test.
+ *
+ * Co-simulates several devices on the virtual clock. Devices that record
+ * their events are scheduled, rescheduled, cancelled, detached and
+ * rescheduled from their own events, and the events must run in time
+ * order (in schedule order for the same time) with the clock at their
+ * time. Then a SoftI2c master writes an EEPROM model with a burst longer
+ * than a page, which must wrap to the start of the page from the memory
+ * address offset. The shift register chain, WS2812 strip and bouncing
+ * button models are checked against the edges and times driven on their
+ * pins.
+ *
+ * A stimulus file is also replayed through DigitalIn and the stimulus edge
+ * callback, checking the virtual clock at each record and the replay speed.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+#include "components/host_sim_controller/host_sim_models.h"
+
+#include "thehal_test.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define NUM_DEVICES 4
+
+/* Maximum recorded events, and edges of a watched pin */
+#define MAX_EVENTS 32
+#define MAX_EDGES 16
+
+#define PIN_SCL 0
+#define PIN_SDA 1
+
+#define EEPROM_ADDRESS 0x50
+#define EEPROM_SIZE 1024
+#define PAGE_SIZE THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE
+
+/* EEPROM write cycle (virtual nanoseconds) */
+#define WRITE_TIME_NS 5000000
+
+/* Page written and memory address offset in the page of the burst */
+#define PAGE_ADDRESS 0x0100
+#define PAGE_OFFSET 10
+
+/* Data bytes of the burst (wraps the page) */
+#define BURST_LENGTH (PAGE_SIZE + 16)
+
+/* Pin driven by the stimulus records (a pulse from 5000 to 7000 ns and
+ * another from 20000 to 20500 ns) */
+#define PIN_STIMULUS 40
+#define NUM_RECORDS 4
+
+/* Time of the watcher device event (during the first pulse) */
+#define WATCHER_EVENT_NS 6000
+
+/* Shift register chain pins (2 chips) */
+#define PIN_SR_DATA 8
+#define PIN_SR_CLOCK 9
+#define PIN_SR_LATCH 10
+#define SR_CHIPS 2
+
+/* WS2812 strip data pin, bit period and high times of 0 and 1 bits */
+#define PIN_WS2812 12
+#define WS2812_LEDS 2
+#define WS2812_BIT_NS 1250
+#define WS2812_T0H_NS 350
+#define WS2812_T1H_NS 700
+
+/* Button (pressed low) pin, bounces and time between bounce edges */
+#define PIN_BUTTON 13
+#define BUTTON_BOUNCES 3
+#define BUTTON_BOUNCE_NS 1000
+
+/* Replayed stimulus file: the pin toggles each second for a day */
+#define REPLAY_RECORDS 86400
+#define REPLAY_PERIOD_NS 1000000000ULL
+
+/* Records applied by the first single clock move (0 to 10 s) */
+#define FIRST_MOVE_RECORDS 11
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Recorded event (device and its time) */
+typedef struct
+{
+    uint8_t id;
+    uint64_t time_ns;
+    uint64_t clock_ns;
+} the_hal_host_sim_test_event;
+
+/* Device that records its events (and reschedules itself with a period) */
+typedef struct
+{
+    HostSimDevice device;
+    uint8_t id;
+    uint64_t period_ns;
+    uint8_t remaining;
+} the_hal_host_sim_test_device;
+
+/* Stimulus in memory (header and records) */
+typedef struct
+{
+    uint8_t header[THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE];
+    the_hal_host_sim_stimulus_record records[NUM_RECORDS];
+} the_hal_host_sim_test_stimulus;
+
+/* Device that records the edges of a pin and the pin level at its own
+ * event */
+typedef struct
+{
+    HostSimDevice device;
+    int8_t pin;
+    uint64_t edges_ns[MAX_EDGES];
+    bool levels[MAX_EDGES];
+    uint8_t num_edges;
+    bool level_at_event;
+} the_hal_host_sim_test_watcher;
+
+/* Stimulus edges seen through the edge callback */
+typedef struct
+{
+    uint32_t num_edges;
+    uint32_t wrong_times;
+    uint32_t wrong_edges;
+} the_hal_host_sim_test_replay;
+
+/* Recorded events of all the devices */
+static the_hal_host_sim_test_event Events[MAX_EVENTS];
+static uint8_t NumEvents = 0;
+
+/* Record the event and schedule the next period */
+static void on_event(void* arg, const uint64_t time_ns)
+{
+    the_hal_host_sim_test_device* dev =
+            (the_hal_host_sim_test_device*)(arg);
+
+    if(NumEvents < MAX_EVENTS)
+    {
+        Events[NumEvents].id = dev->id;
+        Events[NumEvents].time_ns = time_ns;
+        Events[NumEvents].clock_ns = HostSim::get_time_ns();
+        NumEvents = NumEvents + 1;
+    }
+
+    if(dev->remaining > 0)
+    {
+        dev->remaining = dev->remaining - 1;
+        HostSimDevices::schedule_at(&dev->device, time_ns + dev->period_ns);
+    }
+}
+
+/* Record the pin edge with the virtual clock time it is seen at */
+static void on_watched_edge(void* arg, const uint8_t port,
+        const uint32_t, const uint32_t)
+{
+    the_hal_host_sim_test_watcher* watcher =
+            (the_hal_host_sim_test_watcher*)(arg);
+
+    if(watcher->num_edges >= MAX_EDGES)
+        return;
+    watcher->edges_ns[watcher->num_edges] = HostSim::get_time_ns();
+    watcher->levels[watcher->num_edges] = ((HostSim::read_port(port) &
+            HostSim::get_pin_mask(watcher->pin)) != 0);
+    watcher->num_edges = watcher->num_edges + 1;
+}
+
+/* Record the pin level at the device event */
+static void on_watcher_event(void* arg, const uint64_t)
+{
+    the_hal_host_sim_test_watcher* watcher =
+            (the_hal_host_sim_test_watcher*)(arg);
+
+    watcher->level_at_event = HostSim::read_pin(watcher->pin);
+}
+
+/* Attach a watcher of the edges of a pin */
+static bool watch(the_hal_host_sim_test_watcher* watcher, const int8_t pin)
+{
+    watcher->pin = pin;
+    watcher->num_edges = 0;
+    watcher->level_at_event = false;
+    watcher->device.setup(on_watched_edge, on_watcher_event, watcher);
+    if(!HostSimDevices::attach(&(watcher->device)))
+        return false;
+    return HostSimDevices::watch_pin(&(watcher->device), pin);
+}
+
+/* Build the stimulus pulses of a pin */
+static void build_stimulus(the_hal_host_sim_test_stimulus* stimulus,
+        const uint64_t* times_ns)
+{
+    const uint8_t magic[4] = { 'T', 'H', 'S', 'T' };
+    the_hal_host_sim_stimulus_record* record;
+
+    for(uint8_t i = 0; i < THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE; i++)
+        stimulus->header[i] = (i < sizeof(magic)) ? magic[i] : 0;
+    stimulus->header[sizeof(magic)] = 1;
+
+    for(uint8_t i = 0; i < NUM_RECORDS; i++)
+    {
+        record = &(stimulus->records[i]);
+        record->time_ns = times_ns[i];
+        record->mask = HostSim::get_pin_mask(PIN_STIMULUS);
+        record->values = ((i % 2) == 0) ? record->mask : 0;
+        record->port = HostSim::get_pin_port(PIN_STIMULUS);
+        for(uint8_t j = 0; j < sizeof(record->reserved); j++)
+            record->reserved[j] = 0;
+    }
+}
+
+/* Check the replayed edge against its record (record N at N seconds, high
+ * on even records) */
+static void on_replay_edge(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t falling)
+{
+    the_hal_host_sim_test_replay* replay =
+            (the_hal_host_sim_test_replay*)(arg);
+    uint32_t mask = HostSim::get_pin_mask(PIN_STIMULUS);
+    bool high = ((replay->num_edges % 2) == 0);
+
+    if(HostSim::get_time_ns() != (replay->num_edges * REPLAY_PERIOD_NS))
+        replay->wrong_times = replay->wrong_times + 1;
+    if((port != HostSim::get_pin_port(PIN_STIMULUS)) ||
+       (rising != (high ? mask : 0)) || (falling != (high ? 0 : mask)))
+        replay->wrong_edges = replay->wrong_edges + 1;
+    replay->num_edges = replay->num_edges + 1;
+}
+
+/* Write the replayed stimulus file, returns false on error */
+static bool write_replay_file(const int fd)
+{
+    const uint8_t header[THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE] =
+    { 'T', 'H', 'S', 'T', 1, 0, 0, 0 };
+    the_hal_host_sim_stimulus_record record;
+    FILE* file = fdopen(fd, "wb");
+    bool written;
+
+    if(file == nullptr)
+        return false;
+
+    written = (fwrite(header, sizeof(header), 1, file) == 1);
+    for(uint8_t i = 0; i < sizeof(record.reserved); i++)
+        record.reserved[i] = 0;
+    record.mask = HostSim::get_pin_mask(PIN_STIMULUS);
+    record.port = HostSim::get_pin_port(PIN_STIMULUS);
+    for(uint32_t i = 0; (i < REPLAY_RECORDS) && written; i++)
+    {
+        record.time_ns = i * REPLAY_PERIOD_NS;
+        record.values = ((i % 2) == 0) ? record.mask : 0;
+        written = (fwrite(&record, sizeof(record), 1, file) == 1);
+    }
+
+    return ((fclose(file) == 0) && written);
+}
+
+/* Shift a bit into the shift register chain */
+static void shift_bit(const bool bit)
+{
+    HostSim::write_pin(PIN_SR_DATA, bit);
+    HostSim::write_pin(PIN_SR_CLOCK, true);
+    HostSim::write_pin(PIN_SR_CLOCK, false);
+}
+
+/* Send a WS2812 color (MSB first) with the high times of 0 and 1 bits */
+static void send_color(const uint32_t color, const uint32_t t0h_ns,
+        const uint32_t t1h_ns)
+{
+    uint32_t high_ns;
+
+    for(int8_t bit = 23; bit >= 0; bit--)
+    {
+        high_ns = (((color >> bit) & 1) != 0) ? t1h_ns : t0h_ns;
+        HostSim::write_pin(PIN_WS2812, true);
+        HostSim::advance_time_ns(high_ns);
+        HostSim::write_pin(PIN_WS2812, false);
+        HostSim::advance_time_ns(WS2812_BIT_NS - high_ns);
+    }
+}
+
+/* Check a recorded event */
+static bool event_is(const uint8_t index, const uint8_t id,
+        const uint64_t time_ns)
+{
+    if(index >= NumEvents)
+        return false;
+    return ((Events[index].id == id) &&
+            (Events[index].time_ns == time_ns) &&
+            (Events[index].clock_ns == time_ns));
+}
+
+/* Run all the pending events */
+static void run_all(void)
+{
+    while(HostSimDevices::advance_to_next());
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Events run in time order after reschedules and cancels */
+static void test_events_order(the_hal_host_sim_test_device* devs)
+{
+    uint64_t start_ns = HostSim::get_time_ns();
+    uint64_t next_ns;
+
+    NumEvents = 0;
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[0].device,
+            start_ns + 300));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[1].device,
+            start_ns + 100));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[2].device,
+            start_ns + 200));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[3].device,
+            start_ns + 400));
+    THE_HAL_TEST_CHECK(HostSimDevices::get_next_time_ns(&next_ns) &&
+            (next_ns == start_ns + 100));
+
+    // Earliest moved later, latest moved first, one cancelled
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[1].device,
+            start_ns + 250));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[3].device,
+            start_ns + 50));
+    THE_HAL_TEST_CHECK(HostSimDevices::cancel(&devs[2].device));
+    THE_HAL_TEST_CHECK(!HostSimDevices::cancel(&devs[2].device));
+    THE_HAL_TEST_CHECK(HostSimDevices::get_next_time_ns(&next_ns) &&
+            (next_ns == start_ns + 50));
+
+    // Same time events run in schedule order
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&devs[2].device,
+            start_ns + 250));
+    run_all();
+
+    THE_HAL_TEST_CHECK(NumEvents == 4);
+    THE_HAL_TEST_CHECK(event_is(0, 3, start_ns + 50));
+    THE_HAL_TEST_CHECK(event_is(1, 1, start_ns + 250));
+    THE_HAL_TEST_CHECK(event_is(2, 2, start_ns + 250));
+    THE_HAL_TEST_CHECK(event_is(3, 0, start_ns + 300));
+    THE_HAL_TEST_CHECK(!HostSimDevices::get_next_time_ns(&next_ns));
+}
+
+/* Periodic devices interleave, a detached device drops its event */
+static void test_periodic_events(the_hal_host_sim_test_device* devs)
+{
+    uint64_t start_ns = HostSim::get_time_ns();
+
+    NumEvents = 0;
+    devs[0].period_ns = 300;
+    devs[0].remaining = 2;
+    devs[1].period_ns = 200;
+    devs[1].remaining = 3;
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_in(&devs[0].device, 100));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_in(&devs[1].device, 150));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_in(&devs[2].device, 500));
+    THE_HAL_TEST_CHECK(HostSimDevices::detach(&devs[2].device));
+
+    // Moving the clock runs the due events at their own time
+    HostSim::advance_time_ns(1000);
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() == start_ns + 1000);
+    run_all();
+
+    // A: 100, 400, 700; B: 150, 350, 550, 750
+    THE_HAL_TEST_CHECK(NumEvents == 7);
+    THE_HAL_TEST_CHECK(event_is(0, 0, start_ns + 100));
+    THE_HAL_TEST_CHECK(event_is(1, 1, start_ns + 150));
+    THE_HAL_TEST_CHECK(event_is(2, 1, start_ns + 350));
+    THE_HAL_TEST_CHECK(event_is(3, 0, start_ns + 400));
+    THE_HAL_TEST_CHECK(event_is(4, 1, start_ns + 550));
+    THE_HAL_TEST_CHECK(event_is(5, 0, start_ns + 700));
+    THE_HAL_TEST_CHECK(event_is(6, 1, start_ns + 750));
+
+    devs[0].remaining = 0;
+    devs[1].remaining = 0;
+    THE_HAL_TEST_CHECK(HostSimDevices::attach(&devs[2].device));
+}
+
+/* The chain shifts on clock rising edges and latches on latch rising
+ * edges (before the shift of a simultaneous clock edge) */
+static void test_shift_register(void)
+{
+    const uint16_t value = 0xa55a;
+    const uint32_t both = HostSim::get_pin_mask(PIN_SR_CLOCK) |
+            HostSim::get_pin_mask(PIN_SR_LATCH);
+    const uint8_t port = HostSim::get_pin_port(PIN_SR_CLOCK);
+    HostSimShiftRegister Chain(PIN_SR_DATA, PIN_SR_CLOCK, PIN_SR_LATCH,
+            SR_CHIPS);
+    HostSimShiftRegister Invalid(PIN_SR_DATA, PIN_SR_CLOCK, PIN_SR_LATCH,
+            5);
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(!Invalid.setup());
+    THE_HAL_TEST_CHECK(Chain.setup());
+
+    for(int8_t bit = 15; bit >= 0; bit--)
+        shift_bit(((value >> bit) & 1) != 0);
+    THE_HAL_TEST_CHECK((Chain.get_outputs() == 0) &&
+            (Chain.get_num_latches() == 0));
+    HostSim::write_pin(PIN_SR_LATCH, true);
+    HostSim::write_pin(PIN_SR_LATCH, false);
+    THE_HAL_TEST_CHECK((Chain.get_outputs() == value) &&
+            (Chain.get_num_latches() == 1));
+
+    // The bit shifted out of the last chip is lost
+    HostSim::write_pin(PIN_SR_DATA, true);
+    HostSim::write_port(port, both, both);
+    THE_HAL_TEST_CHECK(Chain.get_outputs() == value);
+    HostSim::write_port(port, both, 0);
+    HostSim::write_pin(PIN_SR_LATCH, true);
+    THE_HAL_TEST_CHECK(Chain.get_outputs() ==
+            (uint16_t)((value << 1) | 1));
+    THE_HAL_TEST_CHECK(Chain.get_num_latches() == 3);
+}
+
+/* Bits are decoded from the pulses high time and a low time of the reset
+ * time latches the frame */
+static void test_ws2812(void)
+{
+    uint32_t colors[WS2812_LEDS] = { 0, 0 };
+    HostSimWs2812 Strip(PIN_WS2812, colors, WS2812_LEDS);
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Strip.setup());
+
+    // A low time shorter than the reset time keeps the frame going, the
+    // 1 bit threshold is the T1H minimum
+    send_color(0x123456, WS2812_T0H_NS, WS2812_T1H_NS);
+    HostSim::advance_time_ns(THE_HAL_HOST_SIM_WS2812_RESET_NS - 10000);
+    send_color(0xabcdef, THE_HAL_HOST_SIM_WS2812_T1H_MIN_NS - 1,
+            THE_HAL_HOST_SIM_WS2812_T1H_MIN_NS);
+    THE_HAL_TEST_CHECK(Strip.get_num_frames() == 0);
+    HostSim::advance_time_ns(THE_HAL_HOST_SIM_WS2812_RESET_NS);
+    THE_HAL_TEST_CHECK(Strip.get_num_frames() == 1);
+    THE_HAL_TEST_CHECK((colors[0] == 0x123456) && (colors[1] == 0xabcdef));
+
+    // Colors after the last LED go out of the strip
+    send_color(0x00ff00, WS2812_T0H_NS, WS2812_T1H_NS);
+    send_color(0x0000ff, WS2812_T0H_NS, WS2812_T1H_NS);
+    send_color(0xff0000, WS2812_T0H_NS, WS2812_T1H_NS);
+    HostSim::advance_time_ns(THE_HAL_HOST_SIM_WS2812_RESET_NS);
+    THE_HAL_TEST_CHECK(Strip.get_num_frames() == 2);
+    THE_HAL_TEST_CHECK((colors[0] == 0x00ff00) && (colors[1] == 0x0000ff));
+}
+
+/* The contact bounces the requested times, an edge each bounce time, and
+ * settles at the new level */
+static void test_button(void)
+{
+    HostSimButton Button(PIN_BUTTON, false);
+    the_hal_host_sim_test_watcher watcher;
+    uint64_t start_ns;
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Button.setup());
+    THE_HAL_TEST_CHECK(HostSim::read_pin(PIN_BUTTON));
+    THE_HAL_TEST_CHECK(watch(&watcher, PIN_BUTTON));
+
+    start_ns = HostSim::get_time_ns();
+    THE_HAL_TEST_CHECK(Button.press(BUTTON_BOUNCES, BUTTON_BOUNCE_NS));
+    THE_HAL_TEST_CHECK(Button.is_pressed() && Button.is_bouncing());
+    THE_HAL_TEST_CHECK(!HostSim::read_pin(PIN_BUTTON));
+    HostSim::advance_time_ns(2 * BUTTON_BOUNCES * BUTTON_BOUNCE_NS);
+    THE_HAL_TEST_CHECK(!Button.is_bouncing());
+    THE_HAL_TEST_CHECK(!HostSim::read_pin(PIN_BUTTON));
+
+    THE_HAL_TEST_CHECK(watcher.num_edges == (1 + (2 * BUTTON_BOUNCES)));
+    for(uint8_t i = 0; i < watcher.num_edges; i++)
+    {
+        THE_HAL_TEST_CHECK(watcher.edges_ns[i] ==
+                (start_ns + (i * BUTTON_BOUNCE_NS)));
+        THE_HAL_TEST_CHECK(watcher.levels[i] == ((i % 2) == 1));
+    }
+
+    // Without bounces the release is a single edge
+    watcher.num_edges = 0;
+    THE_HAL_TEST_CHECK(Button.release(0, BUTTON_BOUNCE_NS));
+    HostSim::advance_time_ns(BUTTON_BOUNCE_NS);
+    THE_HAL_TEST_CHECK(!Button.is_pressed() && !Button.is_bouncing());
+    THE_HAL_TEST_CHECK((watcher.num_edges == 1) && watcher.levels[0]);
+
+    HostSimDevices::detach(&watcher.device);
+}
+
+/* A single clock move applies each record, and runs the device event in
+ * between, with the virtual clock at their own time */
+static void test_stimulus_timing(void)
+{
+    static the_hal_host_sim_test_stimulus stimulus;
+    const uint64_t times_ns[NUM_RECORDS] = { 5000, 7000, 20000, 20500 };
+    the_hal_host_sim_test_watcher watcher;
+
+    HostSim::reset();
+    build_stimulus(&stimulus, times_ns);
+    THE_HAL_TEST_CHECK(HostSimStimulus::load(&stimulus, sizeof(stimulus)));
+    THE_HAL_TEST_CHECK(watch(&watcher, PIN_STIMULUS));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&watcher.device,
+            WATCHER_EVENT_NS));
+
+    HostSim::advance_time_ns(100000);
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() == 100000);
+    THE_HAL_TEST_CHECK(HostSimStimulus::is_finished());
+    THE_HAL_TEST_CHECK(watcher.num_edges == NUM_RECORDS);
+    for(uint8_t i = 0; i < watcher.num_edges; i++)
+    {
+        THE_HAL_TEST_CHECK(watcher.edges_ns[i] == times_ns[i]);
+        THE_HAL_TEST_CHECK(watcher.levels[i] == ((i % 2) == 0));
+    }
+    THE_HAL_TEST_CHECK(watcher.level_at_event);
+
+    // Reset releases the device lines, cancels its events and replays the
+    // stimulus from the start
+    THE_HAL_TEST_CHECK(HostSimDevices::pull_low(&watcher.device,
+            PIN_STIMULUS, true));
+    THE_HAL_TEST_CHECK(HostSimDevices::schedule_at(&watcher.device,
+            200000));
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(!watcher.device.is_scheduled());
+    THE_HAL_TEST_CHECK(!HostSimStimulus::is_finished());
+    watcher.num_edges = 0;
+    HostSim::set_time_ns(times_ns[0]);
+    THE_HAL_TEST_CHECK(HostSim::read_pin(PIN_STIMULUS));
+    THE_HAL_TEST_CHECK((watcher.num_edges == 1) &&
+            (watcher.edges_ns[0] == times_ns[0]));
+
+    HostSimDevices::detach(&watcher.device);
+    HostSimStimulus::unload();
+    HostSim::reset();
+}
+
+/* A day of records from a memory-mapped file is served to DigitalIn and
+ * to the edge callback at the record times, and replayed in a few host
+ * milliseconds */
+static void test_stimulus_replay(void)
+{
+    char path[] = "/tmp/thehal_stimulus_XXXXXX";
+    the_hal_host_sim_test_replay replay = { 0, 0, 0 };
+    DigitalIn In(PIN_STIMULUS);
+    uint64_t start_ns;
+    uint64_t replay_ns;
+    int fd;
+
+    HostSim::reset();
+    fd = mkstemp(path);
+    if(!THE_HAL_TEST_CHECK(fd >= 0))
+        return;
+    THE_HAL_TEST_CHECK(write_replay_file(fd));
+
+    // The record at time 0 is already due when the file is loaded
+    HostSimStimulus::set_edge_callback(on_replay_edge, &replay);
+    THE_HAL_TEST_CHECK(In.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    THE_HAL_TEST_CHECK(HostSimStimulus::map_file(path));
+    unlink(path);
+    THE_HAL_TEST_CHECK((replay.num_edges == 1) && In.read());
+
+    // A single clock move applies each record at its time
+    THE_HAL_TEST_CHECK(HostSimStimulus::apply_until(10500000000ULL) ==
+            (FIRST_MOVE_RECORDS - 1));
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() == 10500000000ULL);
+    THE_HAL_TEST_CHECK(replay.num_edges == FIRST_MOVE_RECORDS);
+    THE_HAL_TEST_CHECK(In.read() == ((FIRST_MOVE_RECORDS % 2) == 1));
+
+    start_ns = the_hal_test_now_ns();
+    while(HostSimStimulus::advance_to_next());
+    replay_ns = the_hal_test_now_ns() - start_ns;
+
+    THE_HAL_TEST_CHECK(HostSimStimulus::is_finished());
+    THE_HAL_TEST_CHECK(replay.num_edges == REPLAY_RECORDS);
+    THE_HAL_TEST_CHECK((replay.wrong_times == 0) &&
+            (replay.wrong_edges == 0));
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() ==
+            ((REPLAY_RECORDS - 1) * REPLAY_PERIOD_NS));
+    THE_HAL_TEST_CHECK(In.read() == ((REPLAY_RECORDS % 2) == 1));
+
+    // Hours of stimulus replayed in seconds (an hour each host second)
+    THE_HAL_TEST_CHECK((replay_ns * 3600) < HostSim::get_time_ns());
+    printf("Stimulus replay: %.1f virtual hours in %.2f host ms\n",
+            (double)(HostSim::get_time_ns()) / 3600000000000.0,
+            (double)(replay_ns) / 1000000.0);
+
+    HostSimStimulus::set_edge_callback(nullptr, nullptr);
+    HostSimStimulus::unload();
+    HostSim::reset();
+}
+
+/* A burst longer than a page wraps to the start of the page */
+static void test_eeprom_page_wrap(SoftI2c* i2c, HostSimI2cEeprom* eeprom,
+        uint8_t* memory)
+{
+    uint8_t burst[2 + BURST_LENGTH];
+    uint8_t expected[PAGE_SIZE];
+    uint16_t offset;
+
+    for(uint16_t i = 0; i < PAGE_SIZE; i++)
+        expected[i] = memory[PAGE_ADDRESS + i];
+    burst[0] = (uint8_t)((PAGE_ADDRESS + PAGE_OFFSET) >> 8);
+    burst[1] = (uint8_t)((PAGE_ADDRESS + PAGE_OFFSET) & 0xff);
+    for(uint16_t i = 0; i < BURST_LENGTH; i++)
+    {
+        burst[2 + i] = (uint8_t)(0x80 + i);
+        offset = (PAGE_OFFSET + i) % PAGE_SIZE;
+        expected[offset] = burst[2 + i];
+    }
+
+    THE_HAL_TEST_CHECK(i2c->write(EEPROM_ADDRESS, burst, sizeof(burst)));
+    THE_HAL_TEST_CHECK(eeprom->is_busy());
+    HostSim::advance_time_ns(WRITE_TIME_NS);
+    THE_HAL_TEST_CHECK(!eeprom->is_busy());
+    THE_HAL_TEST_CHECK(eeprom->get_num_writes() == 1);
+
+    for(uint16_t i = 0; i < PAGE_SIZE; i++)
+    {
+        if(!THE_HAL_TEST_CHECK(memory[PAGE_ADDRESS + i] == expected[i]))
+            break;
+    }
+    THE_HAL_TEST_CHECK(memory[PAGE_ADDRESS - 1] == 0xff);
+    THE_HAL_TEST_CHECK(memory[PAGE_ADDRESS + PAGE_SIZE] == 0xff);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    static uint8_t memory[EEPROM_SIZE];
+    the_hal_host_sim_test_device devs[NUM_DEVICES];
+    DigitalOut Scl(PIN_SCL);
+    DigitalOut Sda(PIN_SDA);
+    SoftI2c I2c(&Scl, &Sda);
+    HostSimI2cEeprom Eeprom(PIN_SCL, PIN_SDA, EEPROM_ADDRESS, memory,
+            EEPROM_SIZE);
+
+    for(uint16_t i = 0; i < EEPROM_SIZE; i++)
+        memory[i] = 0xff;
+
+    HostSim::reset();
+    for(uint8_t i = 0; i < NUM_DEVICES; i++)
+    {
+        devs[i].id = i;
+        devs[i].period_ns = 0;
+        devs[i].remaining = 0;
+        devs[i].device.setup(nullptr, on_event, &(devs[i]));
+        THE_HAL_TEST_CHECK(HostSimDevices::attach(&(devs[i].device)));
+    }
+
+    test_events_order(devs);
+    test_periodic_events(devs);
+    test_stimulus_timing();
+    test_stimulus_replay();
+
+    THE_HAL_TEST_CHECK(Eeprom.setup(WRITE_TIME_NS));
+    THE_HAL_TEST_CHECK(I2c.setup(0));
+    test_eeprom_page_wrap(&I2c, &Eeprom, memory);
+
+    test_shift_register();
+    test_ws2812();
+    test_button();
+
+    for(uint8_t i = 0; i < NUM_DEVICES; i++)
+        HostSimDevices::detach(&(devs[i].device));
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,199 @@
+
+/**
+ * @file    keypad_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Matrix Keypad Host Test.
+ *
+ * A simulated key matrix watches the rows pins and, for each pressed key of
+ * a row that is driven low, pulls its column low (wired-AND with the column
+ * pull-ups). It checks that the columns read high with no key pressed, that
+ * single keys and two keys of the same column are decoded, and that the
+ * rows are left released (high) between scans.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define NUM_ROWS 4
+#define NUM_COLUMNS 4
+
+/* Rows are pins 0 to 3 and columns pins 8 to 11 (all in port 0) */
+#define FIRST_ROW_PIN 0
+#define FIRST_COLUMN_PIN 8
+
+/* Scans needed to debounce a change */
+#define DEBOUNCE_SCANS 4
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Simulated key matrix (bit row * columns + column of each pressed key) */
+typedef struct
+{
+    HostSimDevice device;
+    uint32_t pressed;
+} the_hal_keypad_sim;
+
+/* Key bit of a row and column */
+static uint32_t key(const uint8_t row, const uint8_t column)
+{
+    return (1UL << (row * NUM_COLUMNS + column));
+}
+
+/* Pull low the columns of the pressed keys of the rows driven low */
+static void on_rows_edge(void* arg, const uint8_t port, const uint32_t,
+        const uint32_t)
+{
+    the_hal_keypad_sim* sim = (the_hal_keypad_sim*)(arg);
+    uint32_t current = HostSim::read_port(port);
+    uint8_t low_columns = 0;
+
+    for(uint8_t row = 0; row < NUM_ROWS; row++)
+    {
+        if(current & (1UL << (FIRST_ROW_PIN + row)))
+            continue;
+        low_columns = low_columns |
+                ((sim->pressed >> (row * NUM_COLUMNS)) & 0x0f);
+    }
+
+    for(uint8_t column = 0; column < NUM_COLUMNS; column++)
+    {
+        HostSimDevices::pull_low(&sim->device, FIRST_COLUMN_PIN + column,
+                ((low_columns >> column) & 1));
+    }
+}
+
+/* Scan until the keys are debounced */
+static uint64_t scan(Keypad* keypad)
+{
+    for(uint8_t i = 0; i < DEBOUNCE_SCANS; i++)
+        keypad->scan();
+    return keypad->scan();
+}
+
+/* Check that no row is left selected after a scan */
+static bool rows_are_released(void)
+{
+    for(uint8_t row = 0; row < NUM_ROWS; row++)
+    {
+        if(!HostSim::read_pin(FIRST_ROW_PIN + row))
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Columns read high (not pressed) with only the pull-ups */
+static void test_no_keys(Keypad* keypad, DigitalInBus* columns,
+        the_hal_keypad_sim* sim)
+{
+    sim->pressed = 0;
+    THE_HAL_TEST_CHECK(columns->read() == 0x0f);
+    THE_HAL_TEST_CHECK(scan(keypad) == 0);
+    THE_HAL_TEST_CHECK(rows_are_released());
+}
+
+/* Single keys are decoded at their row and column */
+static void test_single_keys(Keypad* keypad, the_hal_keypad_sim* sim)
+{
+    for(uint8_t row = 0; row < NUM_ROWS; row++)
+    {
+        for(uint8_t column = 0; column < NUM_COLUMNS; column++)
+        {
+            sim->pressed = key(row, column);
+            THE_HAL_TEST_CHECK(scan(keypad) == key(row, column));
+            THE_HAL_TEST_CHECK(keypad->is_pressed(row, column));
+        }
+    }
+    sim->pressed = 0;
+    THE_HAL_TEST_CHECK(scan(keypad) == 0);
+}
+
+/* Two keys of the same column (the case that shorts push-pull rows) */
+static void test_same_column(Keypad* keypad, the_hal_keypad_sim* sim)
+{
+    sim->pressed = key(0, 2) | key(3, 2);
+    THE_HAL_TEST_CHECK(scan(keypad) == (key(0, 2) | key(3, 2)));
+    THE_HAL_TEST_CHECK(keypad->get_ghost_keys() == 0);
+    THE_HAL_TEST_CHECK(rows_are_released());
+
+    sim->pressed = key(1, 0) | key(1, 3) | key(2, 0);
+    THE_HAL_TEST_CHECK(scan(keypad) == sim->pressed);
+    sim->pressed = 0;
+    THE_HAL_TEST_CHECK(scan(keypad) == 0);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalOut Row0(FIRST_ROW_PIN + 0);
+    DigitalOut Row1(FIRST_ROW_PIN + 1);
+    DigitalOut Row2(FIRST_ROW_PIN + 2);
+    DigitalOut Row3(FIRST_ROW_PIN + 3);
+    DigitalOut* rows[NUM_ROWS] = { &Row0, &Row1, &Row2, &Row3 };
+    const int8_t column_pins[NUM_COLUMNS] = { FIRST_COLUMN_PIN + 0,
+            FIRST_COLUMN_PIN + 1, FIRST_COLUMN_PIN + 2,
+            FIRST_COLUMN_PIN + 3 };
+    DigitalInBus Columns(column_pins, NUM_COLUMNS);
+    Keypad MyKeypad(rows, NUM_ROWS, &Columns, NUM_COLUMNS);
+    the_hal_keypad_sim sim;
+
+    HostSim::reset();
+    sim.pressed = 0;
+    sim.device.setup(on_rows_edge, nullptr, &sim);
+    HostSimDevices::attach(&sim.device);
+    for(uint8_t row = 0; row < NUM_ROWS; row++)
+        HostSimDevices::watch_pin(&sim.device, FIRST_ROW_PIN + row);
+
+    THE_HAL_TEST_CHECK(MyKeypad.setup());
+    test_no_keys(&MyKeypad, &Columns, &sim);
+    test_single_keys(&MyKeypad, &sim);
+    test_same_column(&MyKeypad, &sim);
+
+    HostSimDevices::detach(&sim.device);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,278 @@
+/**
+ * @file    latency_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Latency Histogram Host Test.
+ *
+ * The log-linear buckets are checked to cover all the 32 bits values in
+ * order and without gaps, with a bucket width that keeps the error of the
+ * reported values below 2^-SUB_BUCKET_BITS of the value. The percentiles
+ * of a wide random distribution are checked against the exact ones of the
+ * sorted values, and the dump() text against a known histogram.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "thehal.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Values checked one by one from 0 */
+#define NUM_SMALL_VALUES (1UL << 20)
+
+/* Recorded values of the percentiles check */
+#define NUM_VALUES 100000
+
+/* Size of the dump text capture */
+#define TEXT_SIZE 128
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Text written by dump() */
+typedef struct
+{
+    char text[TEXT_SIZE];
+    uint16_t length;
+    bool fail;
+} the_hal_latency_test_text;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static uint32_t Values[NUM_VALUES];
+
+/*****************************************************************************/
+
+/* Auxiliary Functions */
+
+/* Get a pseudo random number (xorshift) */
+static uint32_t random_number(void)
+{
+    static uint32_t state = 0x9e3779b9;
+
+    state = state ^ (state << 13);
+    state = state ^ (state >> 17);
+    state = state ^ (state << 5);
+    return state;
+}
+
+/* Order of two values for qsort() */
+static int compare_values(const void* a, const void* b)
+{
+    uint32_t value_a = *(const uint32_t*)(a);
+    uint32_t value_b = *(const uint32_t*)(b);
+
+    if(value_a < value_b)
+        return -1;
+    return (value_a > value_b) ? 1 : 0;
+}
+
+/* Capture the dump() text (or fail as a full output) */
+static bool write_text(void* arg, const uint8_t* data, const uint16_t size)
+{
+    the_hal_latency_test_text* capture = (the_hal_latency_test_text*)(arg);
+
+    if(capture->fail || ((capture->length + size) >= TEXT_SIZE))
+        return false;
+
+    memcpy(&(capture->text[capture->length]), data, size);
+    capture->length = capture->length + size;
+    capture->text[capture->length] = '\0';
+    return true;
+}
+
+/* Check if the reported value of a bucket is within the error bound of a
+ * value of the bucket */
+static bool is_within_error(const uint32_t value, const uint32_t reported)
+{
+    if(reported < value)
+        return false;
+    return (((uint64_t)(reported - value) * THE_HAL_LATENCY_SUB_BUCKETS) <=
+            value);
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Buckets go up with the values, with no gaps and no overlaps */
+static void test_buckets_order(void)
+{
+    uint32_t wrong_buckets = 0;
+    uint16_t last_bucket = 0;
+    uint16_t bucket;
+
+    for(uint32_t value = 0; value < NUM_SMALL_VALUES; value++)
+    {
+        bucket = LatencyHistogram::get_bucket(value);
+        if((bucket < last_bucket) || (bucket > (last_bucket + 1)) ||
+           (value > LatencyHistogram::get_bucket_max(bucket)))
+            wrong_buckets = wrong_buckets + 1;
+        last_bucket = bucket;
+    }
+    THE_HAL_TEST_CHECK(wrong_buckets == 0);
+
+    // Each bucket starts right after the previous one and the last one
+    // ends at the largest value
+    for(uint16_t i = 1; i < THE_HAL_LATENCY_BUCKETS; i++)
+    {
+        uint32_t first = LatencyHistogram::get_bucket_max(i - 1) + 1;
+        uint32_t last = LatencyHistogram::get_bucket_max(i);
+
+        if((first > last) || (LatencyHistogram::get_bucket(first) != i) ||
+           (LatencyHistogram::get_bucket(last) != i))
+            wrong_buckets = wrong_buckets + 1;
+    }
+    THE_HAL_TEST_CHECK(wrong_buckets == 0);
+    THE_HAL_TEST_CHECK(LatencyHistogram::get_bucket_max(
+            THE_HAL_LATENCY_BUCKETS - 1) == 0xffffffffUL);
+    THE_HAL_TEST_CHECK(LatencyHistogram::get_bucket(0xffffffffUL) ==
+            (THE_HAL_LATENCY_BUCKETS - 1));
+}
+
+/* The highest value of a bucket is within 2^-SUB_BUCKET_BITS of any value
+ * of the bucket (exact for the linear buckets) */
+static void test_error_bound(void)
+{
+    uint32_t wrong_errors = 0;
+    uint32_t value;
+
+    for(uint16_t i = 0; i < THE_HAL_LATENCY_BUCKETS; i++)
+    {
+        // Lowest value of the bucket is the worst case
+        value = (i == 0) ? 0 : (LatencyHistogram::get_bucket_max(i - 1) + 1);
+        if(!is_within_error(value, LatencyHistogram::get_bucket_max(i)))
+            wrong_errors = wrong_errors + 1;
+        if((i < THE_HAL_LATENCY_SUB_BUCKETS) &&
+           (LatencyHistogram::get_bucket_max(i) != i))
+            wrong_errors = wrong_errors + 1;
+    }
+    for(uint32_t i = 0; i < NUM_VALUES; i++)
+    {
+        value = random_number();
+        if(!is_within_error(value, LatencyHistogram::get_bucket_max(
+                LatencyHistogram::get_bucket(value))))
+            wrong_errors = wrong_errors + 1;
+    }
+    THE_HAL_TEST_CHECK(wrong_errors == 0);
+}
+
+/* Percentiles of a wide distribution (all the powers of two) are the
+ * bucket of the exact ones (limited to the max) */
+static void test_percentiles(void)
+{
+    static LatencyHistogram Histogram;
+    const uint16_t per_milles[] = { 1, 500, 900, 990, 999, 1000 };
+    uint32_t target;
+    uint32_t exact;
+    uint32_t expected;
+    uint32_t reported;
+    uint32_t max = 0;
+
+    for(uint32_t i = 0; i < NUM_VALUES; i++)
+    {
+        Values[i] = random_number() >> (random_number() % 32);
+        Histogram.record(Values[i]);
+        if(Values[i] > max)
+            max = Values[i];
+    }
+    qsort(Values, NUM_VALUES, sizeof(Values[0]), compare_values);
+    THE_HAL_TEST_CHECK(Histogram.get_count() == NUM_VALUES);
+    THE_HAL_TEST_CHECK(Histogram.get_max() == max);
+
+    for(uint8_t i = 0; i < (sizeof(per_milles) / sizeof(per_milles[0]));
+            i++)
+    {
+        target = ((NUM_VALUES * per_milles[i]) + 999) / 1000;
+        exact = Values[target - 1];
+        expected = LatencyHistogram::get_bucket_max(
+                LatencyHistogram::get_bucket(exact));
+        if(expected > max)
+            expected = max;
+        reported = Histogram.get_percentile(per_milles[i]);
+        THE_HAL_TEST_CHECK(reported == expected);
+        THE_HAL_TEST_CHECK(is_within_error(exact, reported));
+    }
+    THE_HAL_TEST_CHECK(Histogram.get_percentile(1000) == max);
+
+    Histogram.reset();
+    THE_HAL_TEST_CHECK((Histogram.get_count() == 0) &&
+            (Histogram.get_max() == 0) &&
+            (Histogram.get_percentile(500) == 0));
+}
+
+/* Text line of a known histogram (1 to 100: p50 is the top of the bucket
+ * of 50, p99.9 is limited to the max) */
+static void test_dump(void)
+{
+    static LatencyHistogram Histogram;
+    the_hal_latency_test_text capture;
+
+    capture.length = 0;
+    capture.fail = false;
+    THE_HAL_TEST_CHECK(Histogram.dump(write_text, &capture));
+    THE_HAL_TEST_CHECK(strcmp(capture.text, "count=0 p50=0 p99=0 p99.9=0 "
+            "max=0 cycles@1000000000Hz\n") == 0);
+
+    for(uint32_t value = 1; value <= 100; value++)
+        Histogram.record(value);
+    capture.length = 0;
+    THE_HAL_TEST_CHECK(Histogram.dump(write_text, &capture));
+    THE_HAL_TEST_CHECK(strcmp(capture.text, "count=100 p50=51 p99=99 "
+            "p99.9=100 max=100 cycles@1000000000Hz\n") == 0);
+
+    // Writer errors are reported
+    capture.fail = true;
+    THE_HAL_TEST_CHECK(!Histogram.dump(write_text, &capture));
+    THE_HAL_TEST_CHECK(!Histogram.dump(nullptr, nullptr));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    test_buckets_order();
+    test_error_bound();
+    test_percentiles();
+    test_dump();
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
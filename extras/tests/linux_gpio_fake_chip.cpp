@@ -0,0 +1,415 @@
+
+/**
+ * @file    linux_gpio_fake_chip.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Linux GPIO In-Process Fake Chip.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(LINUX_GPIO)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "linux_gpio_fake_chip.h"
+
+#include <errno.h>
+#include <string.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    CHIP_FD = 100,
+    FIRST_REQUEST_FD = 101
+} the_hal_linux_gpio_fake_chip_constants;
+
+/*****************************************************************************/
+
+/* Static Members */
+
+the_hal_linux_gpio_fake_request
+        LinuxGpioFakeChip::requests[THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS];
+uint64_t LinuxGpioFakeChip::values = 0;
+uint64_t LinuxGpioFakeChip::used_lines = 0;
+uint32_t LinuxGpioFakeChip::num_ioctls = 0;
+bool LinuxGpioFakeChip::chip_open = false;
+
+const the_hal_linux_gpio_ops LinuxGpioFakeChip::ops =
+{
+    LinuxGpioFakeChip::fake_open,
+    LinuxGpioFakeChip::fake_close,
+    LinuxGpioFakeChip::fake_ioctl,
+    LinuxGpioFakeChip::fake_read,
+    LinuxGpioFakeChip::fake_poll
+};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Release all line requests and set all lines to logical low */
+void LinuxGpioFakeChip::reset(void)
+{
+    memset(requests, 0, sizeof(requests));
+    values = 0;
+    used_lines = 0;
+    num_ioctls = 0;
+    chip_open = false;
+}
+
+/* Get the system calls table to be set in LinuxGpioLines::set_ops() */
+const the_hal_linux_gpio_ops* LinuxGpioFakeChip::get_ops(void)
+{
+    return &ops;
+}
+
+/* Drive a line from outside, queuing an edge event if it was requested */
+bool LinuxGpioFakeChip::set_line(const uint8_t offset, const bool value,
+        const uint64_t timestamp_ns)
+{
+    the_hal_linux_gpio_fake_request* request;
+    struct gpio_v2_line_event* event;
+    uint64_t mask;
+    uint64_t edge_flag;
+    uint16_t position;
+
+    if(offset >= THE_HAL_LINUX_GPIO_FAKE_NUM_LINES)
+        return false;
+
+    mask = (1ULL << offset);
+    if(((values & mask) != 0) == value)
+        return true;
+    values = (value) ? (values | mask) : (values & ~mask);
+
+    edge_flag = (value) ? GPIO_V2_LINE_FLAG_EDGE_RISING :
+            GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    for(uint8_t i = 0; i < THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS; i++)
+    {
+        request = &(requests[i]);
+        if(!request->used || !(request->flags & edge_flag))
+            continue;
+
+        for(uint8_t line = 0; line < request->num_lines; line++)
+        {
+            if(request->offsets[line] != offset)
+                continue;
+
+            // Like the kernel kfifo, a full buffer drops the oldest event
+            if(request->num_events == THE_HAL_LINUX_GPIO_FAKE_EVENTS)
+            {
+                request->first_event = (request->first_event + 1) %
+                        THE_HAL_LINUX_GPIO_FAKE_EVENTS;
+                request->num_events = request->num_events - 1;
+            }
+            position = (request->first_event + request->num_events) %
+                    THE_HAL_LINUX_GPIO_FAKE_EVENTS;
+            event = &(request->events[position]);
+            memset(event, 0, sizeof(*event));
+            event->timestamp_ns = timestamp_ns;
+            event->id = (value) ? GPIO_V2_LINE_EVENT_RISING_EDGE :
+                    GPIO_V2_LINE_EVENT_FALLING_EDGE;
+            event->offset = offset;
+            request->seqno = request->seqno + 1;
+            event->seqno = request->seqno;
+            event->line_seqno = request->seqno;
+            request->num_events = request->num_events + 1;
+            break;
+        }
+    }
+
+    return true;
+}
+
+/* Get the logical value of a line */
+bool LinuxGpioFakeChip::get_line(const uint8_t offset)
+{
+    if(offset >= THE_HAL_LINUX_GPIO_FAKE_NUM_LINES)
+        return false;
+
+    return ((values & (1ULL << offset)) != 0);
+}
+
+/* Get number of ioctl calls done since reset */
+uint32_t LinuxGpioFakeChip::get_num_ioctls(void)
+{
+    return num_ioctls;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Fake open() of the gpiochip character device */
+int LinuxGpioFakeChip::fake_open(const char*, int)
+{
+    if(chip_open)
+        return fail(EBUSY);
+
+    chip_open = true;
+    return CHIP_FD;
+}
+
+/* Fake close() of the gpiochip or of a line request */
+int LinuxGpioFakeChip::fake_close(int fd)
+{
+    the_hal_linux_gpio_fake_request* request;
+
+    if(fd == CHIP_FD)
+    {
+        if(!chip_open)
+            return fail(EBADF);
+        chip_open = false;
+        return 0;
+    }
+
+    request = get_request(fd);
+    if(request == nullptr)
+        return fail(EBADF);
+
+    for(uint8_t line = 0; line < request->num_lines; line++)
+        used_lines = used_lines & ~(1ULL << request->offsets[line]);
+    memset(request, 0, sizeof(*request));
+
+    return 0;
+}
+
+/* Fake ioctl() of the gpiochip v2 uAPI */
+int LinuxGpioFakeChip::fake_ioctl(int fd, unsigned long request, void* arg)
+{
+    the_hal_linux_gpio_fake_request* line_request;
+    struct gpio_v2_line_values* line_values;
+    uint64_t bit;
+
+    num_ioctls = num_ioctls + 1;
+
+    if(fd == CHIP_FD)
+    {
+        if(!chip_open)
+            return fail(EBADF);
+        if(request != GPIO_V2_GET_LINE_IOCTL)
+            return fail(ENOTTY);
+        return request_lines((struct gpio_v2_line_request*)arg);
+    }
+
+    line_request = get_request(fd);
+    if(line_request == nullptr)
+        return fail(EBADF);
+
+    switch(request)
+    {
+        case GPIO_V2_LINE_SET_CONFIG_IOCTL:
+            apply_config(line_request, (struct gpio_v2_line_config*)arg);
+            return 0;
+
+        case GPIO_V2_LINE_GET_VALUES_IOCTL:
+            line_values = (struct gpio_v2_line_values*)arg;
+            for(uint8_t line = 0; line < line_request->num_lines; line++)
+            {
+                bit = (1ULL << line);
+                if(!(line_values->mask & bit))
+                    continue;
+                if(get_line(line_request->offsets[line]))
+                    line_values->bits = line_values->bits | bit;
+                else
+                    line_values->bits = line_values->bits & ~bit;
+            }
+            return 0;
+
+        case GPIO_V2_LINE_SET_VALUES_IOCTL:
+            if(!(line_request->flags & GPIO_V2_LINE_FLAG_OUTPUT))
+                return fail(EPERM);
+            line_values = (struct gpio_v2_line_values*)arg;
+            for(uint8_t line = 0; line < line_request->num_lines; line++)
+            {
+                bit = (1ULL << line);
+                if(!(line_values->mask & bit))
+                    continue;
+                if(line_values->bits & bit)
+                    values = values | (1ULL << line_request->offsets[line]);
+                else
+                    values = values & ~(1ULL << line_request->offsets[line]);
+            }
+            return 0;
+
+        default:
+            return fail(ENOTTY);
+    }
+}
+
+/* Fake read() of whole edge events from a line request */
+ssize_t LinuxGpioFakeChip::fake_read(int fd, void* buffer, size_t size)
+{
+    the_hal_linux_gpio_fake_request* request;
+    struct gpio_v2_line_event* events = (struct gpio_v2_line_event*)buffer;
+    size_t num_events = size / sizeof(struct gpio_v2_line_event);
+    size_t num_read = 0;
+
+    request = get_request(fd);
+    if(request == nullptr)
+        return fail(EBADF);
+    if(num_events == 0)
+        return fail(EINVAL);
+    if(request->num_events == 0)
+        return fail(EAGAIN);
+
+    while((num_read < num_events) && (request->num_events > 0))
+    {
+        events[num_read] = request->events[request->first_event];
+        request->first_event = (request->first_event + 1) %
+                THE_HAL_LINUX_GPIO_FAKE_EVENTS;
+        request->num_events = request->num_events - 1;
+        num_read = num_read + 1;
+    }
+
+    return (ssize_t)(num_read * sizeof(struct gpio_v2_line_event));
+}
+
+/* Fake poll() of line requests, it never blocks */
+int LinuxGpioFakeChip::fake_poll(struct pollfd* fds, nfds_t num_fds, int)
+{
+    the_hal_linux_gpio_fake_request* request;
+    int num_ready = 0;
+
+    for(nfds_t i = 0; i < num_fds; i++)
+    {
+        fds[i].revents = 0;
+        request = get_request(fds[i].fd);
+        if(request == nullptr)
+            fds[i].revents = POLLNVAL;
+        else if((request->num_events > 0) && (fds[i].events & POLLIN))
+            fds[i].revents = POLLIN;
+        if(fds[i].revents != 0)
+            num_ready = num_ready + 1;
+    }
+
+    return num_ready;
+}
+
+/* Get line request of a file descriptor */
+the_hal_linux_gpio_fake_request* LinuxGpioFakeChip::get_request(const int fd)
+{
+    int index = fd - FIRST_REQUEST_FD;
+
+    if((index < 0) || (index >= THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS))
+        return nullptr;
+    if(!requests[index].used)
+        return nullptr;
+
+    return &(requests[index]);
+}
+
+/* Emulate GPIO_V2_GET_LINE_IOCTL, lines can't be requested twice */
+int LinuxGpioFakeChip::request_lines(struct gpio_v2_line_request* request)
+{
+    the_hal_linux_gpio_fake_request* line_request = nullptr;
+    uint64_t lines = 0;
+    uint8_t index;
+
+    if((request->num_lines == 0) ||
+            (request->num_lines > THE_HAL_LINUX_GPIO_MAX_LINES))
+        return fail(EINVAL);
+    for(uint32_t line = 0; line < request->num_lines; line++)
+    {
+        if(request->offsets[line] >= THE_HAL_LINUX_GPIO_FAKE_NUM_LINES)
+            return fail(EINVAL);
+        lines = lines | (1ULL << request->offsets[line]);
+    }
+    if(used_lines & lines)
+        return fail(EBUSY);
+
+    for(index = 0; index < THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS; index++)
+    {
+        if(!requests[index].used)
+        {
+            line_request = &(requests[index]);
+            break;
+        }
+    }
+    if(line_request == nullptr)
+        return fail(ENOMEM);
+
+    memset(line_request, 0, sizeof(*line_request));
+    line_request->used = true;
+    line_request->num_lines = request->num_lines;
+    for(uint8_t line = 0; line < line_request->num_lines; line++)
+        line_request->offsets[line] = request->offsets[line];
+    apply_config(line_request, &request->config);
+    used_lines = used_lines | lines;
+    request->fd = FIRST_REQUEST_FD + index;
+
+    return 0;
+}
+
+/* Apply lines flags and initial output values of a configuration */
+void LinuxGpioFakeChip::apply_config(
+        the_hal_linux_gpio_fake_request* request,
+        const struct gpio_v2_line_config* config)
+{
+    const struct gpio_v2_line_config_attribute* attr;
+    uint64_t bit;
+
+    request->flags = config->flags;
+    if(!(config->flags & GPIO_V2_LINE_FLAG_OUTPUT))
+        return;
+
+    for(uint32_t i = 0; i < config->num_attrs; i++)
+    {
+        attr = &(config->attrs[i]);
+        if(attr->attr.id != GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES)
+            continue;
+
+        for(uint8_t line = 0; line < request->num_lines; line++)
+        {
+            bit = (1ULL << line);
+            if(!(attr->mask & bit))
+                continue;
+            if(attr->attr.values & bit)
+                values = values | (1ULL << request->offsets[line]);
+            else
+                values = values & ~(1ULL << request->offsets[line]);
+        }
+    }
+}
+
+/* Set errno and return the system calls error value */
+int LinuxGpioFakeChip::fail(const int error)
+{
+    errno = error;
+    return -1;
+}
+
+/*****************************************************************************/
+
+#endif /* defined(LINUX_GPIO) */
+
+/*****************************************************************************/
@@ -0,0 +1,125 @@
+
+/**
+ * @file    linux_gpio_fake_chip.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Linux GPIO In-Process Fake Chip.
+ *
+ * Emulates the gpiochip v2 uAPI (line requests, get/set values, set config
+ * and edge events) behind the_hal_linux_gpio_ops, so linux backends can be
+ * tested without kernel gpio-sim (it is only built by the host tests):
+ *
+ *   LinuxGpioFakeChip::reset();
+ *   LinuxGpioLines::set_ops(LinuxGpioFakeChip::get_ops());
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_LINUX_GPIO_FAKE_CHIP_H_
+#define THE_HAL_LINUX_GPIO_FAKE_CHIP_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "components/linux_gpio_controller/linux_gpio.h"
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of lines of the fake chip */
+#define THE_HAL_LINUX_GPIO_FAKE_NUM_LINES 64
+
+/* Maximum number of simultaneous line requests */
+#define THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS 8
+
+/* Edge events buffered in each line request (oldest are overwritten) */
+#define THE_HAL_LINUX_GPIO_FAKE_EVENTS 64
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef struct
+{
+    struct gpio_v2_line_event events[THE_HAL_LINUX_GPIO_FAKE_EVENTS];
+    uint32_t offsets[THE_HAL_LINUX_GPIO_MAX_LINES];
+    uint64_t flags;
+    uint32_t seqno;
+    uint16_t first_event;
+    uint16_t num_events;
+    uint8_t num_lines;
+    bool used;
+} the_hal_linux_gpio_fake_request;
+
+/*****************************************************************************/
+
+/* Class */
+
+class LinuxGpioFakeChip
+{
+    public:
+        static void reset(void);
+        static const the_hal_linux_gpio_ops* get_ops(void);
+
+        static bool set_line(const uint8_t offset, const bool value,
+                const uint64_t timestamp_ns);
+        static bool get_line(const uint8_t offset);
+        static uint32_t get_num_ioctls(void);
+
+    private:
+        static the_hal_linux_gpio_fake_request
+                requests[THE_HAL_LINUX_GPIO_FAKE_MAX_REQUESTS];
+        static uint64_t values;
+        static uint64_t used_lines;
+        static uint32_t num_ioctls;
+        static bool chip_open;
+
+        static const the_hal_linux_gpio_ops ops;
+
+        static int fake_open(const char* path, int flags);
+        static int fake_close(int fd);
+        static int fake_ioctl(int fd, unsigned long request, void* arg);
+        static ssize_t fake_read(int fd, void* buffer, size_t size);
+        static int fake_poll(struct pollfd* fds, nfds_t num_fds,
+                int timeout_ms);
+
+        static the_hal_linux_gpio_fake_request* get_request(const int fd);
+        static int request_lines(struct gpio_v2_line_request* request);
+        static void apply_config(the_hal_linux_gpio_fake_request* request,
+                const struct gpio_v2_line_config* config);
+        static int fail(const int error);
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_GPIO_FAKE_CHIP_H_ */
@@ -0,0 +1,164 @@
+
+/**
+ * @file    linux_gpio_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Linux GPIO Backends Host Test.
+ *
+ * Linux DigitalOut and DigitalIn backends run against the in-process fake
+ * gpiochip, checking lines values, that a line can't be requested twice
+ * until it is released, that bus accesses are a single ioctl and the edge
+ * events translation to bus GPIO indexes.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/digital_in_controller/digital_in.h"
+
+#include "linux_gpio_fake_chip.h"
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Start each test with a fresh fake chip */
+static void reset_chip(void)
+{
+    LinuxGpioFakeChip::reset();
+    LinuxGpioLines::set_ops(LinuxGpioFakeChip::get_ops());
+}
+
+/* Output line values follow the DigitalOut writes */
+static void test_digital_out(void)
+{
+    DigitalOut Led(3);
+
+    reset_chip();
+    THE_HAL_TEST_CHECK(!Led.set_high());
+    THE_HAL_TEST_CHECK(Led.setup(1));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(3));
+    THE_HAL_TEST_CHECK(Led.set_low());
+    THE_HAL_TEST_CHECK(!LinuxGpioFakeChip::get_line(3));
+    THE_HAL_TEST_CHECK(Led.toggle());
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(3));
+    THE_HAL_TEST_CHECK(Led.setup(0));
+    THE_HAL_TEST_CHECK(!LinuxGpioFakeChip::get_line(3));
+    THE_HAL_TEST_CHECK(!Led.setup(2));
+}
+
+/* A requested line is busy until its owner is destroyed */
+static void test_line_ownership(void)
+{
+    DigitalIn Input(5);
+
+    reset_chip();
+    {
+        DigitalOut Output(5);
+        THE_HAL_TEST_CHECK(Output.setup(0));
+        THE_HAL_TEST_CHECK(!Input.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    }
+    THE_HAL_TEST_CHECK(Input.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+}
+
+/* Bus writes and reads are a single ioctl */
+static void test_buses(void)
+{
+    static const int8_t OUT_PINS[4] = { 10, 11, 12, 13 };
+    static const int8_t IN_PINS[3] = { 20, 22, 21 };
+    DigitalOutBus Outputs(OUT_PINS, 4);
+    DigitalInBus Inputs(IN_PINS, 3);
+    uint32_t num_ioctls;
+
+    reset_chip();
+    THE_HAL_TEST_CHECK(Outputs.setup(0x05));
+    THE_HAL_TEST_CHECK(Inputs.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(10));
+    THE_HAL_TEST_CHECK(!LinuxGpioFakeChip::get_line(11));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(12));
+
+    num_ioctls = LinuxGpioFakeChip::get_num_ioctls();
+    THE_HAL_TEST_CHECK(Outputs.write_masked(0x0a, 0x01));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_num_ioctls() ==
+            (num_ioctls + 1));
+    THE_HAL_TEST_CHECK(!LinuxGpioFakeChip::get_line(10));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(11));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(12));
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_line(13));
+
+    LinuxGpioFakeChip::set_line(22, true, 0);
+    num_ioctls = LinuxGpioFakeChip::get_num_ioctls();
+    THE_HAL_TEST_CHECK(Inputs.read() == 0x02);
+    THE_HAL_TEST_CHECK(LinuxGpioFakeChip::get_num_ioctls() ==
+            (num_ioctls + 1));
+}
+
+/* Edge events are reported with the bus GPIO index */
+static void test_events(void)
+{
+    static const int8_t IN_PINS[2] = { 31, 30 };
+    DigitalInBus Inputs(IN_PINS, 2);
+    the_hal_linux_gpio_event events[4];
+
+    reset_chip();
+    THE_HAL_TEST_CHECK(Inputs.setup(THE_HAL_DIGITAL_IN_PULLUP));
+    THE_HAL_TEST_CHECK(Inputs.read_events(events, 4) == 0);
+    THE_HAL_TEST_CHECK(Inputs.setup_events(THE_HAL_LINUX_GPIO_EDGE_RISING));
+
+    LinuxGpioFakeChip::set_line(30, true, 100);
+    LinuxGpioFakeChip::set_line(30, false, 200);
+    LinuxGpioFakeChip::set_line(31, true, 300);
+    THE_HAL_TEST_CHECK(Inputs.read_events(events, 4) == 2);
+    THE_HAL_TEST_CHECK((events[0].line == 1) && events[0].rising);
+    THE_HAL_TEST_CHECK(events[0].timestamp_ns == 100);
+    THE_HAL_TEST_CHECK((events[1].line == 0) && events[1].rising);
+    THE_HAL_TEST_CHECK(events[1].timestamp_ns == 300);
+    THE_HAL_TEST_CHECK(Inputs.read_events(events, 4) == 0);
+
+    // Pull mode changes keep the edge detection
+    THE_HAL_TEST_CHECK(Inputs.setup(THE_HAL_DIGITAL_IN_PULLDOWN));
+    LinuxGpioFakeChip::set_line(30, true, 400);
+    THE_HAL_TEST_CHECK(Inputs.read_events(events, 4) == 1);
+    THE_HAL_TEST_CHECK((events[0].line == 1) && events[0].rising);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    test_digital_out();
+    test_line_ownership();
+    test_buses();
+    test_events();
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,354 @@
+
+/**
+ * @file    logic_capture_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Logic Capture Host Test.
+ *
+ * Runs of known bus values are sampled from the simulated ports, streamed
+ * into memory while sampling (more records than a buffer, so the buffers
+ * are swapped) and decoded back with LogicCaptureReader. Runs as long as
+ * a multi-byte varint, a truncated capture and a capture replayed into the
+ * simulated ports (one change per record seen by a watching device) are
+ * checked, and the VCD export of a small capture is compared with the
+ * expected text.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+#include <string.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Captured bus (2 bytes values), on pins 0 to 9 */
+#define NUM_PINS 10
+#define PINS_MASK 0x3ff
+
+#define SAMPLE_PERIOD_NS 1000
+
+/* Captured runs (more than the records of a buffer) and runs between
+ * stream() calls */
+#define NUM_RUNS (THE_HAL_LOGIC_CAPTURE_RECORDS + 300)
+#define STREAM_RUNS 100
+
+/* Memory of the streamed captures */
+#define CAPTURE_SIZE 16384
+#define VCD_SIZE 1024
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Memory written by the capture writer */
+typedef struct
+{
+    uint8_t* data;
+    uint32_t size;
+    uint32_t capacity;
+} the_hal_logic_capture_test_memory;
+
+/* Device that counts the edge callbacks of the replay */
+typedef struct
+{
+    HostSimDevice device;
+    uint32_t num_callbacks;
+} the_hal_logic_capture_test_watcher;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+static uint32_t Values[NUM_RUNS];
+static uint32_t Counts[NUM_RUNS];
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Append the capture data to memory */
+static bool write_memory(void* arg, const uint8_t* data, const uint16_t size)
+{
+    the_hal_logic_capture_test_memory* memory =
+            (the_hal_logic_capture_test_memory*)(arg);
+
+    if((memory->size + size) > memory->capacity)
+        return false;
+    memcpy(&(memory->data[memory->size]), data, size);
+    memory->size = memory->size + size;
+
+    return true;
+}
+
+/* Count the replayed changes */
+static void on_replay_edge(void* arg, const uint8_t, const uint32_t,
+        const uint32_t)
+{
+    the_hal_logic_capture_test_watcher* watcher =
+            (the_hal_logic_capture_test_watcher*)(arg);
+
+    watcher->num_callbacks = watcher->num_callbacks + 1;
+}
+
+/* Build the runs: consecutive different values, mostly short runs and some
+ * runs of 1, 2 and 3 bytes varint lengths */
+static void build_runs(void)
+{
+    const uint32_t long_counts[4] = { 127, 128, 16383, 16384 };
+    uint32_t state = 0x2545f491;
+
+    for(uint32_t i = 0; i < NUM_RUNS; i++)
+    {
+        state = state ^ (state << 13);
+        state = state ^ (state >> 17);
+        state = state ^ (state << 5);
+        Values[i] = (state & PINS_MASK);
+        if((i > 0) && (Values[i] == Values[i - 1]))
+            Values[i] = Values[i] ^ 1;
+        Counts[i] = 1 + ((state >> 16) % 4);
+        if((i % 97) == 0)
+            Counts[i] = long_counts[(i / 97) % 4];
+    }
+}
+
+/* Sample the runs of the simulated bus, streaming them while sampling,
+ * returns the records written */
+static int32_t capture(LogicCapture* capture, const uint32_t* values,
+        const uint32_t* counts, const uint32_t num_runs,
+        the_hal_logic_capture_test_memory* memory)
+{
+    int32_t num_records = 0;
+    int32_t num_streamed;
+
+    memory->size = 0;
+    if(!capture->start(SAMPLE_PERIOD_NS))
+        return -1;
+
+    for(uint32_t i = 0; i < num_runs; i++)
+    {
+        HostSim::write_port(0, PINS_MASK, values[i]);
+        for(uint32_t sample = 0; sample < counts[i]; sample++)
+            capture->sample();
+        if(((i + 1) % STREAM_RUNS) != 0)
+            continue;
+        num_streamed = capture->stream(write_memory, memory);
+        if(num_streamed < 0)
+            return -1;
+        num_records = num_records + num_streamed;
+    }
+
+    capture->stop();
+    num_streamed = capture->stream(write_memory, memory);
+    if(num_streamed < 0)
+        return -1;
+
+    return num_records + num_streamed;
+}
+
+/* Count the decoded records that match the runs */
+static uint32_t count_matching_records(LogicCaptureReader* reader)
+{
+    uint32_t num_matching = 0;
+    uint32_t values;
+    uint32_t count;
+
+    while(reader->next(&values, &count) && (num_matching < NUM_RUNS))
+    {
+        if((values != Values[num_matching]) ||
+           (count != Counts[num_matching]))
+            break;
+        num_matching = num_matching + 1;
+    }
+
+    return num_matching;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Record, encode and decode back the runs */
+static void test_round_trip(LogicCapture* logic,
+        the_hal_logic_capture_test_memory* memory)
+{
+    LogicCaptureReader Reader;
+    uint32_t values;
+    uint32_t count;
+
+    THE_HAL_TEST_CHECK(capture(logic, Values, Counts, NUM_RUNS, memory) ==
+            NUM_RUNS);
+    THE_HAL_TEST_CHECK(logic->get_overruns() == 0);
+
+    THE_HAL_TEST_CHECK(Reader.begin(memory->data, memory->size));
+    THE_HAL_TEST_CHECK(Reader.get_num_pins() == NUM_PINS);
+    THE_HAL_TEST_CHECK(Reader.get_sample_period_ns() == SAMPLE_PERIOD_NS);
+    THE_HAL_TEST_CHECK(count_matching_records(&Reader) == NUM_RUNS);
+    THE_HAL_TEST_CHECK(!Reader.next(&values, &count));
+
+    THE_HAL_TEST_CHECK(Reader.rewind());
+    THE_HAL_TEST_CHECK(Reader.next(&values, &count) &&
+            (values == Values[0]) && (count == Counts[0]));
+
+    printf("%u runs in %u bytes\n", (unsigned)(NUM_RUNS),
+            (unsigned)(memory->size));
+}
+
+/* A capture truncated inside a record (a 3 bytes varint one, after the
+ * buffers swap) ends at the last whole record */
+static void test_truncated(const the_hal_logic_capture_test_memory* memory)
+{
+    LogicCaptureReader Reader;
+    uint32_t first_runs = THE_HAL_LOGIC_CAPTURE_RECORDS;
+    uint32_t size = THE_HAL_LOGIC_CAPTURE_HEADER_SIZE;
+    uint32_t values;
+    uint32_t count;
+
+    while((first_runs < NUM_RUNS) && (Counts[first_runs] <= 16383))
+        first_runs = first_runs + 1;
+    if(!THE_HAL_TEST_CHECK(first_runs < NUM_RUNS))
+        return;
+    for(uint32_t i = 0; i < first_runs; i++)
+        size = size + 2 + ((Counts[i] > 16383) ? 3 :
+                ((Counts[i] > 127) ? 2 : 1));
+
+    THE_HAL_TEST_CHECK(!Reader.begin(memory->data,
+            THE_HAL_LOGIC_CAPTURE_HEADER_SIZE - 1));
+    for(uint32_t cut = 0; cut < (2 + 3); cut++)
+    {
+        THE_HAL_TEST_CHECK(Reader.begin(memory->data, size + cut));
+        THE_HAL_TEST_CHECK(count_matching_records(&Reader) == first_runs);
+        THE_HAL_TEST_CHECK(!Reader.next(&values, &count));
+    }
+    THE_HAL_TEST_CHECK(Reader.begin(memory->data, size + 2 + 3));
+    THE_HAL_TEST_CHECK(count_matching_records(&Reader) == first_runs + 1);
+}
+
+/* The replay drives the recorded values, one port write per record, and
+ * moves the clock the time of each run */
+static void test_replay(const the_hal_logic_capture_test_memory* memory,
+        const int8_t* pins)
+{
+    LogicCaptureReader Reader;
+    the_hal_logic_capture_test_watcher watcher;
+    uint64_t start_ns;
+    uint32_t wrong_values = 0;
+    uint32_t wrong_times = 0;
+    uint32_t i = 0;
+
+    HostSim::reset();
+    watcher.num_callbacks = 0;
+    watcher.device.setup(on_replay_edge, nullptr, &watcher);
+    THE_HAL_TEST_CHECK(HostSimDevices::attach(&watcher.device));
+    for(uint8_t pin = 0; pin < NUM_PINS; pin++)
+        HostSimDevices::watch_pin(&watcher.device, pins[pin]);
+
+    THE_HAL_TEST_CHECK(Reader.begin(memory->data, memory->size));
+    start_ns = HostSim::get_time_ns();
+    while(Reader.replay_next(pins) && (i < NUM_RUNS))
+    {
+        if((HostSim::read_port(0) & PINS_MASK) != Values[i])
+            wrong_values = wrong_values + 1;
+        start_ns = start_ns + ((uint64_t)(Counts[i]) * SAMPLE_PERIOD_NS);
+        if(HostSim::get_time_ns() != start_ns)
+            wrong_times = wrong_times + 1;
+        i = i + 1;
+    }
+
+    THE_HAL_TEST_CHECK(i == NUM_RUNS);
+    THE_HAL_TEST_CHECK((wrong_values == 0) && (wrong_times == 0));
+    THE_HAL_TEST_CHECK(watcher.num_callbacks == NUM_RUNS);
+
+    HostSimDevices::detach(&watcher.device);
+}
+
+/* VCD of a small capture (first record dumps all the pins) */
+static void test_export_vcd(LogicCapture* logic,
+        the_hal_logic_capture_test_memory* memory)
+{
+    const uint32_t values[3] = { 0x005, 0x004, 0x006 };
+    const uint32_t counts[3] = { 2, 3, 1 };
+    const char* expected =
+        "$timescale 1 ns $end\n"
+        "$scope module thehal $end\n"
+        "$var wire 1 ! bus0 $end\n"
+        "$var wire 1 \" bus1 $end\n"
+        "$var wire 1 # bus2 $end\n"
+        "$upscope $end\n$enddefinitions $end\n"
+        "#0\n1!\n0\"\n1#\n"
+        "#2000\n0!\n"
+        "#5000\n1\"\n"
+        "#6000\n";
+    static uint8_t vcd_data[VCD_SIZE];
+    the_hal_logic_capture_test_memory vcd = { vcd_data, 0, VCD_SIZE - 1 };
+    LogicCaptureReader Reader;
+
+    THE_HAL_TEST_CHECK(capture(logic, values, counts, 3, memory) == 3);
+    THE_HAL_TEST_CHECK(Reader.begin(memory->data, memory->size));
+    THE_HAL_TEST_CHECK(Reader.export_vcd(write_memory, &vcd));
+    vcd_data[vcd.size] = '\0';
+    THE_HAL_TEST_CHECK(strcmp((const char*)(vcd_data), expected) == 0);
+
+    // A writer error is reported
+    vcd.size = 0;
+    vcd.capacity = 16;
+    THE_HAL_TEST_CHECK(!Reader.export_vcd(write_memory, &vcd));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    static const int8_t PINS[NUM_PINS] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    static uint8_t capture_data[CAPTURE_SIZE];
+    the_hal_logic_capture_test_memory memory = { capture_data, 0,
+            CAPTURE_SIZE };
+    DigitalInBus Bus(PINS, NUM_PINS);
+    LogicCapture Capture(&Bus, NUM_PINS);
+    LogicCapture SmallCapture(&Bus, 3);
+
+    HostSim::reset();
+    THE_HAL_TEST_CHECK(Bus.setup(THE_HAL_DIGITAL_IN_PULL_NONE));
+    build_runs();
+
+    test_round_trip(&Capture, &memory);
+    test_truncated(&memory);
+    test_replay(&memory, PINS);
+    test_export_vcd(&SmallCapture, &memory);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
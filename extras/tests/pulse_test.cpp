@@ -0,0 +1,194 @@
+
+/**
+ * @file    pulse_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Precise Pulse Host Test.
+ *
+ * Host builds count virtual cycles of 1 ns and the busy-waits advance the
+ * simulated ports virtual clock, so a simulated device that records the
+ * virtual time of the pin edges measures the exact cycle budget of each
+ * pulse. It checks the cycle budget (edge to edge) of busy-wait pulses of
+ * both polarities, the delays, and the tick driven long pulses.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define PIN 0
+
+/* Cycle budget computed at compile time (virtual cycles of 1 ns, edge cost
+ * cancelled out by the cycle counter) */
+static_assert(THE_HAL_PULSE_CPU_HZ == 1000000000UL, "Host CPU clock");
+static_assert(THE_HAL_PULSE_EDGE_CYCLES == 0, "Host edge cost");
+static_assert(the_hal_pulse_ns_to_cycles(250) == 250, "ns to cycles");
+static_assert(the_hal_pulse_busy_cycles(250) == 250, "Busy cycles");
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Recorded edges of the pin */
+typedef struct
+{
+    HostSimDevice device;
+    uint64_t edges_ns[2];
+    uint32_t num_edges;
+} the_hal_pulse_sim;
+
+/* Record the virtual time of the pin edges */
+static void on_pin_edge(void* arg, const uint8_t, const uint32_t,
+        const uint32_t)
+{
+    the_hal_pulse_sim* sim = (the_hal_pulse_sim*)(arg);
+
+    if(sim->num_edges < 2)
+        sim->edges_ns[sim->num_edges] = HostSim::get_time_ns();
+    sim->num_edges = sim->num_edges + 1;
+}
+
+/* Clear the recorded edges (and move the clock away from the last ones) */
+static void clear_edges(the_hal_pulse_sim* sim)
+{
+    HostSim::advance_time_ns(1000);
+    sim->num_edges = 0;
+}
+
+/* Get the width of the recorded pulse (0 if it is not a single pulse) */
+static uint64_t pulse_width_ns(const the_hal_pulse_sim* sim)
+{
+    if(sim->num_edges != 2)
+        return 0;
+    return sim->edges_ns[1] - sim->edges_ns[0];
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Busy-wait pulses last their exact cycle budget (edge to edge) */
+static void test_busy_pulses(PrecisePulse* pulse, the_hal_pulse_sim* sim,
+        const bool idle_level)
+{
+    clear_edges(sim);
+    THE_HAL_TEST_CHECK(pulse->pulse_ns<250>());
+    THE_HAL_TEST_CHECK(pulse_width_ns(sim) == 250);
+    THE_HAL_TEST_CHECK(HostSim::read_pin(PIN) == idle_level);
+
+    clear_edges(sim);
+    THE_HAL_TEST_CHECK(pulse->pulse_cycles<1>());
+    THE_HAL_TEST_CHECK(pulse_width_ns(sim) == 1);
+
+    clear_edges(sim);
+    THE_HAL_TEST_CHECK(pulse->pulse_cycles<THE_HAL_PULSE_MAX_BUSY_CYCLES>());
+    THE_HAL_TEST_CHECK(pulse_width_ns(sim) == THE_HAL_PULSE_MAX_BUSY_CYCLES);
+    THE_HAL_TEST_CHECK(HostSim::read_pin(PIN) == idle_level);
+}
+
+/* Delays advance the clock by their exact budget */
+static void test_delays(void)
+{
+    uint64_t start_ns = HostSim::get_time_ns();
+
+    PreciseDelay::delay_ns<500>();
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() - start_ns == 500);
+    PreciseDelay::delay_cycles<0>();
+    PreciseDelay::delay_cycles<7>();
+    THE_HAL_TEST_CHECK(HostSim::get_time_ns() - start_ns == 507);
+}
+
+/* Long pulses end at their last tick, busy pulses wait for them */
+static void test_long_pulse(PrecisePulse* pulse, the_hal_pulse_sim* sim)
+{
+    clear_edges(sim);
+    THE_HAL_TEST_CHECK(!pulse->start(0));
+    THE_HAL_TEST_CHECK(pulse->start(5));
+    THE_HAL_TEST_CHECK(pulse->is_active() && !pulse->start(5));
+    THE_HAL_TEST_CHECK(!pulse->pulse_ns<250>());
+    THE_HAL_TEST_CHECK(pulse->measure_edge_cycles() == -1);
+
+    for(uint8_t i = 0; i < 4; i++)
+    {
+        pulse->tick();
+        HostSim::advance_time_ns(1000);
+    }
+    THE_HAL_TEST_CHECK(pulse->is_active() && (sim->num_edges == 1));
+    pulse->tick();
+    THE_HAL_TEST_CHECK(!pulse->is_active() && (sim->num_edges == 2));
+    THE_HAL_TEST_CHECK(pulse_width_ns(sim) == 4000);
+
+    // Ticks without a pulse do nothing
+    pulse->tick();
+    THE_HAL_TEST_CHECK(sim->num_edges == 2);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    DigitalOut Pin(PIN);
+    PrecisePulse Pulse(&Pin);
+    the_hal_pulse_sim sim;
+
+    HostSim::reset();
+    sim.num_edges = 0;
+    sim.device.setup(on_pin_edge, nullptr, &sim);
+    HostSimDevices::attach(&sim.device);
+    HostSimDevices::watch_pin(&sim.device, PIN);
+
+    THE_HAL_TEST_CHECK(!Pulse.pulse_ns<250>());
+    THE_HAL_TEST_CHECK(!Pulse.setup(2));
+    THE_HAL_TEST_CHECK(Pulse.setup(0));
+
+    // The virtual clock does not move on a toggle()
+    clear_edges(&sim);
+    THE_HAL_TEST_CHECK(Pulse.measure_edge_cycles() == 0);
+    THE_HAL_TEST_CHECK((sim.num_edges == 2) && !HostSim::read_pin(PIN));
+
+    test_busy_pulses(&Pulse, &sim, false);
+    THE_HAL_TEST_CHECK(Pulse.setup(1));
+    test_busy_pulses(&Pulse, &sim, true);
+    test_delays();
+    test_long_pulse(&Pulse, &sim);
+
+    HostSimDevices::detach(&sim.device);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,292 @@
+
+/**
+ * @file    stepper_test.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Stepper Motors Host Test.
+ *
+ * tick() is called as the timer interrupt would do and a simulated driver
+ * records the tick of each STEP pin edge and the DIR level at the first
+ * step of each axis. The pulses timeline is
+ * checked against the requested move: steps of each axis, DIR level before
+ * the first step, 1 tick wide pulses, cruise speed limit, the duration of
+ * the trapezoidal profile, and the slave axis stepping with the master.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "thehal.h"
+#include "components/host_sim_controller/host_sim.h"
+#include "components/host_sim_controller/host_sim_device.h"
+
+#include "thehal_test.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Bus layout: STEP pins of the 2 axes, then their DIR pins */
+#define NUM_AXES 2
+#define PIN_X_STEP 0
+#define PIN_Y_STEP 1
+#define PIN_X_DIR 2
+#define PIN_Y_DIR 3
+
+/* Profile (cruise is a step every 5 ticks, ramps take 1000 ticks and 100
+ * steps each) */
+#define TICK_HZ 10000
+#define MAX_SPEED 2000
+#define ACCELERATION 20000
+#define CRUISE_TICKS (TICK_HZ / MAX_SPEED)
+
+/* Maximum recorded pulses of each axis */
+#define MAX_PULSES 1024
+
+/* Ticks limit of a move */
+#define MAX_TICKS 100000
+
+/*****************************************************************************/
+
+/* Simulation */
+
+/* Recorded STEP pulses of an axis */
+typedef struct
+{
+    uint32_t rise_ticks[MAX_PULSES];
+    uint32_t num_rises;
+    uint32_t num_falls;
+    uint32_t wrong_widths;
+    bool dir_at_first_step;
+} the_hal_stepper_axis_timeline;
+
+/* Simulated STEP/DIR driver */
+typedef struct
+{
+    HostSimDevice device;
+    the_hal_stepper_axis_timeline axes[NUM_AXES];
+    uint32_t tick;
+} the_hal_stepper_sim;
+
+/* Record the STEP edges of each axis at the current tick */
+static void on_step_edge(void* arg, const uint8_t, const uint32_t rising,
+        const uint32_t falling)
+{
+    the_hal_stepper_sim* sim = (the_hal_stepper_sim*)(arg);
+    the_hal_stepper_axis_timeline* axis;
+
+    for(uint8_t i = 0; i < NUM_AXES; i++)
+    {
+        axis = &(sim->axes[i]);
+        if(rising & (1UL << (PIN_X_STEP + i)))
+        {
+            if(axis->num_rises == 0)
+                axis->dir_at_first_step = HostSim::read_pin(PIN_X_DIR + i);
+            if(axis->num_rises < MAX_PULSES)
+                axis->rise_ticks[axis->num_rises] = sim->tick;
+            axis->num_rises = axis->num_rises + 1;
+        }
+        if(falling & (1UL << (PIN_X_STEP + i)))
+        {
+            // Pulses are 1 tick wide
+            if((axis->num_falls >= axis->num_rises) ||
+               (axis->rise_ticks[axis->num_falls] + 1 != sim->tick))
+                axis->wrong_widths = axis->wrong_widths + 1;
+            axis->num_falls = axis->num_falls + 1;
+        }
+    }
+}
+
+/* Clear the recorded timeline and start the ticks count */
+static void clear_timeline(the_hal_stepper_sim* sim)
+{
+    for(uint8_t i = 0; i < NUM_AXES; i++)
+    {
+        sim->axes[i].num_rises = 0;
+        sim->axes[i].num_falls = 0;
+        sim->axes[i].wrong_widths = 0;
+        sim->axes[i].dir_at_first_step = false;
+    }
+    sim->tick = 0;
+}
+
+/* Call tick() until the started move ends, returns the ticks taken */
+static uint32_t run(Stepper* stepper, the_hal_stepper_sim* sim)
+{
+    while(stepper->is_running() && (sim->tick < MAX_TICKS))
+    {
+        stepper->tick();
+        sim->tick = sim->tick + 1;
+    }
+
+    return sim->tick;
+}
+
+/* Get the minimum ticks between consecutive steps of an axis */
+static uint32_t min_step_interval(const the_hal_stepper_axis_timeline* axis)
+{
+    uint32_t min_interval = 0xffffffffUL;
+    uint32_t interval;
+
+    for(uint32_t i = 1; (i < axis->num_rises) && (i < MAX_PULSES); i++)
+    {
+        interval = axis->rise_ticks[i] - axis->rise_ticks[i - 1];
+        if(interval < min_interval)
+            min_interval = interval;
+    }
+
+    return min_interval;
+}
+
+/* Check if each step of an axis happens in a tick with a master step */
+static bool steps_with_master(const the_hal_stepper_axis_timeline* axis,
+        const the_hal_stepper_axis_timeline* master)
+{
+    uint32_t j = 0;
+
+    for(uint32_t i = 0; (i < axis->num_rises) && (i < MAX_PULSES); i++)
+    {
+        while((j < master->num_rises) &&
+              (master->rise_ticks[j] < axis->rise_ticks[i]))
+            j = j + 1;
+        if((j >= master->num_rises) ||
+           (master->rise_ticks[j] != axis->rise_ticks[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/* Setters reject a zero tick frequency instead of dividing by it */
+static void test_zero_tick_hz(DigitalOutBus* bus)
+{
+    Stepper stepper(bus, NUM_AXES, 0);
+
+    THE_HAL_TEST_CHECK(!stepper.set_max_speed(MAX_SPEED));
+    THE_HAL_TEST_CHECK(!stepper.set_acceleration(ACCELERATION));
+    THE_HAL_TEST_CHECK(!stepper.set_jerk(0));
+    THE_HAL_TEST_CHECK(!stepper.setup());
+}
+
+/* Trapezoidal move of both axes in opposite directions */
+static void test_trapezoidal(Stepper* stepper, the_hal_stepper_sim* sim)
+{
+    const int32_t steps[NUM_AXES] = { 400, -150 };
+    the_hal_stepper_axis_timeline* x = &(sim->axes[0]);
+    the_hal_stepper_axis_timeline* y = &(sim->axes[1]);
+    uint32_t ticks;
+
+    clear_timeline(sim);
+    THE_HAL_TEST_CHECK(stepper->move(steps));
+    ticks = run(stepper, sim);
+
+    THE_HAL_TEST_CHECK(x->num_rises == 400);
+    THE_HAL_TEST_CHECK(y->num_rises == 150);
+    THE_HAL_TEST_CHECK((x->num_falls == 400) && (y->num_falls == 150));
+    THE_HAL_TEST_CHECK((x->wrong_widths == 0) && (y->wrong_widths == 0));
+    THE_HAL_TEST_CHECK(!x->dir_at_first_step && y->dir_at_first_step);
+    THE_HAL_TEST_CHECK(stepper->get_position(0) == 400);
+    THE_HAL_TEST_CHECK(stepper->get_position(1) == -150);
+
+    // Cruise speed is never exceeded, ramps are slower than cruise
+    THE_HAL_TEST_CHECK(min_step_interval(x) >= CRUISE_TICKS);
+    THE_HAL_TEST_CHECK((x->rise_ticks[1] - x->rise_ticks[0]) >
+            (2 * CRUISE_TICKS));
+    THE_HAL_TEST_CHECK((x->rise_ticks[399] - x->rise_ticks[398]) >
+            (2 * CRUISE_TICKS));
+
+    // 100 steps ramps of 1000 ticks and 200 steps at cruise speed
+    THE_HAL_TEST_CHECK((ticks > 2850) && (ticks < 3150));
+    THE_HAL_TEST_CHECK(steps_with_master(y, x));
+
+    printf("Trapezoidal move: %lu ticks (%lu expected)\n",
+            (unsigned long)(ticks), (unsigned long)(3000));
+}
+
+/* Move back with S-curve ramps */
+static void test_s_curve(Stepper* stepper, the_hal_stepper_sim* sim)
+{
+    const int32_t positions[NUM_AXES] = { 0, 0 };
+    the_hal_stepper_axis_timeline* x = &(sim->axes[0]);
+    the_hal_stepper_axis_timeline* y = &(sim->axes[1]);
+    uint32_t ticks;
+
+    clear_timeline(sim);
+    THE_HAL_TEST_CHECK(stepper->set_jerk(200000));
+    THE_HAL_TEST_CHECK(stepper->move_to(positions));
+    ticks = run(stepper, sim);
+
+    THE_HAL_TEST_CHECK((x->num_rises == 400) && (y->num_rises == 150));
+    THE_HAL_TEST_CHECK((x->wrong_widths == 0) && (y->wrong_widths == 0));
+    THE_HAL_TEST_CHECK(x->dir_at_first_step && !y->dir_at_first_step);
+    THE_HAL_TEST_CHECK(min_step_interval(x) >= CRUISE_TICKS);
+    THE_HAL_TEST_CHECK(steps_with_master(y, x));
+    THE_HAL_TEST_CHECK((stepper->get_position(0) == 0) &&
+            (stepper->get_position(1) == 0));
+
+    // Limited jerk makes the ramps longer than the trapezoidal ones
+    THE_HAL_TEST_CHECK((ticks > 3000) && (ticks < MAX_TICKS));
+
+    printf("S-curve move: %lu ticks\n", (unsigned long)(ticks));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(void)
+{
+    const int8_t pins[2 * NUM_AXES] = { PIN_X_STEP, PIN_Y_STEP, PIN_X_DIR,
+            PIN_Y_DIR };
+    DigitalOutBus Motors(pins, 2 * NUM_AXES);
+    Stepper Axes(&Motors, NUM_AXES, TICK_HZ);
+    the_hal_stepper_sim sim;
+
+    HostSim::reset();
+    sim.tick = 0;
+    sim.device.setup(on_step_edge, nullptr, &sim);
+    HostSimDevices::attach(&sim.device);
+    HostSimDevices::watch_pin(&sim.device, PIN_X_STEP);
+    HostSimDevices::watch_pin(&sim.device, PIN_Y_STEP);
+
+    test_zero_tick_hz(&Motors);
+
+    THE_HAL_TEST_CHECK(Axes.setup());
+    THE_HAL_TEST_CHECK(Axes.set_max_speed(MAX_SPEED));
+    THE_HAL_TEST_CHECK(Axes.set_acceleration(ACCELERATION));
+    test_trapezoidal(&Axes, &sim);
+    test_s_curve(&Axes, &sim);
+
+    HostSimDevices::detach(&sim.device);
+
+    return the_hal_test_result();
+}
+
+/*****************************************************************************/
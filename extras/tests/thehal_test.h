@@ -0,0 +1,107 @@
+
+/**
+ * @file    thehal_test.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Tests Helpers (checks that report failures without stopping the
+ * test, and a wall clock for benchmarks).
+ *
+ *   THE_HAL_TEST_CHECK(Encoder.get_position() == 4);
+ *   ...
+ *   return the_hal_test_result();
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_TEST_H_
+#define THE_HAL_TEST_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+/*****************************************************************************/
+
+/* Ease Macros */
+
+/* Check a condition, reporting it if it fails (the test goes on) */
+#define THE_HAL_TEST_CHECK(condition) \
+    the_hal_test_check((condition), #condition, __FILE__, __LINE__)
+
+/*****************************************************************************/
+
+/* Functions */
+
+/* Number of failed checks of the test program */
+static inline uint32_t* the_hal_test_failures(void)
+{
+    static uint32_t failures = 0;
+    return &failures;
+}
+
+/* Count and report a failed check */
+static inline bool the_hal_test_check(const bool passed,
+        const char* condition, const char* file, const int line)
+{
+    if(!passed)
+    {
+        printf("%s:%d: check failed: %s\n", file, line, condition);
+        *the_hal_test_failures() = *the_hal_test_failures() + 1;
+    }
+    return passed;
+}
+
+/* Get the test program exit status (0 if all the checks passed) */
+static inline int the_hal_test_result(void)
+{
+    if(*the_hal_test_failures() != 0)
+    {
+        printf("%u checks failed\n", (unsigned)(*the_hal_test_failures()));
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
+
+/* Get the host monotonic clock time (nanoseconds) */
+static inline uint64_t the_hal_test_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_TEST_H_ */
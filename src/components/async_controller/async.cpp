@@ -0,0 +1,549 @@
+
+/**
+ * @file    async.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Coroutines Asynchronous Controller (C++20).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_ASYNC == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "async.h"
+
+#include <exception>
+
+#if defined(ARDUINO)
+    #include <Arduino.h>
+#elif defined(ESP_IDF)
+    #include <esp_timer.h>
+#elif defined(LINUX_GPIO)
+    #include <time.h>
+#elif !defined(SAM_ASF) and !defined(__AVR__)
+    #include "../host_sim_controller/host_sim.h"
+#endif
+
+/*****************************************************************************/
+
+/* Static Members */
+
+AsyncExecutor* AsyncExecutor::current = nullptr;
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Get the level that a pin waiter waits for (the edge ending level) */
+static inline bool waiter_target_level(const the_hal_async_waiter* waiter)
+{
+    if(waiter->type == THE_HAL_ASYNC_WAIT_LEVEL)
+        return waiter->level;
+    return (waiter->type == THE_HAL_ASYNC_WAIT_RISING_EDGE);
+}
+
+/*****************************************************************************/
+
+/* AsyncTask */
+
+/* Create the task object that owns a new (suspended) coroutine */
+AsyncTask AsyncTask::promise_type::get_return_object(void)
+{
+    return AsyncTask(
+            std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+/* Coroutines can't report errors to anyone, so stop right here */
+void AsyncTask::promise_type::unhandled_exception(void)
+{
+    std::terminate();
+}
+
+/* AsyncTask constructor */
+AsyncTask::AsyncTask(std::coroutine_handle<> handle)
+{
+    this->handle = handle;
+}
+
+/* AsyncTask move constructor */
+AsyncTask::AsyncTask(AsyncTask&& task)
+{
+    this->handle = task.release();
+}
+
+/* AsyncTask destructor (destroys the coroutine if it was never spawned) */
+AsyncTask::~AsyncTask()
+{
+    if(this->handle)
+        this->handle.destroy();
+}
+
+/* Give coroutine ownership to the caller */
+std::coroutine_handle<> AsyncTask::release(void)
+{
+    std::coroutine_handle<> handle = this->handle;
+    this->handle = nullptr;
+    return handle;
+}
+
+/*****************************************************************************/
+
+/* AsyncExecutor Constructor */
+
+/* AsyncExecutor constructor */
+AsyncExecutor::AsyncExecutor()
+{
+    this->ready_first = 0;
+    this->num_ready = 0;
+    this->num_waiters = 0;
+}
+
+/* AsyncExecutor destructor (destroys the coroutines that didn't end) */
+AsyncExecutor::~AsyncExecutor()
+{
+    while(this->num_ready > 0)
+        pop_ready().destroy();
+    while(this->num_waiters > 0)
+    {
+        this->num_waiters = this->num_waiters - 1;
+        this->waiters[this->num_waiters].handle.destroy();
+    }
+}
+
+/*****************************************************************************/
+
+/* AsyncExecutor Public Methods */
+
+/* Add a coroutine to be started in next run */
+bool AsyncExecutor::spawn(AsyncTask task)
+{
+    std::coroutine_handle<> handle = task.release();
+
+    if(!handle)
+        return false;
+    if(push_ready(handle))
+        return true;
+
+    handle.destroy();
+    return false;
+}
+
+/* Resume all coroutines which are ready or whose awaited event happened */
+uint16_t AsyncExecutor::run_once(void)
+{
+    AsyncExecutor* previous = current;
+    uint16_t num_resumed = 0;
+    uint8_t num_to_resume;
+
+    current = this;
+    poll_waiters(get_time_ms());
+
+    // Coroutines made ready while resuming others will run in next call
+    num_to_resume = this->num_ready;
+    while(num_to_resume > 0)
+    {
+        pop_ready().resume();
+        num_to_resume = num_to_resume - 1;
+        num_resumed = num_resumed + 1;
+    }
+    current = previous;
+
+    return num_resumed;
+}
+
+/* Check if there is no coroutine ready nor waiting */
+bool AsyncExecutor::is_idle(void)
+{
+    return ((this->num_ready == 0) && (this->num_waiters == 0));
+}
+
+/* Get earliest waiters deadline (i.e. to sleep or to advance virtual time) */
+bool AsyncExecutor::get_next_deadline(uint32_t* deadline_ms)
+{
+    bool found = false;
+    uint32_t now_ms = get_time_ms();
+
+    for(uint8_t i = 0; i < this->num_waiters; i++)
+    {
+        the_hal_async_waiter* waiter = &(this->waiters[i]);
+        if(!waiter->has_deadline)
+            continue;
+        if(found && ((int32_t)(waiter->deadline_ms - now_ms) >=
+                (int32_t)(*deadline_ms - now_ms)))
+            continue;
+        *deadline_ms = waiter->deadline_ms;
+        found = true;
+    }
+
+    return found;
+}
+
+/* Register a suspended coroutine that waits for a pin or time event */
+bool AsyncExecutor::add_waiter(const the_hal_async_waiter* waiter)
+{
+    if(this->num_waiters >= THE_HAL_ASYNC_MAX_WAITERS)
+        return false;
+
+    this->waiters[this->num_waiters] = *waiter;
+    this->num_waiters = this->num_waiters + 1;
+
+    return true;
+}
+
+/* Get the executor that is running the current coroutine */
+AsyncExecutor* AsyncExecutor::get_current(void)
+{
+    return current;
+}
+
+/* Get current time (milliseconds, virtual clock time on host) */
+uint32_t AsyncExecutor::get_time_ms(void)
+{
+#if defined(ARDUINO)
+    return (uint32_t)millis();
+#elif defined(ESP_IDF)
+    return (uint32_t)(esp_timer_get_time() / 1000);
+#elif defined(LINUX_GPIO)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec * 1000) + (now.tv_nsec / 1000000));
+#elif !defined(SAM_ASF) and !defined(__AVR__)
+    return (uint32_t)(HostSim::get_time_ns() / 1000000);
+#else
+    return 0;
+#endif
+}
+
+/*****************************************************************************/
+
+/* AsyncExecutor Private Methods */
+
+/* Add a coroutine to the ready queue */
+bool AsyncExecutor::push_ready(std::coroutine_handle<> handle)
+{
+    uint8_t last;
+
+    if(this->num_ready >= THE_HAL_ASYNC_MAX_READY)
+        return false;
+
+    last = (this->ready_first + this->num_ready) % THE_HAL_ASYNC_MAX_READY;
+    this->ready[last] = handle;
+    this->num_ready = this->num_ready + 1;
+
+    return true;
+}
+
+/* Take the oldest coroutine of the ready queue */
+std::coroutine_handle<> AsyncExecutor::pop_ready(void)
+{
+    std::coroutine_handle<> handle = this->ready[this->ready_first];
+
+    this->ready_first = (this->ready_first + 1) % THE_HAL_ASYNC_MAX_READY;
+    this->num_ready = this->num_ready - 1;
+
+    return handle;
+}
+
+/* Move to the ready queue the waiters whose event happened */
+void AsyncExecutor::poll_waiters(const uint32_t now_ms)
+{
+    uint8_t i = 0;
+
+    while(i < this->num_waiters)
+    {
+        the_hal_async_waiter* waiter = &(this->waiters[i]);
+
+        // Keep waiting if event didn't happen or there is no room to resume
+        if(!waiter_event_happened(waiter, now_ms) ||
+                !push_ready(waiter->handle))
+        {
+            i = i + 1;
+            continue;
+        }
+
+        this->num_waiters = this->num_waiters - 1;
+        this->waiters[i] = this->waiters[this->num_waiters];
+    }
+}
+
+/* Check waiter event, setting its result (false means timeout) */
+bool AsyncExecutor::waiter_event_happened(the_hal_async_waiter* waiter,
+        const uint32_t now_ms)
+{
+    bool level;
+    bool happened = false;
+
+    if(waiter->type != THE_HAL_ASYNC_WAIT_TIME)
+    {
+        level = waiter->pin->read();
+        if(waiter->type == THE_HAL_ASYNC_WAIT_LEVEL)
+            happened = (level == waiter->level);
+        else if(waiter->type == THE_HAL_ASYNC_WAIT_RISING_EDGE)
+            happened = (!waiter->level && level);
+        else
+            happened = (waiter->level && !level);
+        if(waiter->type != THE_HAL_ASYNC_WAIT_LEVEL)
+            waiter->level = level;
+
+        // An edge reported with on_edge() is not lost if the pin got back
+        // to its previous level before this sample
+        if(waiter->pin->get_edges(waiter_target_level(waiter)) !=
+                waiter->edges)
+            happened = true;
+    }
+    if(happened)
+    {
+        *(waiter->result) = true;
+        return true;
+    }
+
+    if(!waiter->has_deadline)
+        return false;
+    if((int32_t)(now_ms - waiter->deadline_ms) < 0)
+        return false;
+
+    // Sleep deadline is its event, pin waits deadline is a timeout
+    *(waiter->result) = (waiter->type == THE_HAL_ASYNC_WAIT_TIME);
+    return true;
+}
+
+/*****************************************************************************/
+
+/* AsyncPinWait */
+
+/* AsyncPinWait constructor */
+AsyncPinWait::AsyncPinWait(AsyncDigitalIn* pin, const uint8_t type,
+        const bool level, const bool has_timeout, const uint32_t timeout_ms)
+{
+    this->pin = pin;
+    this->type = type;
+    this->level = level;
+    this->has_timeout = has_timeout;
+    this->timeout_ms = timeout_ms;
+    this->result = false;
+}
+
+/* Don't suspend if the awaited level is already there */
+bool AsyncPinWait::await_ready(void)
+{
+    if(this->type != THE_HAL_ASYNC_WAIT_LEVEL)
+        return false;
+
+    this->result = (this->pin->read() == this->level);
+    return this->result;
+}
+
+/* Register the coroutine as waiter (resumes at once if it can't be done) */
+bool AsyncPinWait::await_suspend(std::coroutine_handle<> handle)
+{
+    AsyncExecutor* executor = AsyncExecutor::get_current();
+    the_hal_async_waiter waiter;
+
+    if(executor == nullptr)
+        return false;
+
+    waiter.handle = handle;
+    waiter.pin = this->pin;
+    waiter.result = &(this->result);
+    waiter.type = this->type;
+    waiter.has_deadline = this->has_timeout;
+    waiter.deadline_ms = AsyncExecutor::get_time_ms() + this->timeout_ms;
+    waiter.edges = this->pin->get_edges(this->level);
+
+    // Edges are detected against the level at the time of the co_await
+    if(this->type == THE_HAL_ASYNC_WAIT_LEVEL)
+        waiter.level = this->level;
+    else
+        waiter.level = this->pin->read();
+
+    return executor->add_waiter(&waiter);
+}
+
+/* Get wait result (true if the event happened, false if timeout) */
+bool AsyncPinWait::await_resume(void)
+{
+    return this->result;
+}
+
+/*****************************************************************************/
+
+/* AsyncSleep */
+
+/* AsyncSleep constructor */
+AsyncSleep::AsyncSleep(const uint32_t time_ms)
+{
+    this->time_ms = time_ms;
+    this->result = false;
+}
+
+/* Don't suspend for a zero time sleep */
+bool AsyncSleep::await_ready(void)
+{
+    this->result = (this->time_ms == 0);
+    return this->result;
+}
+
+/* Register the coroutine as waiter (resumes at once if it can't be done) */
+bool AsyncSleep::await_suspend(std::coroutine_handle<> handle)
+{
+    AsyncExecutor* executor = AsyncExecutor::get_current();
+    the_hal_async_waiter waiter;
+
+    if(executor == nullptr)
+        return false;
+
+    waiter.handle = handle;
+    waiter.pin = nullptr;
+    waiter.result = &(this->result);
+    waiter.type = THE_HAL_ASYNC_WAIT_TIME;
+    waiter.level = false;
+    waiter.has_deadline = true;
+    waiter.deadline_ms = AsyncExecutor::get_time_ms() + this->time_ms;
+
+    return executor->add_waiter(&waiter);
+}
+
+/* Get sleep result (false if the executor had no room for the waiter) */
+bool AsyncSleep::await_resume(void)
+{
+    return this->result;
+}
+
+/* Create an awaitable that suspends the coroutine the provided time */
+AsyncSleep sleep_for(const uint32_t time_ms)
+{
+    return AsyncSleep(time_ms);
+}
+
+/*****************************************************************************/
+
+/* AsyncDigitalIn */
+
+/* AsyncDigitalIn constructor */
+AsyncDigitalIn::AsyncDigitalIn(DigitalIn* pin)
+{
+    this->pin = pin;
+    this->rising_edges = 0;
+    this->falling_edges = 0;
+}
+
+/* AsyncDigitalIn destructor */
+AsyncDigitalIn::~AsyncDigitalIn()
+{}
+
+/* Wait for a low to high transition */
+AsyncPinWait AsyncDigitalIn::rising_edge(void)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_RISING_EDGE, true,
+            false, 0);
+}
+
+/* Wait for a low to high transition or timeout */
+AsyncPinWait AsyncDigitalIn::rising_edge(const uint32_t timeout_ms)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_RISING_EDGE, true,
+            true, timeout_ms);
+}
+
+/* Wait for a high to low transition */
+AsyncPinWait AsyncDigitalIn::falling_edge(void)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_FALLING_EDGE, false,
+            false, 0);
+}
+
+/* Wait for a high to low transition or timeout */
+AsyncPinWait AsyncDigitalIn::falling_edge(const uint32_t timeout_ms)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_FALLING_EDGE, false,
+            true, timeout_ms);
+}
+
+/* Wait until the pin has the provided level */
+AsyncPinWait AsyncDigitalIn::level(const bool value)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_LEVEL, value,
+            false, 0);
+}
+
+/* Wait until the pin has the provided level or timeout */
+AsyncPinWait AsyncDigitalIn::level(const bool value,
+        const uint32_t timeout_ms)
+{
+    return AsyncPinWait(this, THE_HAL_ASYNC_WAIT_LEVEL, value,
+            true, timeout_ms);
+}
+
+/* Get the current pin level */
+bool AsyncDigitalIn::read(void)
+{
+    return this->pin->read();
+}
+
+/* Report a pin edge from its interrupt (or events reader thread), waiters
+ * of the edge are resumed even if the pin gets back to its previous level
+ * before the next run_once() (only one context may report the edges) */
+void AsyncDigitalIn::on_edge(const bool level)
+{
+    volatile uint8_t* edges = (level) ? &this->rising_edges :
+            &this->falling_edges;
+
+#if defined(__AVR__)
+    *edges = *edges + 1;
+#else
+    __atomic_store_n(edges, (uint8_t)(*edges + 1), __ATOMIC_RELEASE);
+#endif
+}
+
+/* Get the number of reported edges to a level (free running counter) */
+uint8_t AsyncDigitalIn::get_edges(const bool level)
+{
+    volatile uint8_t* edges = (level) ? &this->rising_edges :
+            &this->falling_edges;
+
+#if defined(__AVR__)
+    return *edges;
+#else
+    return __atomic_load_n(edges, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_ASYNC == 1 */
+
+/*****************************************************************************/
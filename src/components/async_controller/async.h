@@ -0,0 +1,253 @@
+
+/**
+ * @file    async.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Coroutines Asynchronous Controller (C++20).
+ *
+ * Lets firmware logic wait for pin edges, pin levels and time without busy
+ * waiting, so a single core can serve many concurrent state machines:
+ *
+ *   AsyncTask blink_on_press(AsyncDigitalIn* button, DigitalOut* led)
+ *   {
+ *       while(true)
+ *       {
+ *           co_await button->rising_edge();
+ *           led->set_high();
+ *           co_await sleep_for(100);
+ *           led->set_low();
+ *       }
+ *   }
+ *
+ *   MyExecutor.spawn(blink_on_press(&MyButton, &MyLed));
+ *   while(true)
+ *       MyExecutor.run_once();
+ *
+ * Pins are sampled once in each run_once(), so a pulse shorter than the
+ * time between two calls can be missed. Where the pin edges are reported
+ * by an interrupt (i.e. a PcintDispatcher handler on AVR, or the events of
+ * a Linux DigitalInBus setup_events()), that handler should call
+ * AsyncDigitalIn::on_edge() so no edge is lost.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_ASYNC == 1
+
+/* Include Guard */
+#ifndef THE_HAL_ASYNC_H_
+#define THE_HAL_ASYNC_H_
+
+#if !defined(__cpp_impl_coroutine)
+    #error "TheHal Async Controller requires C++20 coroutines support"
+#endif
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of coroutines ready to be resumed in each executor */
+#define THE_HAL_ASYNC_MAX_READY 16
+
+/* Maximum number of coroutines waiting for a pin or time in each executor */
+#define THE_HAL_ASYNC_MAX_WAITERS 16
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <coroutine>
+
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_ASYNC_WAIT_TIME = 0,
+    THE_HAL_ASYNC_WAIT_RISING_EDGE = 1,
+    THE_HAL_ASYNC_WAIT_FALLING_EDGE = 2,
+    THE_HAL_ASYNC_WAIT_LEVEL = 3
+} the_hal_async_wait_type;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+class AsyncDigitalIn;
+
+typedef struct
+{
+    std::coroutine_handle<> handle;
+    AsyncDigitalIn* pin;
+    bool* result;
+    uint32_t deadline_ms;
+    uint8_t type;
+    uint8_t edges;
+    bool level;
+    bool has_deadline;
+} the_hal_async_waiter;
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Coroutine return type, the coroutine starts when spawned in an executor */
+class AsyncTask
+{
+    public:
+        struct promise_type
+        {
+            AsyncTask get_return_object(void);
+            std::suspend_always initial_suspend(void) noexcept
+            { return {}; }
+            std::suspend_never final_suspend(void) noexcept
+            { return {}; }
+            void return_void(void) {}
+            void unhandled_exception(void);
+        };
+
+        explicit AsyncTask(std::coroutine_handle<> handle);
+        AsyncTask(AsyncTask&& task);
+        AsyncTask(const AsyncTask&) = delete;
+        ~AsyncTask();
+
+        std::coroutine_handle<> release(void);
+
+    private:
+        std::coroutine_handle<> handle;
+};
+
+/* Single threaded executor that resumes coroutines on pin and time events */
+class AsyncExecutor
+{
+    public:
+        AsyncExecutor();
+        ~AsyncExecutor();
+
+        bool spawn(AsyncTask task);
+        uint16_t run_once(void);
+        bool is_idle(void);
+        bool get_next_deadline(uint32_t* deadline_ms);
+
+        bool add_waiter(const the_hal_async_waiter* waiter);
+
+        static AsyncExecutor* get_current(void);
+        static uint32_t get_time_ms(void);
+
+    private:
+        std::coroutine_handle<> ready[THE_HAL_ASYNC_MAX_READY];
+        uint8_t ready_first;
+        uint8_t num_ready;
+        the_hal_async_waiter waiters[THE_HAL_ASYNC_MAX_WAITERS];
+        uint8_t num_waiters;
+
+        static AsyncExecutor* current;
+
+        bool push_ready(std::coroutine_handle<> handle);
+        std::coroutine_handle<> pop_ready(void);
+        void poll_waiters(const uint32_t now_ms);
+        bool waiter_event_happened(the_hal_async_waiter* waiter,
+                const uint32_t now_ms);
+};
+
+/* Awaitable for a pin event, resumes with false if timeout expired */
+class AsyncPinWait
+{
+    public:
+        AsyncPinWait(AsyncDigitalIn* pin, const uint8_t type,
+                const bool level, const bool has_timeout,
+                const uint32_t timeout_ms);
+
+        bool await_ready(void);
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume(void);
+
+    private:
+        AsyncDigitalIn* pin;
+        uint32_t timeout_ms;
+        uint8_t type;
+        bool level;
+        bool has_timeout;
+        bool result;
+};
+
+/* Awaitable for a time delay, resumes with false if it can't be waited */
+class AsyncSleep
+{
+    public:
+        AsyncSleep(const uint32_t time_ms);
+
+        bool await_ready(void);
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume(void);
+
+    private:
+        uint32_t time_ms;
+        bool result;
+};
+
+/* Digital input wrapper that provides the pin awaitables */
+class AsyncDigitalIn
+{
+    public:
+        AsyncDigitalIn(DigitalIn* pin);
+        ~AsyncDigitalIn();
+
+        AsyncPinWait rising_edge(void);
+        AsyncPinWait rising_edge(const uint32_t timeout_ms);
+        AsyncPinWait falling_edge(void);
+        AsyncPinWait falling_edge(const uint32_t timeout_ms);
+        AsyncPinWait level(const bool value);
+        AsyncPinWait level(const bool value, const uint32_t timeout_ms);
+
+        bool read(void);
+        void on_edge(const bool level);
+        uint8_t get_edges(const bool level);
+
+    private:
+        DigitalIn* pin;
+        volatile uint8_t rising_edges;
+        volatile uint8_t falling_edges;
+};
+
+/*****************************************************************************/
+
+/* Functions */
+
+AsyncSleep sleep_for(const uint32_t time_ms);
+
+/*****************************************************************************/
+
+#endif // THE_HAL_ASYNC_H_
+#endif // THE_HAL_COMPONENT_ASYNC
@@ -0,0 +1,229 @@
+
+/**
+ * @file    dds.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Direct Digital Synthesis Square Wave Generator (several independent
+ * frequency outputs driven from a timer interrupt).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_DDS == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "dds.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    OUTPUT_BIT = 31,
+    MILLIHZ_PER_HZ = 1000
+} the_hal_dds_constants;
+
+/* First tuning word over the Nyquist frequency (tick_hz / 2) */
+static const uint32_t MAX_TUNING_WORD = 0x80000000UL;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* Dds constructor */
+Dds::Dds(DigitalOutBus* bus, const uint8_t num_channels,
+        const uint32_t tick_hz)
+{
+    this->bus = bus;
+    this->num_channels = num_channels;
+    this->tick_hz = tick_hz;
+    this->sync_requested = false;
+    this->initialized = false;
+    for(uint8_t i = 0; i < THE_HAL_DDS_MAX_CHANNELS; i++)
+    {
+        this->phases[i] = 0;
+        this->words[i] = 0;
+    }
+}
+
+/* Dds destructor */
+Dds::~Dds()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize the bus with all channels outputs low */
+bool Dds::setup(void)
+{
+    if((this->bus == nullptr) || (this->tick_hz == 0))
+        return false;
+    if((this->num_channels == 0) ||
+       (this->num_channels > THE_HAL_DDS_MAX_CHANNELS))
+        return false;
+
+    if(!this->bus->setup(0))
+        return false;
+
+    this->initialized = true;
+    return true;
+}
+
+/* Set frequency of a channel in thousandths of Hz (0 holds the output) */
+bool Dds::set_frequency(const uint8_t channel,
+        const uint32_t frequency_millihz)
+{
+    uint64_t divisor = (uint64_t)this->tick_hz * MILLIHZ_PER_HZ;
+    uint64_t word;
+
+    if(this->tick_hz == 0)
+        return false;
+
+    // Rounded to the nearest tuning word
+    word = (((uint64_t)frequency_millihz << 32) + (divisor / 2)) / divisor;
+    if(word >= MAX_TUNING_WORD)
+        return false;
+
+    return set_tuning_word(channel, (uint32_t)word);
+}
+
+/* Get frequency of a channel in thousandths of Hz (rounded) */
+uint32_t Dds::get_frequency(const uint8_t channel)
+{
+    uint64_t scaled = (uint64_t)get_tuning_word(channel) * this->tick_hz;
+    uint32_t hz = (uint32_t)(scaled >> 32);
+    uint32_t millihz = (uint32_t)((((scaled & 0xffffffffULL) *
+            MILLIHZ_PER_HZ) + 0x80000000ULL) >> 32);
+
+    return (hz * MILLIHZ_PER_HZ) + millihz;
+}
+
+/* Set phase increment per tick of a channel (frequency resolution step) */
+bool Dds::set_tuning_word(const uint8_t channel, const uint32_t word)
+{
+    if((channel >= this->num_channels) || (word >= MAX_TUNING_WORD))
+        return false;
+
+    // Phase is not touched, the wave continues from where it is
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    this->words[channel] = word;
+    SREG = sreg;
+#else
+    __atomic_store_n(&this->words[channel], word, __ATOMIC_RELAXED);
+#endif
+
+    return true;
+}
+
+/* Get phase increment per tick of a channel */
+uint32_t Dds::get_tuning_word(const uint8_t channel)
+{
+    uint32_t word;
+
+    if(channel >= this->num_channels)
+        return 0;
+
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    word = this->words[channel];
+    SREG = sreg;
+#else
+    word = __atomic_load_n(&this->words[channel], __ATOMIC_RELAXED);
+#endif
+
+    return word;
+}
+
+/* Restart all channels phases at the same time on next tick (i.e. to align
+ * clocks that are multiples of each other) */
+void Dds::sync(void)
+{
+#if defined(__AVR__)
+    this->sync_requested = true;
+#else
+    __atomic_store_n(&this->sync_requested, true, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Advance all phase accumulators and write all outputs (to be called from
+ * a fixed rate timer interrupt) */
+void Dds::tick(void)
+{
+    uint32_t values = 0;
+    bool sync;
+
+    if(!this->initialized)
+        return;
+
+#if defined(__AVR__)
+    sync = this->sync_requested;
+    this->sync_requested = false;
+#else
+    sync = __atomic_exchange_n(&this->sync_requested, false,
+            __ATOMIC_ACQUIRE);
+#endif
+
+    for(uint8_t i = 0; i < this->num_channels; i++)
+    {
+        if(sync)
+            this->phases[i] = 0;
+#if defined(__AVR__)
+        this->phases[i] = this->phases[i] + this->words[i];
+#else
+        this->phases[i] = this->phases[i] +
+                __atomic_load_n(&this->words[i], __ATOMIC_RELAXED);
+#endif
+        values = values | ((this->phases[i] >> OUTPUT_BIT) << i);
+    }
+
+    this->bus->write(values);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_DDS == 1 */
+
+/*****************************************************************************/
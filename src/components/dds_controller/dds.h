@@ -0,0 +1,109 @@
+
+/**
+ * @file    dds.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Direct Digital Synthesis Square Wave Generator (several independent
+ * frequency outputs driven from a timer interrupt).
+ *
+ * Each channel has a 32 bits phase accumulator that is increased by its
+ * tuning word every tick, and the channel output is the accumulator most
+ * significant bit:
+ *
+ *   frequency = tuning_word * tick_hz / 2^32
+ *
+ * So the frequency resolution is tick_hz / 2^32 (i.e. 4.7 uHz at 20 kHz)
+ * and the maximum frequency is tick_hz / 2. The output bits of all the
+ * channels are gathered in a single DigitalOutBus write (channel N is bus
+ * bit N), and tick() always does the same work, so its interrupt cost does
+ * not depend on the frequencies.
+ *
+ * Retuning only changes the tuning word: the phase is kept, so the current
+ * half period just finishes at the new rate (no glitches nor truncated
+ * pulses).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_DDS == 1
+
+/* Include Guard */
+#ifndef THE_HAL_DDS_H_
+#define THE_HAL_DDS_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of output channels */
+#define THE_HAL_DDS_MAX_CHANNELS 8
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Class */
+
+class Dds
+{
+    public:
+        Dds(DigitalOutBus* bus, const uint8_t num_channels,
+                const uint32_t tick_hz);
+        ~Dds();
+
+        bool setup(void);
+        bool set_frequency(const uint8_t channel,
+                const uint32_t frequency_millihz);
+        uint32_t get_frequency(const uint8_t channel);
+        bool set_tuning_word(const uint8_t channel, const uint32_t word);
+        uint32_t get_tuning_word(const uint8_t channel);
+        void sync(void);
+
+        void tick(void);
+
+    private:
+        DigitalOutBus* bus;
+        uint32_t phases[THE_HAL_DDS_MAX_CHANNELS];
+        volatile uint32_t words[THE_HAL_DDS_MAX_CHANNELS];
+        uint32_t tick_hz;
+        uint8_t num_channels;
+        volatile bool sync_requested;
+        bool initialized;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_DDS_H_
+#endif // THE_HAL_COMPONENT_DDS
@@ -0,0 +1,51 @@
+// Requires THE_HAL_COMPONENT_DDS enabled in thehal.h
+// Generates 3 independent square waves at 20 kHz ticks (AVR Timer1): a
+// 440 Hz tone, a 1000.5 Hz clock and a 0.25 Hz blink. Pins 2 to 4 are all
+// in PORTD of an Uno, so each tick is a single port write
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_CHANNELS 3
+
+#define TICK_HZ 20000
+
+/*****************************************************************************/
+
+const int8_t DDS_PINS[NUM_CHANNELS] = { 2, 3, 4 };
+
+DigitalOutBus MyBus(DDS_PINS, NUM_CHANNELS);
+Dds MyDds(&MyBus, NUM_CHANNELS, TICK_HZ);
+
+/*****************************************************************************/
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyDds.tick();
+}
+
+void setup()
+{
+    MyDds.setup();
+    MyDds.set_frequency(0, 440000);
+    MyDds.set_frequency(1, 1000500);
+    MyDds.set_frequency(2, 250);
+
+    // Timer1 CTC mode, prescaler 8, 20 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / TICK_HZ) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    // Sweep the tone between 440 Hz and 880 Hz without glitches
+    static uint32_t tone_millihz = 440000;
+
+    tone_millihz = tone_millihz + 1000;
+    if(tone_millihz > 880000)
+        tone_millihz = 440000;
+    MyDds.set_frequency(0, tone_millihz);
+    delay(10);
+}
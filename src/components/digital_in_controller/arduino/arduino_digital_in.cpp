@@ -0,0 +1,224 @@
+
+/**
+ * @file    arduino_digital_in.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Input Controller for Arduino devices.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(ARDUINO)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_ARDUINO_DIGITAL_IN_CPP_
+#define THE_HAL_ARDUINO_DIGITAL_IN_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "arduino_digital_in.h"
+
+/*****************************************************************************/
+
+/* Static Functions Prototypes */
+
+static inline bool arduino_digital_in_configure_pin(const int8_t io_pin,
+        const uint8_t pull_resistor_mode);
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalIn constructor */
+THE_HAL_INLINE DigitalIn::DigitalIn(const int8_t io_pin)
+{
+    this->io_pin = io_pin;
+    this->initialized = false;
+}
+
+/* DigitalIn destructor */
+THE_HAL_INLINE DigitalIn::~DigitalIn()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize GPIO as digital input and set internal pull resistor */
+THE_HAL_INLINE bool DigitalIn::setup(const uint8_t pull_resistor_mode)
+{
+    this->initialized = arduino_digital_in_configure_pin(this->io_pin,
+            pull_resistor_mode);
+    return this->initialized;
+}
+
+/* Get GPIO digital input logical value */
+THE_HAL_INLINE bool DigitalIn::read(void)
+{
+    if(!this->initialized)
+        return false;
+
+    return (digitalRead((uint8_t)this->io_pin) == HIGH);
+}
+
+/*****************************************************************************/
+
+/* DigitalInBus Constructor */
+
+/* DigitalInBus constructor */
+THE_HAL_INLINE DigitalInBus::DigitalInBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->num_ports = 0;
+    if(num_pins > THE_HAL_DIGITAL_IN_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+        this->io_pins[i] = io_pins[i];
+    this->num_pins = num_pins;
+}
+
+/* DigitalInBus destructor */
+THE_HAL_INLINE DigitalInBus::~DigitalInBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalInBus Public Methods */
+
+/* Initialize all bus GPIOs as digital inputs and resolve their ports */
+THE_HAL_INLINE bool DigitalInBus::setup(const uint8_t pull_resistor_mode)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    this->num_ports = 0;
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(!arduino_digital_in_configure_pin(this->io_pins[i],
+                pull_resistor_mode))
+            return false;
+        if(!map_pin_to_port(i))
+            return false;
+    }
+
+    return true;
+}
+
+/* Get all bus GPIOs values from a single snapshot of the ports */
+THE_HAL_INLINE uint32_t DigitalInBus::read(void)
+{
+    the_hal_port_t snapshot[THE_HAL_DIGITAL_IN_BUS_MAX_PORTS];
+    uint32_t value = 0;
+
+    // Read all ports back to back before decoding any bit
+    for(uint8_t port = 0; port < this->num_ports; port++)
+        snapshot[port] = *(this->port_regs[port]);
+
+    // Bit N of the bus value is the level of the Nth GPIO of the bus
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(snapshot[this->pin_ports[i]] & this->pin_masks[i])
+            value = value | (1UL << i);
+    }
+
+    return value;
+}
+
+/*****************************************************************************/
+
+/* DigitalInBus Private Methods */
+
+/* Get GPIO input register and mask, sharing the register between pins */
+THE_HAL_INLINE bool DigitalInBus::map_pin_to_port(const uint8_t pin_index)
+{
+    uint8_t io_pin = (uint8_t)this->io_pins[pin_index];
+    volatile the_hal_port_t* port_reg = (volatile the_hal_port_t*)
+            portInputRegister(digitalPinToPort(io_pin));
+
+    this->pin_masks[pin_index] = (the_hal_port_t)digitalPinToBitMask(io_pin);
+    for(uint8_t port = 0; port < this->num_ports; port++)
+    {
+        if(this->port_regs[port] == port_reg)
+        {
+            this->pin_ports[pin_index] = port;
+            return true;
+        }
+    }
+
+    if(this->num_ports >= THE_HAL_DIGITAL_IN_BUS_MAX_PORTS)
+        return false;
+
+    this->port_regs[this->num_ports] = port_reg;
+    this->pin_ports[pin_index] = this->num_ports;
+    this->num_ports = this->num_ports + 1;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Static Functions */
+
+/* Configure a GPIO as digital input with the requested pull resistor */
+static inline bool arduino_digital_in_configure_pin(const int8_t io_pin,
+        const uint8_t pull_resistor_mode)
+{
+    if(io_pin < 0)
+        return false;
+
+    if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULL_NONE)
+        pinMode((uint8_t)io_pin, INPUT);
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLUP)
+        pinMode((uint8_t)io_pin, INPUT_PULLUP);
+#if defined(INPUT_PULLDOWN)
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLDOWN)
+        pinMode((uint8_t)io_pin, INPUT_PULLDOWN);
+#endif
+    else
+        return false;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_ARDUINO_DIGITAL_IN_CPP_ */
+
+#endif /* defined(ARDUINO) */
+
+/*****************************************************************************/
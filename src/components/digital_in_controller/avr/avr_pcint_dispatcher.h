@@ -0,0 +1,322 @@
+
+/**
+ * @file    avr_pcint_dispatcher.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Pin Change Interrupts (PCINT) Dispatcher for AVR devices.
+ *
+ * Pin to PCINT group resolution and handlers selection are done at compile
+ * time, so each generated ISR just reads the group port, XOR it against the
+ * last snapshot and calls the handlers of the pins that changed.
+ *
+ * The dispatcher is opt-in (THE_HAL_COMPONENT_PCINT_DISPATCHER), so other
+ * AVR devices (i.e. ATmega8 or ATtiny) can still use DigitalIn.
+ *
+ * Usage:
+ *
+ *   void on_button(const bool level) { ... }
+ *   void on_sensor(const bool level) { ... }
+ *
+ *   typedef PcintDispatcher<0,
+ *       PcintHandler<THE_HAL_PCINT_PORT_B, 0, on_button>,
+ *       PcintHandler<THE_HAL_PCINT_PORT_B, 3, on_sensor>> Pcint0;
+ *
+ *   THE_HAL_PCINT_ISR(0, Pcint0)
+ *
+ *   void setup() { Pcint0::setup(); }
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if (THE_HAL_COMPONENT_PCINT_DISPATCHER == 1) && defined(__AVR__)
+
+/* Include Guard */
+#ifndef THE_HAL_AVR_PCINT_DISPATCHER_H_
+#define THE_HAL_AVR_PCINT_DISPATCHER_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/*****************************************************************************/
+
+/* Device PCINT Layout */
+
+#if defined(PCMSK2) && defined(PINK)
+    // ATmega640/1280/2560: PB0-7, PE0 + PJ0-6, PK0-7
+    #define THE_HAL_PCINT_LAYOUT_MEGA
+#elif defined(PCMSK3) && defined(PINA)
+    // ATmega164/324/644/1284: PA0-7, PB0-7, PC0-7, PD0-7
+    #define THE_HAL_PCINT_LAYOUT_1284
+#elif defined(PCMSK2) && defined(PINC) && defined(PIND)
+    // ATmega48/88/168/328: PB0-7, PC0-6, PD0-7
+    #define THE_HAL_PCINT_LAYOUT_328
+#elif defined(PCMSK0) && defined(PINB)
+    // ATmega16U4/32U4 and similar: PB0-7
+    #define THE_HAL_PCINT_LAYOUT_PORTB
+#else
+    #error "TheHal PCINT Dispatcher: unsupported AVR device"
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_PCINT_PORT_B = 0,
+    THE_HAL_PCINT_PORT_C = 1,
+    THE_HAL_PCINT_PORT_D = 2,
+    THE_HAL_PCINT_PORT_E = 3,
+    THE_HAL_PCINT_PORT_J = 4,
+    THE_HAL_PCINT_PORT_K = 5,
+    THE_HAL_PCINT_PORT_A = 6
+} the_hal_pcint_port;
+
+/* Generate the ISR of a PCINT group, dispatching it to the given handlers */
+#define THE_HAL_PCINT_ISR(group, dispatcher) \
+    ISR(PCINT##group##_vect) { dispatcher::isr(); }
+
+/*****************************************************************************/
+
+/* Compile Time Pin Mapping */
+
+/* Get PCINT group (PCINTn_vect) of a port pin, -1 if it has no PCINT */
+constexpr int8_t pcint_group(const the_hal_pcint_port port,
+        const uint8_t bit)
+{
+    return (bit > 7) ? -1 :
+#if defined(THE_HAL_PCINT_LAYOUT_1284)
+        (port == THE_HAL_PCINT_PORT_A) ? 0 :
+        (port == THE_HAL_PCINT_PORT_B) ? 1 :
+        (port == THE_HAL_PCINT_PORT_C) ? 2 :
+        (port == THE_HAL_PCINT_PORT_D) ? 3 :
+#else
+        (port == THE_HAL_PCINT_PORT_B) ? 0 :
+#endif
+#if defined(THE_HAL_PCINT_LAYOUT_MEGA)
+        ((port == THE_HAL_PCINT_PORT_E) && (bit == 0)) ? 1 :
+        ((port == THE_HAL_PCINT_PORT_J) && (bit < 7)) ? 1 :
+        (port == THE_HAL_PCINT_PORT_K) ? 2 :
+#elif defined(THE_HAL_PCINT_LAYOUT_328)
+        ((port == THE_HAL_PCINT_PORT_C) && (bit < 7)) ? 1 :
+        (port == THE_HAL_PCINT_PORT_D) ? 2 :
+#endif
+        -1;
+}
+
+/* Get the bit of a port pin inside its PCMSKn register and group snapshot */
+constexpr uint8_t pcint_group_bit(const the_hal_pcint_port port,
+        const uint8_t bit)
+{
+    return (port == THE_HAL_PCINT_PORT_J) ? (uint8_t)(bit + 1) : bit;
+}
+
+/* Read the current levels of all the pins of a PCINT group */
+template <uint8_t GROUP>
+inline uint8_t pcint_read_group(void);
+
+#if defined(THE_HAL_PCINT_LAYOUT_1284)
+template <>
+inline uint8_t pcint_read_group<0>(void)
+{ return PINA; }
+
+template <>
+inline uint8_t pcint_read_group<1>(void)
+{ return PINB; }
+
+template <>
+inline uint8_t pcint_read_group<2>(void)
+{ return PINC; }
+
+template <>
+inline uint8_t pcint_read_group<3>(void)
+{ return PIND; }
+#else
+template <>
+inline uint8_t pcint_read_group<0>(void)
+{ return PINB; }
+#endif
+
+#if defined(THE_HAL_PCINT_LAYOUT_MEGA)
+template <>
+inline uint8_t pcint_read_group<1>(void)
+{ return (uint8_t)((PINE & 0x01) | (PINJ << 1)); }
+
+template <>
+inline uint8_t pcint_read_group<2>(void)
+{ return PINK; }
+#elif defined(THE_HAL_PCINT_LAYOUT_328)
+template <>
+inline uint8_t pcint_read_group<1>(void)
+{ return PINC; }
+
+template <>
+inline uint8_t pcint_read_group<2>(void)
+{ return PIND; }
+#endif
+
+/* Get the PCMSKn register of a PCINT group */
+template <uint8_t GROUP>
+inline volatile uint8_t& pcint_mask_register(void);
+
+template <>
+inline volatile uint8_t& pcint_mask_register<0>(void)
+{ return PCMSK0; }
+
+#if defined(PCMSK1)
+template <>
+inline volatile uint8_t& pcint_mask_register<1>(void)
+{ return PCMSK1; }
+#endif
+
+#if defined(PCMSK2)
+template <>
+inline volatile uint8_t& pcint_mask_register<2>(void)
+{ return PCMSK2; }
+#endif
+
+#if defined(PCMSK3)
+template <>
+inline volatile uint8_t& pcint_mask_register<3>(void)
+{ return PCMSK3; }
+#endif
+
+/*****************************************************************************/
+
+/* Handlers Table Entries */
+
+/* Pin change handler of a port pin, called with the new pin level */
+template <the_hal_pcint_port PORT, uint8_t BIT, void (*HANDLER)(const bool)>
+struct PcintHandler
+{
+    static constexpr int8_t group = pcint_group(PORT, BIT);
+    static constexpr uint8_t mask = (uint8_t)(1 << pcint_group_bit(PORT, BIT));
+
+    static_assert(group >= 0, "Pin has no Pin Change Interrupt");
+
+    __attribute__((always_inline))
+    static inline void call(const uint8_t changed, const uint8_t snapshot)
+    {
+        if(changed & mask)
+            HANDLER((snapshot & mask) != 0);
+    }
+};
+
+/* Compile time walk over the handlers table (unrolled in the ISR) */
+template <uint8_t GROUP, typename... HANDLERS>
+struct PcintHandlersTable;
+
+template <uint8_t GROUP>
+struct PcintHandlersTable<GROUP>
+{
+    static constexpr uint8_t mask = 0;
+
+    __attribute__((always_inline))
+    static inline void call(const uint8_t changed, const uint8_t snapshot)
+    {}
+};
+
+template <uint8_t GROUP, typename HANDLER, typename... OTHERS>
+struct PcintHandlersTable<GROUP, HANDLER, OTHERS...>
+{
+    static_assert(HANDLER::group == GROUP,
+            "Pin handler registered in a different PCINT group");
+
+    static constexpr uint8_t mask =
+            HANDLER::mask | PcintHandlersTable<GROUP, OTHERS...>::mask;
+
+    __attribute__((always_inline))
+    static inline void call(const uint8_t changed, const uint8_t snapshot)
+    {
+        HANDLER::call(changed, snapshot);
+        PcintHandlersTable<GROUP, OTHERS...>::call(changed, snapshot);
+    }
+};
+
+/*****************************************************************************/
+
+/* Class */
+
+template <uint8_t GROUP, typename... HANDLERS>
+class PcintDispatcher
+{
+    public:
+        typedef PcintHandlersTable<GROUP, HANDLERS...> Table;
+
+        /* Enable group pins change interrupts and take initial snapshot */
+        static void setup(void)
+        {
+            uint8_t sreg = SREG;
+            cli();
+            pcint_mask_register<GROUP>() |= Table::mask;
+            PCICR |= (uint8_t)(1 << GROUP);
+            last_snapshot = pcint_read_group<GROUP>();
+            PCIFR = (uint8_t)(1 << GROUP);
+            SREG = sreg;
+        }
+
+        /* Disable group pins change interrupts */
+        static void release(void)
+        {
+            uint8_t sreg = SREG;
+            cli();
+            pcint_mask_register<GROUP>() &= (uint8_t)(~Table::mask);
+            if(pcint_mask_register<GROUP>() == 0)
+                PCICR &= (uint8_t)(~(1 << GROUP));
+            SREG = sreg;
+        }
+
+        /* Dispatch group pins changes (called from the PCINTn ISR) */
+        __attribute__((always_inline))
+        static inline void isr(void)
+        {
+            uint8_t snapshot = pcint_read_group<GROUP>();
+            uint8_t changed = (snapshot ^ last_snapshot) & Table::mask;
+
+            last_snapshot = snapshot;
+            Table::call(changed, snapshot);
+        }
+
+    private:
+        static volatile uint8_t last_snapshot;
+};
+
+template <uint8_t GROUP, typename... HANDLERS>
+volatile uint8_t PcintDispatcher<GROUP, HANDLERS...>::last_snapshot = 0;
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_PCINT_DISPATCHER_H_ */
+#endif /* THE_HAL_COMPONENT_PCINT_DISPATCHER == 1 && defined(__AVR__) */
@@ -56,11 +56,21 @@
     #include "sam_asf/sam_asf_digital_in.h"
 #elif defined(__AVR__)
     #include "avr/avr_digital_in.h"
+#elif defined(LINUX_GPIO)
+    #include "linux/linux_digital_in.h"
 #else
     #include "dummy/dummy_digital_in.h"
 #endif
 
 /*****************************************************************************/
 
+/* HAL Extensions */
+
+#if (THE_HAL_COMPONENT_PCINT_DISPATCHER == 1) && defined(__AVR__)
+    #include "avr/avr_pcint_dispatcher.h"
+#endif
+
+/*****************************************************************************/
+
 #endif // THE_HAL_DIGITAL_IN_H_
 #endif // THE_HAL_COMPONENT_DIGITAL_IN
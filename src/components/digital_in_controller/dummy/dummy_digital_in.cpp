@@ -30,10 +30,21 @@
 
 /*****************************************************************************/
 
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
 /* Build Guard */
 
 #if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
-    !defined(__AVR__)
+    !defined(__AVR__) and !defined(LINUX_GPIO)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_DUMMY_DIGITAL_IN_CPP_
+#define THE_HAL_DUMMY_DIGITAL_IN_CPP_
 
 /*****************************************************************************/
 
@@ -41,41 +52,110 @@
 
 #include "dummy_digital_in.h"
 
-/*****************************************************************************/
-
-/* Constants */
-
-typedef enum
-{
-    UNDEFINED = -1,
-    NONE = 0,
-    PULLUP = 1,
-    PULLDOWN = 2
-} the_hal_digital_in_constants;
+#include "../../host_sim_controller/host_sim.h"
 
 /*****************************************************************************/
 
 /* Constructor */
 
 /* DigitalIn constructor */
-DigitalIn::DigitalIn(const int8_t _io_pin)
-{}
+THE_HAL_INLINE DigitalIn::DigitalIn(const int8_t _io_pin)
+{
+    this->io_pin = _io_pin;
+}
 
 /* DigitalIn destructor */
-DigitalIn::~DigitalIn()
+THE_HAL_INLINE DigitalIn::~DigitalIn()
 {}
 
 /*****************************************************************************/
 
 /* Public Methods */
 
-/* Initialize GPIO as digital input and set internal pull resistor */
-bool DigitalIn::setup(const uint8_t pull_resistor_mode)
-{ return true; }
+/* Initialize GPIO as digital input and set internal pull resistor (the
+ * simulated line takes the pull level, i.e. a released open-drain line) */
+THE_HAL_INLINE bool DigitalIn::setup(const uint8_t pull_resistor_mode)
+{
+    if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLUP)
+        return HostSim::write_pin(this->io_pin, true);
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLDOWN)
+        return HostSim::write_pin(this->io_pin, false);
+    return true;
+}
 
 /* Get GPIO digital input logical value */
-bool DigitalIn::read(void)
-{ return true; }
+THE_HAL_INLINE bool DigitalIn::read(void)
+{ return HostSim::read_pin(this->io_pin); }
+
+/*****************************************************************************/
+
+/* DigitalInBus Constructor */
+
+/* DigitalInBus constructor */
+THE_HAL_INLINE DigitalInBus::DigitalInBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    if(num_pins > THE_HAL_DIGITAL_IN_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+        this->io_pins[i] = io_pins[i];
+    this->num_pins = num_pins;
+}
+
+/* DigitalInBus destructor */
+THE_HAL_INLINE DigitalInBus::~DigitalInBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalInBus Public Methods */
+
+/* Initialize all bus GPIOs as digital inputs (the simulated lines take the
+ * pull level, as DigitalIn does) */
+THE_HAL_INLINE bool DigitalInBus::setup(const uint8_t pull_resistor_mode)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(HostSim::is_a_invalid_pin(this->io_pins[i]))
+            return false;
+    }
+
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLUP)
+            HostSim::write_pin(this->io_pins[i], true);
+        else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLDOWN)
+            HostSim::write_pin(this->io_pins[i], false);
+    }
+
+    return true;
+}
+
+/* Get all bus GPIOs values from a single snapshot of the ports */
+THE_HAL_INLINE uint32_t DigitalInBus::read(void)
+{
+    uint32_t snapshot[THE_HAL_HOST_SIM_NUM_PORTS];
+    uint32_t value = 0;
+
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+        snapshot[port] = HostSim::read_port(port);
+
+    // Bit N of the bus value is the level of the Nth GPIO of the bus
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        int8_t io_pin = this->io_pins[i];
+        if(snapshot[HostSim::get_pin_port(io_pin)] &
+                HostSim::get_pin_mask(io_pin))
+            value = value | (1UL << i);
+    }
+
+    return value;
+}
 
 /*****************************************************************************/
 
@@ -84,6 +164,8 @@ bool DigitalIn::read(void)
 
 /*****************************************************************************/
 
+#endif /* THE_HAL_DUMMY_DIGITAL_IN_CPP_ */
+
 #endif /* !defined(ARDUINO) and !defined(ESP_IDF) and .. */
 
 /*****************************************************************************/
@@ -47,6 +47,16 @@
 
 /* Constants */
 
+/* Maximum number of GPIOs that can be grouped in a DigitalInBus */
+#define THE_HAL_DIGITAL_IN_BUS_MAX_PINS 32
+
+/* Pull resistor modes of DigitalIn and DigitalInBus setup() */
+typedef enum
+{
+    THE_HAL_DIGITAL_IN_PULL_NONE = 0,
+    THE_HAL_DIGITAL_IN_PULLUP = 1,
+    THE_HAL_DIGITAL_IN_PULLDOWN = 2
+} the_hal_digital_in_pull_mode;
 
 /*****************************************************************************/
 
@@ -60,8 +70,33 @@ class DigitalIn
 
         bool setup(const uint8_t pull_resistor_mode);
         bool read(void);
+
+    private:
+        int8_t io_pin;
+};
+
+class DigitalInBus
+{
+    public:
+        DigitalInBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalInBus();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        uint32_t read(void);
+
+    private:
+        int8_t io_pins[THE_HAL_DIGITAL_IN_BUS_MAX_PINS];
+        uint8_t num_pins;
 };
 
 /*****************************************************************************/
 
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "dummy_digital_in.cpp"
+#endif
+
+/*****************************************************************************/
+
 #endif /* THE_HAL_DUMMY_DIGITAL_IN_H_ */
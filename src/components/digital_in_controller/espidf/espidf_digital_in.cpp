@@ -0,0 +1,215 @@
+
+/**
+ * @file    espidf_digital_in.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Input Controller for ESP-IDF devices.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(ESP_IDF)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_ESPIDF_DIGITAL_IN_CPP_
+#define THE_HAL_ESPIDF_DIGITAL_IN_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "espidf_digital_in.h"
+
+#include <driver/gpio.h>
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_ESPIDF_DIGITAL_IN_REG_BITS = 32
+} the_hal_espidf_digital_in_constants;
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Configure a GPIO as digital input with the requested pull resistor */
+static inline bool espidf_digital_in_configure_pin(const int8_t io_pin,
+        const uint8_t pull_resistor_mode)
+{
+    gpio_pull_mode_t pull;
+
+    if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULL_NONE)
+        pull = GPIO_FLOATING;
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLUP)
+        pull = GPIO_PULLUP_ONLY;
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLDOWN)
+        pull = GPIO_PULLDOWN_ONLY;
+    else
+        return false;
+
+    gpio_pad_select_gpio((gpio_num_t)io_pin);
+    if(gpio_set_direction((gpio_num_t)io_pin, GPIO_MODE_INPUT) != ESP_OK)
+        return false;
+    if(gpio_set_pull_mode((gpio_num_t)io_pin, pull) != ESP_OK)
+        return false;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalIn constructor */
+THE_HAL_INLINE DigitalIn::DigitalIn(const int8_t io_pin)
+{
+    this->io_pin = io_pin;
+    this->initialized = false;
+}
+
+/* DigitalIn destructor */
+THE_HAL_INLINE DigitalIn::~DigitalIn()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize GPIO as digital input and set internal pull resistor */
+THE_HAL_INLINE bool DigitalIn::setup(const uint8_t pull_resistor_mode)
+{
+    this->initialized = espidf_digital_in_configure_pin(this->io_pin,
+            pull_resistor_mode);
+    return this->initialized;
+}
+
+/* Get GPIO digital input logical value */
+THE_HAL_INLINE bool DigitalIn::read(void)
+{
+    if(!this->initialized)
+        return false;
+
+    return (gpio_get_level((gpio_num_t)this->io_pin) != 0);
+}
+
+/*****************************************************************************/
+
+/* DigitalInBus Constructor */
+
+/* DigitalInBus constructor */
+THE_HAL_INLINE DigitalInBus::DigitalInBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->initialized = false;
+    if(num_pins > THE_HAL_DIGITAL_IN_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+        this->io_pins[i] = io_pins[i];
+    this->num_pins = num_pins;
+}
+
+/* DigitalInBus destructor */
+THE_HAL_INLINE DigitalInBus::~DigitalInBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalInBus Public Methods */
+
+/* Initialize all bus GPIOs as digital inputs */
+THE_HAL_INLINE bool DigitalInBus::setup(const uint8_t pull_resistor_mode)
+{
+    this->initialized = false;
+    if(this->num_pins == 0)
+        return false;
+
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(!espidf_digital_in_configure_pin(this->io_pins[i],
+                pull_resistor_mode))
+            return false;
+    }
+
+    this->initialized = true;
+    return true;
+}
+
+/* Get all bus GPIOs values from a single snapshot of the input registers */
+THE_HAL_INLINE uint32_t DigitalInBus::read(void)
+{
+    uint32_t in_low;
+    uint32_t in_high = 0;
+    uint32_t value = 0;
+    uint8_t gpio;
+
+    if(!this->initialized)
+        return 0;
+
+    // Read both input registers back to back before decoding any bit
+    in_low = REG_READ(GPIO_IN_REG);
+#if defined(GPIO_IN1_REG)
+    in_high = REG_READ(GPIO_IN1_REG);
+#endif
+
+    // Bit N of the bus value is the level of the Nth GPIO of the bus
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        gpio = (uint8_t)(this->io_pins[i]);
+        if(gpio < THE_HAL_ESPIDF_DIGITAL_IN_REG_BITS)
+        {
+            if(in_low & (1UL << gpio))
+                value = value | (1UL << i);
+        }
+        else if(in_high &
+                (1UL << (gpio - THE_HAL_ESPIDF_DIGITAL_IN_REG_BITS)))
+            value = value | (1UL << i);
+    }
+
+    return value;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_ESPIDF_DIGITAL_IN_CPP_ */
+
+#endif /* defined(ESP_IDF) */
+
+/*****************************************************************************/
@@ -0,0 +1,104 @@
+
+/**
+ * @file    espidf_digital_in.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Input Controller for ESP-IDF devices.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_ESPIDF_DIGITAL_IN_H_
+#define THE_HAL_ESPIDF_DIGITAL_IN_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Maximum number of GPIOs that can be grouped in a DigitalInBus */
+#define THE_HAL_DIGITAL_IN_BUS_MAX_PINS 32
+
+/* Pull resistor modes of DigitalIn and DigitalInBus setup() */
+typedef enum
+{
+    THE_HAL_DIGITAL_IN_PULL_NONE = 0,
+    THE_HAL_DIGITAL_IN_PULLUP = 1,
+    THE_HAL_DIGITAL_IN_PULLDOWN = 2
+} the_hal_digital_in_pull_mode;
+
+/*****************************************************************************/
+
+/* Class */
+
+class DigitalIn
+{
+    public:
+        DigitalIn(const int8_t io_pin);
+        ~DigitalIn();
+
+        bool setup(const uint8_t pull_resistor_mode=0);
+        bool read(void);
+
+    private:
+        int8_t io_pin;
+        bool initialized;
+};
+
+class DigitalInBus
+{
+    public:
+        DigitalInBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalInBus();
+
+        bool setup(const uint8_t pull_resistor_mode=0);
+        uint32_t read(void);
+
+    private:
+        int8_t io_pins[THE_HAL_DIGITAL_IN_BUS_MAX_PINS];
+        uint8_t num_pins;
+        bool initialized;
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "espidf_digital_in.cpp"
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_ESPIDF_DIGITAL_IN_H_ */
@@ -0,0 +1,64 @@
+
+// Requires THE_HAL_COMPONENT_PCINT_DISPATCHER enabled in thehal.h
+// AVR only example (i.e. Arduino Uno: D8 is PB0 and D9 is PB1)
+#include <thehal.h>
+#include <components/digital_in_controller/digital_in.h>
+
+/*****************************************************************************/
+
+#define GPIO_LED 13
+#define GPIO_BUTTON_0 8
+#define GPIO_BUTTON_1 9
+
+/*****************************************************************************/
+
+DigitalOut MyLed(GPIO_LED);
+DigitalIn MyButton0(GPIO_BUTTON_0);
+DigitalIn MyButton1(GPIO_BUTTON_1);
+
+volatile uint16_t Button1Changes = 0;
+
+/*****************************************************************************/
+
+void on_button_0(const bool level)
+{
+    if(level)
+        MyLed.set_high();
+    else
+        MyLed.set_low();
+}
+
+void on_button_1(const bool level)
+{
+    Button1Changes = Button1Changes + 1;
+}
+
+typedef PcintDispatcher<0,
+    PcintHandler<THE_HAL_PCINT_PORT_B, 0, on_button_0>,
+    PcintHandler<THE_HAL_PCINT_PORT_B, 1, on_button_1>> MyPcint0;
+
+THE_HAL_PCINT_ISR(0, MyPcint0)
+
+/*****************************************************************************/
+
+void setup()
+{
+    Serial.begin(115200);
+    MyLed.setup();
+    MyButton0.setup(THE_HAL_DIGITAL_IN_PULLUP);
+    MyButton1.setup(THE_HAL_DIGITAL_IN_PULLUP);
+    MyPcint0::setup();
+}
+
+void loop()
+{
+    uint16_t changes;
+
+    noInterrupts();
+    changes = Button1Changes;
+    interrupts();
+
+    Serial.print("Button 1 changes: ");
+    Serial.println(changes);
+    delay(500);
+}
@@ -0,0 +1,215 @@
+
+/**
+ * @file    linux_digital_in.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Input Controller for Linux devices (gpiochip character
+ * device v2 uAPI, i.e. SBC gateways).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(LINUX_GPIO)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_LINUX_DIGITAL_IN_CPP_
+#define THE_HAL_LINUX_DIGITAL_IN_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "linux_digital_in.h"
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Get line request flags of an input with a pull resistor mode */
+static inline bool linux_digital_in_input_flags(
+        const uint8_t pull_resistor_mode, uint64_t* flags)
+{
+    *flags = GPIO_V2_LINE_FLAG_INPUT;
+    if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULL_NONE)
+        *flags = *flags | GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLUP)
+        *flags = *flags | GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+    else if(pull_resistor_mode == THE_HAL_DIGITAL_IN_PULLDOWN)
+        *flags = *flags | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN;
+    else
+        return false;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalIn constructor */
+THE_HAL_INLINE DigitalIn::DigitalIn(const int8_t _io_pin)
+{
+    this->io_pin = _io_pin;
+}
+
+/* DigitalIn destructor */
+THE_HAL_INLINE DigitalIn::~DigitalIn()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize GPIO as digital input and set internal pull resistor */
+THE_HAL_INLINE bool DigitalIn::setup(const uint8_t pull_resistor_mode)
+{
+    uint64_t flags;
+
+    if(!linux_digital_in_input_flags(pull_resistor_mode, &flags))
+        return false;
+
+    if(this->line.is_requested())
+        return this->line.reconfigure(flags, 0);
+
+    return this->line.request(&this->io_pin, 1, flags, 0);
+}
+
+/* Get GPIO digital input logical value */
+THE_HAL_INLINE bool DigitalIn::read(void)
+{
+    uint32_t values = 0;
+
+    this->line.get_values(&values);
+    return (values != 0);
+}
+
+/*****************************************************************************/
+
+/* DigitalInBus Constructor */
+
+/* DigitalInBus constructor */
+THE_HAL_INLINE DigitalInBus::DigitalInBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->flags = 0;
+    if(num_pins > THE_HAL_DIGITAL_IN_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+        this->io_pins[i] = io_pins[i];
+    this->num_pins = num_pins;
+}
+
+/* DigitalInBus destructor */
+THE_HAL_INLINE DigitalInBus::~DigitalInBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalInBus Public Methods */
+
+/* Initialize all bus GPIOs as digital inputs */
+THE_HAL_INLINE bool DigitalInBus::setup(const uint8_t pull_resistor_mode)
+{
+    uint64_t edge_flags;
+
+    if(this->num_pins == 0)
+        return false;
+
+    // Keep edge detection if it was already enabled
+    edge_flags = this->flags & (GPIO_V2_LINE_FLAG_EDGE_RISING |
+            GPIO_V2_LINE_FLAG_EDGE_FALLING);
+    if(!linux_digital_in_input_flags(pull_resistor_mode, &this->flags))
+        return false;
+    this->flags = this->flags | edge_flags;
+
+    if(this->lines.is_requested())
+        return this->lines.reconfigure(this->flags, 0);
+
+    return this->lines.request(this->io_pins, this->num_pins, this->flags, 0);
+}
+
+/* Get all bus GPIOs values with a single ioctl */
+THE_HAL_INLINE uint32_t DigitalInBus::read(void)
+{
+    uint32_t values = 0;
+
+    this->lines.get_values(&values);
+    return values;
+}
+
+/* Enable kernel edge detection of all bus GPIOs (setup() must be called) */
+THE_HAL_INLINE bool DigitalInBus::setup_events(const uint8_t edges)
+{
+    uint64_t flags;
+
+    if(edges > THE_HAL_LINUX_GPIO_EDGE_BOTH)
+        return false;
+
+    flags = this->flags & ~((uint64_t)(GPIO_V2_LINE_FLAG_EDGE_RISING |
+            GPIO_V2_LINE_FLAG_EDGE_FALLING));
+    if(edges & THE_HAL_LINUX_GPIO_EDGE_RISING)
+        flags = flags | GPIO_V2_LINE_FLAG_EDGE_RISING;
+    if(edges & THE_HAL_LINUX_GPIO_EDGE_FALLING)
+        flags = flags | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+
+    if(!this->lines.reconfigure(flags, 0))
+        return false;
+    this->flags = flags;
+
+    return true;
+}
+
+/* Read a batch of edge events (event line is the bus GPIO index) */
+THE_HAL_INLINE int16_t DigitalInBus::read_events(
+        the_hal_linux_gpio_event* events, const uint16_t max_events,
+        const int32_t timeout_ms)
+{
+    return this->lines.read_events(events, max_events, timeout_ms);
+}
+
+/* Get line request file descriptor (i.e. to wait events with epoll) */
+THE_HAL_INLINE int DigitalInBus::get_fd(void)
+{
+    return this->lines.get_fd();
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_DIGITAL_IN_CPP_ */
+
+#endif /* defined(LINUX_GPIO) */
+
+/*****************************************************************************/
@@ -0,0 +1,115 @@
+
+/**
+ * @file    linux_digital_in.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Input Controller for Linux devices (gpiochip character
+ * device v2 uAPI, i.e. SBC gateways).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_LINUX_DIGITAL_IN_H_
+#define THE_HAL_LINUX_DIGITAL_IN_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../linux_gpio_controller/linux_gpio.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Maximum number of GPIOs that can be grouped in a DigitalInBus */
+#define THE_HAL_DIGITAL_IN_BUS_MAX_PINS THE_HAL_LINUX_GPIO_MAX_LINES
+
+/* Pull resistor modes of DigitalIn and DigitalInBus setup() */
+typedef enum
+{
+    THE_HAL_DIGITAL_IN_PULL_NONE = 0,
+    THE_HAL_DIGITAL_IN_PULLUP = 1,
+    THE_HAL_DIGITAL_IN_PULLDOWN = 2
+} the_hal_digital_in_pull_mode;
+
+/*****************************************************************************/
+
+/* Class */
+
+class DigitalIn
+{
+    public:
+        DigitalIn(const int8_t _io_pin);
+        ~DigitalIn();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        bool read(void);
+
+    private:
+        LinuxGpioLines line;
+        int8_t io_pin;
+};
+
+/* All bus GPIOs share one line request, so each read is a single ioctl and
+ * edge events of any bus GPIO are read in batches from one file */
+class DigitalInBus
+{
+    public:
+        DigitalInBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalInBus();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        uint32_t read(void);
+
+        bool setup_events(const uint8_t edges);
+        int16_t read_events(the_hal_linux_gpio_event* events,
+                const uint16_t max_events, const int32_t timeout_ms = 0);
+        int get_fd(void);
+
+    private:
+        LinuxGpioLines lines;
+        int8_t io_pins[THE_HAL_DIGITAL_IN_BUS_MAX_PINS];
+        uint8_t num_pins;
+        uint64_t flags;
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "linux_digital_in.cpp"
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_DIGITAL_IN_H_ */
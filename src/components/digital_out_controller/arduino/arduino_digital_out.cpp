@@ -30,10 +30,21 @@
 
 /*****************************************************************************/
 
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
 /* Build Guard */
 
 #if defined(ARDUINO)
 
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_ARDUINO_DIGITAL_OUT_CPP_
+#define THE_HAL_ARDUINO_DIGITAL_OUT_CPP_
+
 /*****************************************************************************/
 
 /* Libraries */
@@ -46,22 +57,75 @@
 
 typedef enum
 {
-    UNDEFINED = -1
-} the_hal_digital_out_constants;
+    THE_HAL_ARDUINO_DIGITAL_OUT_UNDEFINED = -1
+} the_hal_arduino_digital_out_constants;
+
+/*****************************************************************************/
+
+/* Critical Section */
+
+/* Bus ports read-modify-write is done with interrupts masked, restoring the
+ * previous interrupts state as it can be called from an ISR (i.e. the
+ * DisplayMux refresh) */
+
+#if defined(__AVR__)
+
+    typedef uint8_t the_hal_arduino_digital_out_lock;
+
+    static inline the_hal_arduino_digital_out_lock
+            arduino_digital_out_lock(void)
+    { uint8_t sreg = SREG; cli(); return sreg; }
+
+    static inline void arduino_digital_out_unlock(
+            the_hal_arduino_digital_out_lock sreg)
+    { SREG = sreg; }
+
+#elif defined(__arm__)
+
+    typedef uint32_t the_hal_arduino_digital_out_lock;
+
+    static inline the_hal_arduino_digital_out_lock
+            arduino_digital_out_lock(void)
+    {
+        uint32_t primask;
+        __asm__ __volatile__("mrs %0, primask" : "=r" (primask));
+        __asm__ __volatile__("cpsid i" ::: "memory");
+        return primask;
+    }
+
+    static inline void arduino_digital_out_unlock(
+            the_hal_arduino_digital_out_lock primask)
+    { __asm__ __volatile__("msr primask, %0" :: "r" (primask) : "memory"); }
+
+#else
+
+    // Other cores have no portable way to get the interrupts state
+    typedef uint8_t the_hal_arduino_digital_out_lock;
+
+    static inline the_hal_arduino_digital_out_lock
+            arduino_digital_out_lock(void)
+    { noInterrupts(); return 0; }
+
+    static inline void arduino_digital_out_unlock(
+            the_hal_arduino_digital_out_lock)
+    { interrupts(); }
+
+#endif
 
 /*****************************************************************************/
 
 /* Constructor */
 
 /* DigitalOut constructor */
-DigitalOut::DigitalOut(const int8_t io_pin)
+THE_HAL_INLINE DigitalOut::DigitalOut(const int8_t io_pin)
 {
     this->io_pin = io_pin;
-    this->io_val = UNDEFINED;
+    this->io_val = THE_HAL_ARDUINO_DIGITAL_OUT_UNDEFINED;
+    this->open_drain = false;
 }
 
 /* DigitalOut destructor */
-DigitalOut::~DigitalOut()
+THE_HAL_INLINE DigitalOut::~DigitalOut()
 {}
 
 /*****************************************************************************/
@@ -69,64 +133,298 @@ DigitalOut::~DigitalOut()
 /* Public Methods */
 
 /* Initialize GPIO as digital output and set them to an initial logic value */
-bool DigitalOut::setup(const uint8_t initial_value)
+THE_HAL_INLINE bool DigitalOut::setup(const uint8_t initial_value)
 {
     if(is_a_invalid_digital_value(initial_value))
         return false;
 
     this->io_val = initial_value;
+    this->open_drain = false;
     digitalWrite((uint8_t)this->io_pin, (uint8_t)this->io_val);
     pinMode((uint8_t)this->io_pin, OUTPUT);
 
     return true;
 }
 
+/* Initialize GPIO as open-drain output (high releases the line, that is
+ * pulled up by an external or the input pull-up resistor) */
+THE_HAL_INLINE bool DigitalOut::setup_open_drain(const uint8_t initial_value)
+{
+    if(is_a_invalid_digital_value(initial_value))
+        return false;
+
+    this->io_val = initial_value;
+    this->open_drain = true;
+#if defined(OUTPUT_OPEN_DRAIN)
+    digitalWrite((uint8_t)this->io_pin, (uint8_t)this->io_val);
+    pinMode((uint8_t)this->io_pin, OUTPUT_OPEN_DRAIN);
+#else
+    // Released as input with the output latch low, driving low only enables
+    // the output (the pin mode register is kept to switch it on each write)
+    pinMode((uint8_t)this->io_pin, INPUT);
+    digitalWrite((uint8_t)this->io_pin, LOW);
+  #if defined(__AVR__)
+    this->mode_reg = portModeRegister(digitalPinToPort((uint8_t)this->io_pin));
+    this->mode_mask = digitalPinToBitMask((uint8_t)this->io_pin);
+  #endif
+    write_value();
+#endif
+
+    return true;
+}
+
 /* Set GPIO digital out value to logical low */
-bool DigitalOut::set_low(void)
+THE_HAL_INLINE bool DigitalOut::set_low(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = LOW;
-    digitalWrite((uint8_t)this->io_pin, (uint8_t)this->io_val);
+    write_value();
 
     return true;
 }
 
 /* Set GPIO digital out value to logical high */
-bool DigitalOut::set_high(void)
+THE_HAL_INLINE bool DigitalOut::set_high(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = HIGH;
-    digitalWrite((uint8_t)this->io_pin, (uint8_t)this->io_val);
+    write_value();
 
     return true;
 }
 
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOut::toggle(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    this->io_val = (this->io_val == LOW) ? HIGH : LOW;
+    write_value();
+
+    return true;
+}
+
+/* Get GPIO line level (i.e. an open-drain line held low by a device) */
+THE_HAL_INLINE bool DigitalOut::read(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    return (digitalRead((uint8_t)this->io_pin) == HIGH);
+}
+
 /*****************************************************************************/
 
 /* Private Methods */
 
 /* Check if GPIO is not configured (setup() was not called). */
-bool DigitalOut::gpio_is_not_initialized(void)
+THE_HAL_INLINE bool DigitalOut::gpio_is_not_initialized(void)
 {
-    if(this->io_val != UNDEFINED)
+    if(this->io_val != THE_HAL_ARDUINO_DIGITAL_OUT_UNDEFINED)
         return false;
     return true;
 }
 
 /* Check if provided value is not a valid digital value */
-bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
+THE_HAL_INLINE bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
 {
     if((value == LOW) || (value == HIGH))
         return false;
     return true;
 }
 
+/* Apply the GPIO value (open-drain without core support switches the pin
+ * between output low and input) */
+THE_HAL_INLINE void DigitalOut::write_value(void)
+{
+#if !defined(OUTPUT_OPEN_DRAIN) && defined(__AVR__)
+    uint8_t sreg;
+
+    if(this->open_drain)
+    {
+        sreg = SREG;
+        cli();
+        if(this->io_val == LOW)
+            *(this->mode_reg) = *(this->mode_reg) | this->mode_mask;
+        else
+            *(this->mode_reg) = *(this->mode_reg) & ~this->mode_mask;
+        SREG = sreg;
+        return;
+    }
+#elif !defined(OUTPUT_OPEN_DRAIN)
+    if(this->open_drain)
+    {
+        pinMode((uint8_t)this->io_pin, (this->io_val == LOW) ? OUTPUT : INPUT);
+        return;
+    }
+#endif
+
+    digitalWrite((uint8_t)this->io_pin, (uint8_t)this->io_val);
+}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Constructor */
+
+/* DigitalOutBus constructor */
+THE_HAL_INLINE DigitalOutBus::DigitalOutBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->num_ports = 0;
+    this->bus_mask = 0;
+    this->initialized = false;
+    if(num_pins > THE_HAL_DIGITAL_OUT_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+    {
+        this->io_pins[i] = io_pins[i];
+        this->bus_mask = this->bus_mask | (1UL << i);
+    }
+    this->num_pins = num_pins;
+}
+
+/* DigitalOutBus destructor */
+THE_HAL_INLINE DigitalOutBus::~DigitalOutBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Public Methods */
+
+/* Initialize all bus GPIOs as digital outputs with initial logic values */
+THE_HAL_INLINE bool DigitalOutBus::setup(const uint32_t initial_values)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    this->num_ports = 0;
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(this->io_pins[i] < 0)
+            return false;
+        if(!map_pin_to_port(i))
+            return false;
+    }
+
+    // Set the levels before enabling the outputs to avoid glitches
+    this->initialized = true;
+    write(initial_values);
+    for(uint8_t i = 0; i < this->num_pins; i++)
+        pinMode((uint8_t)this->io_pins[i], OUTPUT);
+
+    return true;
+}
+
+/* Set all bus GPIOs values (bit N is the value of the Nth GPIO) */
+THE_HAL_INLINE bool DigitalOutBus::write(const uint32_t values)
+{
+    return write_masked(values & this->bus_mask, ~values & this->bus_mask);
+}
+
+/* Set to high the bus GPIOs of set_mask and to low the ones of clear_mask */
+THE_HAL_INLINE bool DigitalOutBus::write_masked(const uint32_t set_mask,
+        const uint32_t clear_mask)
+{
+    the_hal_digital_out_bus_prepared prepared;
+
+    if(!prepare(set_mask, clear_mask, &prepared))
+        return false;
+
+    return write_prepared(&prepared);
+}
+
+/* Translate bus set/clear masks into ports masks once, so the same write
+ * can be repeated later at a fixed cost (i.e. from an interrupt) */
+THE_HAL_INLINE bool DigitalOutBus::prepare(const uint32_t set_mask,
+        const uint32_t clear_mask, the_hal_digital_out_bus_prepared* prepared)
+{
+    if(!this->initialized)
+        return false;
+
+    for(uint8_t port = 0; port < THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS; port++)
+    {
+        prepared->set[port] = 0;
+        prepared->clear[port] = 0;
+    }
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        uint8_t port = this->pin_ports[i];
+        if(set_mask & (1UL << i))
+            prepared->set[port] = prepared->set[port] | this->pin_masks[i];
+        else if(clear_mask & (1UL << i))
+            prepared->clear[port] = prepared->clear[port] | this->pin_masks[i];
+    }
+
+    return true;
+}
+
+/* Write prepared ports masks (one read-modify-write of each port) */
+THE_HAL_INLINE bool DigitalOutBus::write_prepared(
+        const the_hal_digital_out_bus_prepared* prepared)
+{
+    volatile the_hal_port_t* port_reg;
+    the_hal_arduino_digital_out_lock lock;
+
+    if(!this->initialized)
+        return false;
+
+    for(uint8_t port = 0; port < this->num_ports; port++)
+    {
+        if((prepared->set[port] | prepared->clear[port]) == 0)
+            continue;
+
+        // Interrupts could modify other pins of the port in the middle
+        port_reg = this->port_regs[port];
+        lock = arduino_digital_out_lock();
+        *port_reg = (*port_reg & ~prepared->clear[port]) | prepared->set[port];
+        arduino_digital_out_unlock(lock);
+    }
+
+    return true;
+}
+
 /*****************************************************************************/
 
+/* DigitalOutBus Private Methods */
+
+/* Get GPIO output register and mask, sharing the register between pins */
+THE_HAL_INLINE bool DigitalOutBus::map_pin_to_port(const uint8_t pin_index)
+{
+    uint8_t io_pin = (uint8_t)this->io_pins[pin_index];
+    volatile the_hal_port_t* port_reg = (volatile the_hal_port_t*)
+            portOutputRegister(digitalPinToPort(io_pin));
+
+    this->pin_masks[pin_index] = (the_hal_port_t)digitalPinToBitMask(io_pin);
+    for(uint8_t port = 0; port < this->num_ports; port++)
+    {
+        if(this->port_regs[port] == port_reg)
+        {
+            this->pin_ports[pin_index] = port;
+            return true;
+        }
+    }
+
+    if(this->num_ports >= THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS)
+        return false;
+
+    this->port_regs[this->num_ports] = port_reg;
+    this->pin_ports[pin_index] = this->num_ports;
+    this->num_ports = this->num_ports + 1;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_ARDUINO_DIGITAL_OUT_CPP_ */
+
 #endif /* defined(ARDUINO) */
 
 /*****************************************************************************/
@@ -49,6 +49,33 @@
 
 /* Constants */
 
+/* Maximum number of GPIOs that can be grouped in a DigitalOutBus */
+#if defined(__AVR__)
+    #define THE_HAL_DIGITAL_OUT_BUS_MAX_PINS 16
+#else
+    #define THE_HAL_DIGITAL_OUT_BUS_MAX_PINS 32
+#endif
+
+/* Maximum number of different ports that a DigitalOutBus can span */
+#define THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS 4
+
+/* Native width of the GPIO port registers */
+#if defined(__AVR__)
+    typedef uint8_t the_hal_port_t;
+#else
+    typedef uint32_t the_hal_port_t;
+#endif
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Bus values translated to ports masks (see DigitalOutBus::prepare()) */
+typedef struct
+{
+    the_hal_port_t set[THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS];
+    the_hal_port_t clear[THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS];
+} the_hal_digital_out_bus_prepared;
 
 /*****************************************************************************/
 
@@ -61,17 +88,61 @@ class DigitalOut
         ~DigitalOut();
 
         bool setup(const uint8_t initial_value=LOW);
+        bool setup_open_drain(const uint8_t initial_value=HIGH);
         bool set_low(void);
         bool set_high(void);
+        bool toggle(void);
+        bool read(void);
 
     private:
         int8_t io_pin;
         int8_t io_val;
+        bool open_drain;
+#if defined(__AVR__) && !defined(OUTPUT_OPEN_DRAIN)
+        volatile uint8_t* mode_reg;
+        uint8_t mode_mask;
+#endif
 
         bool gpio_is_not_initialized(void);
         bool is_a_invalid_digital_value(const uint8_t value);
+        void write_value(void);
 };
 
+class DigitalOutBus
+{
+    public:
+        DigitalOutBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalOutBus();
+
+        bool setup(const uint32_t initial_values);
+        bool write(const uint32_t values);
+        bool write_masked(const uint32_t set_mask, const uint32_t clear_mask);
+
+        bool prepare(const uint32_t set_mask, const uint32_t clear_mask,
+                the_hal_digital_out_bus_prepared* prepared);
+        bool write_prepared(const the_hal_digital_out_bus_prepared* prepared);
+
+    private:
+        int8_t io_pins[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        the_hal_port_t pin_masks[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        uint8_t pin_ports[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        volatile the_hal_port_t* port_regs[THE_HAL_DIGITAL_OUT_BUS_MAX_PORTS];
+        uint8_t num_pins;
+        uint8_t num_ports;
+        uint32_t bus_mask;
+        bool initialized;
+
+        bool map_pin_to_port(const uint8_t pin_index);
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "arduino_digital_out.cpp"
+#endif
+
 /*****************************************************************************/
 
 #endif /* THE_HAL_ARDUINO_DIGITAL_OUT_H_ */
@@ -30,26 +30,37 @@
 
 /*****************************************************************************/
 
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
 /* Build Guard */
 
 #if defined(__AVR__) and !defined(ARDUINO)
 
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_AVR_DIGITAL_OUT_CPP_
+#define THE_HAL_AVR_DIGITAL_OUT_CPP_
+
 /*****************************************************************************/
 
 /* Libraries */
 
 #include "avr_digital_out.h"
 
+#include "avr_port_ops.h"
+
 #include <avr/io.h>
 
 /*****************************************************************************/
 
 /* Ease Macros */
 
-#define bitSet(value, bit) ((value) |= (1UL << (bit)))
-#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
-#define getDDR(port_pin) ((uint8_t)((port_pin >> 8 ) & 0x00ff))
-#define getPORT(port_pin) ((uint8_t)((port_pin >> 8 ) & 0x00ff))
+#define getPORT(port_pin) \
+    (&_MMIO_BYTE(((port_pin >> 8) & 0x00ff) + __SFR_OFFSET))
 #define getPIN(port_pin) ((uint8_t)(port_pin & 0x00ff))
 
 /* Defines */
@@ -64,14 +75,15 @@
 /* Constructor */
 
 /* DigitalOut constructor */
-DigitalOut::DigitalOut(const uint16_t io_pin)
+THE_HAL_INLINE DigitalOut::DigitalOut(const uint16_t io_pin)
 {
     this->io_pin = io_pin;
     this->io_val = -1;
+    this->open_drain = false;
 }
 
 /* DigitalOut destructor */
-DigitalOut::~DigitalOut()
+THE_HAL_INLINE DigitalOut::~DigitalOut()
 {}
 
 /*****************************************************************************/
@@ -79,56 +91,101 @@ DigitalOut::~DigitalOut()
 /* Public Methods */
 
 /* Initialize GPIO as digital output and set them to an initial logic value */
-bool DigitalOut::setup(const uint8_t initial_value)
+THE_HAL_INLINE bool DigitalOut::setup(const uint8_t initial_value)
 {
     if(is_a_invalid_digital_value(initial_value))
         return false;
 
     this->io_val = initial_value;
+    this->open_drain = false;
     this->digitalWrite(this->io_pin, (uint8_t)this->io_val);
     this->pinMode(this->io_pin, 1);
 
     return true;
 }
 
+/* Initialize GPIO as open-drain output (high releases the line as input
+ * without pull-up, low enables the output with the PORT bit kept low) */
+THE_HAL_INLINE bool DigitalOut::setup_open_drain(const uint8_t initial_value)
+{
+    if(is_a_invalid_digital_value(initial_value))
+        return false;
+
+    this->io_val = initial_value;
+    this->open_drain = true;
+    this->digitalWrite(this->io_pin, LOW);
+    this->pinMode(this->io_pin, (initial_value == LOW));
+
+    return true;
+}
+
 /* Set GPIO digital out value to logical low */
-bool DigitalOut::set_low(void)
+THE_HAL_INLINE bool DigitalOut::set_low(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = LOW;
-    this->digitalWrite(this->io_pin, (uint8_t)this->io_val);
+    if(this->open_drain)
+        this->pinMode(this->io_pin, OUTPUT);
+    else
+        this->digitalWrite(this->io_pin, (uint8_t)this->io_val);
 
     return true;
 }
 
 /* Set GPIO digital out value to logical high */
-bool DigitalOut::set_high(void)
+THE_HAL_INLINE bool DigitalOut::set_high(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = HIGH;
-    this->digitalWrite(this->io_pin, (uint8_t)this->io_val);
+    if(this->open_drain)
+        this->pinMode(this->io_pin, 0);
+    else
+        this->digitalWrite(this->io_pin, (uint8_t)this->io_val);
 
     return true;
 }
 
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOut::toggle(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    this->io_val = (this->io_val == LOW) ? HIGH : LOW;
+    if(this->open_drain)
+        this->pinMode(this->io_pin, (this->io_val == LOW));
+    else
+        this->digitalToggle(this->io_pin);
+
+    return true;
+}
+
+/* Get GPIO line level (i.e. an open-drain line held low by a device) */
+THE_HAL_INLINE bool DigitalOut::read(void)
+{
+    // PINx register is two addresses below PORTx
+    uint8_t mask = (uint8_t)(1 << getPIN(this->io_pin));
+    return ((*(getPORT(this->io_pin) - 2) & mask) != 0);
+}
+
 /*****************************************************************************/
 
 /* Private Methods */
 
 /* Check if GPIO is not configured (setup() was not called). */
-bool DigitalOut::gpio_is_not_initialized(void)
+THE_HAL_INLINE bool DigitalOut::gpio_is_not_initialized(void)
 {
-    if(this->io_val == UNDEFINED)
+    if(this->io_val != UNDEFINED)
         return false;
     return true;
 }
 
 /* Check if provided value is not a valid digital value */
-bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
+THE_HAL_INLINE bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
 {
     if((value == LOW) || (value == HIGH))
         return false;
@@ -136,35 +193,47 @@ bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
 }
 
 /* Low Level function to setup pin through Registers */
-void DigitalOut::pinMode(const uint16_t port_pin, const uint8_t val)
+THE_HAL_INLINE void DigitalOut::pinMode(const uint16_t port_pin,
+        const uint8_t val)
 {
-    // "DDR" should be specified in MSB byte of "port_pin"
+    // "Port" should be specified in MSB byte of "port_pin" (I/O address)
     // "Pin" should be specified in LSB byte of "port_pin"
-    // i.e. port_pin = ((DDRB) << 8) | PB0);
-    uint8_t port = getPORT(port_pin);
-    uint8_t pin = getPIN(port_pin);
-    if(val == 0)
-        bitClear(port, pin);
-    else
-        bitSet(port, pin);
+    // i.e. port_pin = THE_HAL_AVR_PIN(PORTB, PB0)
+    uint8_t mask = (uint8_t)(1 << getPIN(port_pin));
+    avr_port_set_output(getPORT(port_pin), mask, (val != 0));
 }
 
 /* Low Level function to setup digital out pin value through Registers */
-void DigitalOut::digitalWrite(const uint16_t port_pin, const uint8_t val)
+THE_HAL_INLINE void DigitalOut::digitalWrite(const uint16_t port_pin,
+        const uint8_t val)
 {
-    // "Port" should be specified in MSB byte of "port_pin"
-    // "Pin" should be specified in LSB byte of "port_pin"
-    // i.e. port_pin = ((PORTB) << 8) | PB0);
-    uint8_t port = getPORT(port_pin);
-    uint8_t pin = getPIN(port_pin);
-    if(val == 0)
-        bitClear(port, pin);
-    else
-        bitSet(port, pin);
+    // Interrupt-safe against other pins of the same port
+    uint8_t mask = (uint8_t)(1 << getPIN(port_pin));
+    avr_port_write(getPORT(port_pin), mask, (val != 0));
+}
+
+/* Low Level function to invert digital out pin value through Registers */
+THE_HAL_INLINE void DigitalOut::digitalToggle(const uint16_t port_pin)
+{
+    uint8_t mask = (uint8_t)(1 << getPIN(port_pin));
+    avr_port_toggle(getPORT(port_pin), mask);
 }
 
 /*****************************************************************************/
 
+/* Local Macros Removal (not leaked into code of header-only builds) */
+
+#undef getPORT
+#undef getPIN
+#undef OUTPUT
+#undef LOW
+#undef HIGH
+#undef UNDEFINED
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_DIGITAL_OUT_CPP_ */
+
 #endif /* defined(__AVR__) and !defined(ARDUINO) */
 
 /*****************************************************************************/
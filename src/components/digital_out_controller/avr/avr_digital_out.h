@@ -59,20 +59,33 @@ class DigitalOut
         ~DigitalOut();
 
         bool setup(const uint8_t initial_value);
+        bool setup_open_drain(const uint8_t initial_value);
         bool set_low(void);
         bool set_high(void);
+        bool toggle(void);
+        bool read(void);
 
     private:
         uint16_t io_pin;
         int8_t io_val;
+        bool open_drain;
 
         bool gpio_is_not_initialized(void);
         bool is_a_invalid_digital_value(const uint8_t value);
 
         void pinMode(const uint16_t port_pin, const uint8_t val);
         void digitalWrite(const uint16_t port_pin, const uint8_t val);
+        void digitalToggle(const uint16_t port_pin);
 };
 
 /*****************************************************************************/
 
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "avr_digital_out.cpp"
+#endif
+
+/*****************************************************************************/
+
 #endif /* THE_HAL_AVR_DIGITAL_OUT_H_ */
@@ -0,0 +1,159 @@
+
+/**
+ * @file    avr_digital_out_packed.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * RAM-Minimal GPIO Digital Output for AVR devices.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(__AVR__)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_AVR_DIGITAL_OUT_PACKED_CPP_
+#define THE_HAL_AVR_DIGITAL_OUT_PACKED_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "avr_digital_out_packed.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_AVR_PACKED_BIT_MASK = 0x07,
+    THE_HAL_AVR_PACKED_PORT_SHIFT = 3,
+    THE_HAL_AVR_PACKED_PORT_MASK = 0x0f,
+    THE_HAL_AVR_PACKED_INITIALIZED = 0x80
+} the_hal_avr_digital_out_packed_constants;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalOutPacked constructor */
+THE_HAL_INLINE DigitalOutPacked::DigitalOutPacked(const uint8_t packed_pin)
+{
+    this->packed_pin = packed_pin &
+            (uint8_t)(~THE_HAL_AVR_PACKED_INITIALIZED);
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize GPIO as digital output and set them to an initial logic value */
+THE_HAL_INLINE bool DigitalOutPacked::setup(const uint8_t initial_value)
+{
+    volatile uint8_t* port = get_port();
+
+    if((port == nullptr) || (initial_value > 1))
+        return false;
+
+    avr_port_write(port, get_mask(), (initial_value != 0));
+    avr_port_set_output(port, get_mask(), true);
+    this->packed_pin = this->packed_pin | THE_HAL_AVR_PACKED_INITIALIZED;
+
+    return true;
+}
+
+/* Set GPIO digital out value to logical low */
+THE_HAL_INLINE bool DigitalOutPacked::set_low(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    avr_port_write(get_port(), get_mask(), false);
+
+    return true;
+}
+
+/* Set GPIO digital out value to logical high */
+THE_HAL_INLINE bool DigitalOutPacked::set_high(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    avr_port_write(get_port(), get_mask(), true);
+
+    return true;
+}
+
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOutPacked::toggle(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    avr_port_toggle(get_port(), get_mask());
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Get PORTx register of the pin */
+THE_HAL_INLINE volatile uint8_t* DigitalOutPacked::get_port(void)
+{
+    return avr_port_register_at(
+            (this->packed_pin >> THE_HAL_AVR_PACKED_PORT_SHIFT) &
+            THE_HAL_AVR_PACKED_PORT_MASK);
+}
+
+/* Get mask of the pin in its port */
+THE_HAL_INLINE uint8_t DigitalOutPacked::get_mask(void)
+{
+    return (uint8_t)(1 << (this->packed_pin & THE_HAL_AVR_PACKED_BIT_MASK));
+}
+
+/* Check if GPIO is not configured (setup() was not called) */
+THE_HAL_INLINE bool DigitalOutPacked::gpio_is_not_initialized(void)
+{
+    return ((this->packed_pin & THE_HAL_AVR_PACKED_INITIALIZED) == 0);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_DIGITAL_OUT_PACKED_CPP_ */
+
+#endif /* defined(__AVR__) */
+
+/*****************************************************************************/
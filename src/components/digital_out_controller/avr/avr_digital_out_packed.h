@@ -0,0 +1,106 @@
+
+/**
+ * @file    avr_digital_out_packed.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * RAM-Minimal GPIO Digital Output for AVR devices.
+ *
+ * DigitalOutPacked keeps port index, bit and setup state in a single byte
+ * (DigitalOut needs 3 bytes on AVR and 2 bytes on Arduino), so tens of
+ * output objects fit in small SRAM parts:
+ *
+ *   bit 7     : setup() was called
+ *   bits 6..3 : port (the_hal_avr_port)
+ *   bits 2..0 : pin of the port
+ *
+ *   DigitalOutPacked led(THE_HAL_AVR_PACKED_PIN(THE_HAL_AVR_PORT_B, 5));
+ *
+ * The PORTx register is looked up from the port index on each operation.
+ * Pins known at compile time take no RAM at all using AvrPortPin (see
+ * avr_port_ops.h).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Build Guard */
+#if defined(__AVR__)
+
+/* Include Guard */
+#ifndef THE_HAL_AVR_DIGITAL_OUT_PACKED_H_
+#define THE_HAL_AVR_DIGITAL_OUT_PACKED_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "avr_port_ops.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* DigitalOutPacked pin (i.e. THE_HAL_AVR_PACKED_PIN(THE_HAL_AVR_PORT_B, 5)) */
+#define THE_HAL_AVR_PACKED_PIN(port, bit) \
+    ((uint8_t)((((port) & 0x0f) << 3) | ((bit) & 0x07)))
+
+/*****************************************************************************/
+
+/* Class */
+
+class DigitalOutPacked
+{
+    public:
+        DigitalOutPacked(const uint8_t packed_pin);
+
+        bool setup(const uint8_t initial_value);
+        bool set_low(void);
+        bool set_high(void);
+        bool toggle(void);
+
+    private:
+        uint8_t packed_pin;
+
+        volatile uint8_t* get_port(void);
+        uint8_t get_mask(void);
+        bool gpio_is_not_initialized(void);
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "avr_digital_out_packed.cpp"
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_DIGITAL_OUT_PACKED_H_ */
+#endif /* defined(__AVR__) */
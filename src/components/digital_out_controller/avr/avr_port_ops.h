@@ -0,0 +1,383 @@
+
+/**
+ * @file    avr_port_ops.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Interrupt-Safe Port Operations for AVR devices.
+ *
+ * A "PORTx |= mask" is a read-modify-write of the whole port, so an
+ * interrupt that writes another pin of the same port in the middle gets its
+ * change lost. Each pin uses the cheapest operation that is safe:
+ *
+ *   - SBI/CBI: ports in the I/O addresses 0x00 to 0x1F are set and cleared
+ *     with a single sbi/cbi instruction.
+ *   - PIN_TOGGLE: on devices where writing a 1 to PINx toggles the pin,
+ *     other ports are set/cleared toggling the pin only if it has not the
+ *     requested level (a single store, other pins are never written).
+ *   - ATOMIC_BLOCK: otherwise the read-modify-write is done with interrupts
+ *     disabled (just for those ports, i.e. PORTH to PORTL of ATmega2560 on
+ *     devices without PINx toggle).
+ *
+ * With AvrPortPin (compile time port and bit) the register addresses are
+ * constants and the operation is chosen at compile time (its bit helpers
+ * are the only ones that use sbi/cbi, GCC does not see a pointer argument
+ * as a constant, even once inlined):
+ *
+ *   typedef AvrPortPin<THE_HAL_AVR_PORT_B, 5> Led;
+ *
+ *   Led::setup(0);
+ *   Led::toggle();
+ *
+ * DigitalOut pins (run time port) use the PIN_TOGGLE or ATOMIC_BLOCK ones.
+ * Note that a pin written both from an interrupt and the main code still
+ * needs application synchronization, these operations only protect the
+ * other pins of the port.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Build Guard */
+#if defined(__AVR__)
+
+/* Include Guard */
+#ifndef THE_HAL_AVR_PORT_OPS_H_
+#define THE_HAL_AVR_PORT_OPS_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/*****************************************************************************/
+
+/* Device Capabilities */
+
+/* Old devices where writing PINx does not toggle the pins */
+#if !defined(__AVR_ATmega8__) && !defined(__AVR_ATmega16__) && \
+    !defined(__AVR_ATmega32__) && !defined(__AVR_ATmega64__) && \
+    !defined(__AVR_ATmega128__) && !defined(__AVR_ATmega162__) && \
+    !defined(__AVR_ATmega8515__) && !defined(__AVR_ATmega8535__)
+    #define THE_HAL_AVR_PIN_TOGGLE
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_AVR_PORT_OP_SBI_CBI = 0,
+    THE_HAL_AVR_PORT_OP_PIN_TOGGLE = 1,
+    THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK = 2
+} the_hal_avr_port_op;
+
+typedef enum
+{
+    THE_HAL_AVR_PORT_A = 0,
+    THE_HAL_AVR_PORT_B = 1,
+    THE_HAL_AVR_PORT_C = 2,
+    THE_HAL_AVR_PORT_D = 3,
+    THE_HAL_AVR_PORT_E = 4,
+    THE_HAL_AVR_PORT_F = 5,
+    THE_HAL_AVR_PORT_G = 6,
+    THE_HAL_AVR_PORT_H = 7,
+    THE_HAL_AVR_PORT_J = 8,
+    THE_HAL_AVR_PORT_K = 9,
+    THE_HAL_AVR_PORT_L = 10
+} the_hal_avr_port;
+
+/* DigitalOut io_pin of a port pin (i.e. THE_HAL_AVR_PIN(PORTB, PB5)) */
+#define THE_HAL_AVR_PIN(port_register, bit) \
+    ((uint16_t)(((_SFR_MEM_ADDR(port_register) - __SFR_OFFSET) << 8) | (bit)))
+
+/* Last data memory address reachable by sbi/cbi (I/O address 0x1F) */
+#define THE_HAL_AVR_SBI_CBI_LAST (__SFR_OFFSET + 0x1f)
+
+/*****************************************************************************/
+
+/* Run Time Port Operations */
+
+/* PINx and DDRx registers are just before PORTx (PINx, DDRx, PORTx) */
+
+/* Get the operation used for a port (data memory address of PORTx) */
+static inline the_hal_avr_port_op avr_port_op(volatile uint8_t* port)
+{
+    if((uint16_t)(uintptr_t)port <= THE_HAL_AVR_SBI_CBI_LAST)
+        return THE_HAL_AVR_PORT_OP_SBI_CBI;
+#if defined(THE_HAL_AVR_PIN_TOGGLE)
+    return THE_HAL_AVR_PORT_OP_PIN_TOGGLE;
+#else
+    return THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK;
+#endif
+}
+
+/* Set or clear the bits of mask in a register with interrupts disabled */
+__attribute__((always_inline))
+static inline void avr_port_atomic_write(volatile uint8_t* reg,
+        const uint8_t mask, const bool value)
+{
+    uint8_t sreg = SREG;
+    cli();
+    if(value)
+        *reg = *reg | mask;
+    else
+        *reg = *reg & (uint8_t)(~mask);
+    SREG = sreg;
+}
+
+/* Set the pins of mask to a level without disturbing other port pins */
+__attribute__((always_inline))
+static inline void avr_port_write(volatile uint8_t* port, const uint8_t mask,
+        const bool value)
+{
+    the_hal_avr_port_op op = avr_port_op(port);
+
+    // A run time address is a read-modify-write, never a sbi/cbi
+    if(op == THE_HAL_AVR_PORT_OP_SBI_CBI)
+    {
+        op = THE_HAL_AVR_PORT_OP_ATOMIC_BLOCK;
+#if defined(THE_HAL_AVR_PIN_TOGGLE)
+        op = THE_HAL_AVR_PORT_OP_PIN_TOGGLE;
+#endif
+    }
+
+    if(op == THE_HAL_AVR_PORT_OP_PIN_TOGGLE)
+    {
+        uint8_t toggle = value ? (uint8_t)(~(*port) & mask) :
+                (uint8_t)(*port & mask);
+        if(toggle != 0)
+            *(port - 2) = toggle;
+        return;
+    }
+
+    avr_port_atomic_write(port, mask, value);
+}
+
+/* Invert the pins of mask without disturbing other port pins */
+__attribute__((always_inline))
+static inline void avr_port_toggle(volatile uint8_t* port, const uint8_t mask)
+{
+#if defined(THE_HAL_AVR_PIN_TOGGLE)
+    *(port - 2) = mask;
+#else
+    uint8_t sreg = SREG;
+    cli();
+    *port = *port ^ mask;
+    SREG = sreg;
+#endif
+}
+
+/* Set the pins of mask as outputs (DDRx) or inputs */
+__attribute__((always_inline))
+static inline void avr_port_set_output(volatile uint8_t* port,
+        const uint8_t mask, const bool output)
+{
+    // DDRx is written rarely, always with the plain safe operation
+    avr_port_atomic_write(port - 1, mask, output);
+}
+
+/* Set a single pin of a compile time port to a level (constant address
+ * and bit, so the access of an I/O space port compiles into a sbi/cbi) */
+__attribute__((always_inline))
+static inline void avr_port_write_bit(volatile uint8_t* port,
+        const uint8_t mask, const bool value)
+{
+    if(avr_port_op(port) != THE_HAL_AVR_PORT_OP_SBI_CBI)
+    {
+        avr_port_write(port, mask, value);
+        return;
+    }
+
+    if(value)
+        *port = *port | mask;
+    else
+        *port = *port & (uint8_t)(~mask);
+}
+
+/* Set a single pin of a compile time port as output or input */
+__attribute__((always_inline))
+static inline void avr_port_set_output_bit(volatile uint8_t* port,
+        const uint8_t mask, const bool output)
+{
+    if((uint16_t)(uintptr_t)(port - 1) > THE_HAL_AVR_SBI_CBI_LAST)
+    {
+        avr_port_set_output(port, mask, output);
+        return;
+    }
+
+    if(output)
+        *(port - 1) = *(port - 1) | mask;
+    else
+        *(port - 1) = *(port - 1) & (uint8_t)(~mask);
+}
+
+/*****************************************************************************/
+
+/* Run Time Port Mapping */
+
+/* Get PORTx register of a port index (nullptr if the device has not it) */
+static inline volatile uint8_t* avr_port_register_at(const uint8_t port)
+{
+    switch(port)
+    {
+#if defined(PORTA)
+        case THE_HAL_AVR_PORT_A: return &PORTA;
+#endif
+#if defined(PORTB)
+        case THE_HAL_AVR_PORT_B: return &PORTB;
+#endif
+#if defined(PORTC)
+        case THE_HAL_AVR_PORT_C: return &PORTC;
+#endif
+#if defined(PORTD)
+        case THE_HAL_AVR_PORT_D: return &PORTD;
+#endif
+#if defined(PORTE)
+        case THE_HAL_AVR_PORT_E: return &PORTE;
+#endif
+#if defined(PORTF)
+        case THE_HAL_AVR_PORT_F: return &PORTF;
+#endif
+#if defined(PORTG)
+        case THE_HAL_AVR_PORT_G: return &PORTG;
+#endif
+#if defined(PORTH)
+        case THE_HAL_AVR_PORT_H: return &PORTH;
+#endif
+#if defined(PORTJ)
+        case THE_HAL_AVR_PORT_J: return &PORTJ;
+#endif
+#if defined(PORTK)
+        case THE_HAL_AVR_PORT_K: return &PORTK;
+#endif
+#if defined(PORTL)
+        case THE_HAL_AVR_PORT_L: return &PORTL;
+#endif
+        default: return nullptr;
+    }
+}
+
+/*****************************************************************************/
+
+/* Compile Time Port Mapping */
+
+/* Get PORTx register of a port */
+template <the_hal_avr_port PORT>
+inline volatile uint8_t* avr_port_register(void);
+
+#define THE_HAL_AVR_PORT_REGISTER(letter) \
+    template <> \
+    inline volatile uint8_t* avr_port_register<THE_HAL_AVR_PORT_##letter>( \
+            void) \
+    { return &PORT##letter; }
+
+#if defined(PORTA)
+    THE_HAL_AVR_PORT_REGISTER(A)
+#endif
+#if defined(PORTB)
+    THE_HAL_AVR_PORT_REGISTER(B)
+#endif
+#if defined(PORTC)
+    THE_HAL_AVR_PORT_REGISTER(C)
+#endif
+#if defined(PORTD)
+    THE_HAL_AVR_PORT_REGISTER(D)
+#endif
+#if defined(PORTE)
+    THE_HAL_AVR_PORT_REGISTER(E)
+#endif
+#if defined(PORTF)
+    THE_HAL_AVR_PORT_REGISTER(F)
+#endif
+#if defined(PORTG)
+    THE_HAL_AVR_PORT_REGISTER(G)
+#endif
+#if defined(PORTH)
+    THE_HAL_AVR_PORT_REGISTER(H)
+#endif
+#if defined(PORTJ)
+    THE_HAL_AVR_PORT_REGISTER(J)
+#endif
+#if defined(PORTK)
+    THE_HAL_AVR_PORT_REGISTER(K)
+#endif
+#if defined(PORTL)
+    THE_HAL_AVR_PORT_REGISTER(L)
+#endif
+
+/*****************************************************************************/
+
+/* Class */
+
+/* Port pin known at compile time (inlined to its register operation, used
+ * through its type so it takes no RAM) */
+template <the_hal_avr_port PORT, uint8_t BIT>
+struct AvrPortPin
+{
+    static_assert(BIT < 8, "AVR ports have 8 pins");
+
+    static const uint8_t mask = (uint8_t)(1 << BIT);
+
+    /* Get the operation chosen for the pin */
+    __attribute__((always_inline))
+    static inline the_hal_avr_port_op get_op(void)
+    { return avr_port_op(avr_port_register<PORT>()); }
+
+    /* Set initial level and configure the pin as output */
+    __attribute__((always_inline))
+    static inline void setup(const uint8_t initial_value)
+    {
+        avr_port_write_bit(avr_port_register<PORT>(), mask,
+                initial_value != 0);
+        avr_port_set_output_bit(avr_port_register<PORT>(), mask, true);
+    }
+
+    /* Set pin to logical low */
+    __attribute__((always_inline))
+    static inline void set_low(void)
+    { avr_port_write_bit(avr_port_register<PORT>(), mask, false); }
+
+    /* Set pin to logical high */
+    __attribute__((always_inline))
+    static inline void set_high(void)
+    { avr_port_write_bit(avr_port_register<PORT>(), mask, true); }
+
+    /* Invert pin level */
+    __attribute__((always_inline))
+    static inline void toggle(void)
+    { avr_port_toggle(avr_port_register<PORT>(), mask); }
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_AVR_PORT_OPS_H_ */
+#endif /* defined(__AVR__) */
@@ -56,11 +56,22 @@
     #include "sam_asf/sam_asf_digital_out.h"
 #elif defined(__AVR__)
     #include "avr/avr_digital_out.h"
+#elif defined(LINUX_GPIO)
+    #include "linux/linux_digital_out.h"
 #else
     #include "dummy/dummy_digital_out.h"
 #endif
 
 /*****************************************************************************/
 
+/* HAL Extensions */
+
+#if defined(__AVR__)
+    #include "avr/avr_port_ops.h"
+    #include "avr/avr_digital_out_packed.h"
+#endif
+
+/*****************************************************************************/
+
 #endif // THE_HAL_DIGITAL_OUT_H_
 #endif // THE_HAL_COMPONENT_DIGITAL_OUT
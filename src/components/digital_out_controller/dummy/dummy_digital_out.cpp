@@ -30,10 +30,21 @@
 
 /*****************************************************************************/
 
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
 /* Build Guard */
 
 #if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
-    !defined(__AVR__)
+    !defined(__AVR__) and !defined(LINUX_GPIO)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_DUMMY_DIGITAL_OUT_CPP_
+#define THE_HAL_DUMMY_DIGITAL_OUT_CPP_
 
 /*****************************************************************************/
 
@@ -41,16 +52,20 @@
 
 #include "dummy_digital_out.h"
 
+#include "../../host_sim_controller/host_sim.h"
+
 /*****************************************************************************/
 
 /* Constructor */
 
 /* DigitalOut constructor */
-DigitalOut::DigitalOut(const int8_t _io_pin)
-{}
+THE_HAL_INLINE DigitalOut::DigitalOut(const int8_t _io_pin)
+{
+    this->io_pin = _io_pin;
+}
 
 /* DigitalOut destructor */
-DigitalOut::~DigitalOut()
+THE_HAL_INLINE DigitalOut::~DigitalOut()
 {}
 
 /*****************************************************************************/
@@ -58,16 +73,135 @@ DigitalOut::~DigitalOut()
 /* Public Methods */
 
 /* Initialize GPIO as digital output and set them to an initial logic value */
-bool DigitalOut::setup(const uint8_t initial_value)
-{ return true; }
+THE_HAL_INLINE bool DigitalOut::setup(const uint8_t initial_value)
+{ return HostSim::write_pin(this->io_pin, (initial_value != 0)); }
+
+/* Initialize GPIO as open-drain output (high releases the line, that reads
+ * low while a simulated device pulls it low) */
+THE_HAL_INLINE bool DigitalOut::setup_open_drain(const uint8_t initial_value)
+{ return HostSim::write_pin(this->io_pin, (initial_value != 0)); }
 
 /* Set GPIO digital out value to logical low */
-bool DigitalOut::set_low(void)
-{ return true; }
+THE_HAL_INLINE bool DigitalOut::set_low(void)
+{ return HostSim::write_pin(this->io_pin, false); }
 
 /* Set GPIO digital out value to logical high */
-bool DigitalOut::set_high(void)
-{ return true; }
+THE_HAL_INLINE bool DigitalOut::set_high(void)
+{ return HostSim::write_pin(this->io_pin, true); }
+
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOut::toggle(void)
+{ return HostSim::write_pin(this->io_pin, !HostSim::read_pin(this->io_pin)); }
+
+/* Get GPIO line level (i.e. an open-drain line held low by a device) */
+THE_HAL_INLINE bool DigitalOut::read(void)
+{ return HostSim::read_pin(this->io_pin); }
+
+/*****************************************************************************/
+
+/* DigitalOutBus Constructor */
+
+/* DigitalOutBus constructor */
+THE_HAL_INLINE DigitalOutBus::DigitalOutBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->bus_mask = 0;
+    if(num_pins > THE_HAL_DIGITAL_OUT_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+    {
+        this->io_pins[i] = io_pins[i];
+        this->bus_mask = this->bus_mask | (1UL << i);
+    }
+    this->num_pins = num_pins;
+}
+
+/* DigitalOutBus destructor */
+THE_HAL_INLINE DigitalOutBus::~DigitalOutBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Public Methods */
+
+/* Initialize all bus GPIOs as digital outputs with initial logic values */
+THE_HAL_INLINE bool DigitalOutBus::setup(const uint32_t initial_values)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(HostSim::is_a_invalid_pin(this->io_pins[i]))
+            return false;
+    }
+
+    return write(initial_values);
+}
+
+/* Set all bus GPIOs values (bit N is the value of the Nth GPIO) */
+THE_HAL_INLINE bool DigitalOutBus::write(const uint32_t values)
+{
+    return write_masked(values & this->bus_mask, ~values & this->bus_mask);
+}
+
+/* Set to high the bus GPIOs of set_mask and to low the ones of clear_mask */
+THE_HAL_INLINE bool DigitalOutBus::write_masked(const uint32_t set_mask,
+        const uint32_t clear_mask)
+{
+    the_hal_digital_out_bus_prepared prepared;
+
+    if(!prepare(set_mask, clear_mask, &prepared))
+        return false;
+
+    return write_prepared(&prepared);
+}
+
+/* Translate bus set/clear masks once, so the same write can be repeated
+ * later at a fixed cost (i.e. from an interrupt) */
+THE_HAL_INLINE bool DigitalOutBus::prepare(const uint32_t set_mask,
+        const uint32_t clear_mask, the_hal_digital_out_bus_prepared* prepared)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    // Translate bus bits into ports bits
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        prepared->set[port] = 0;
+        prepared->clear[port] = 0;
+    }
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        uint8_t port = HostSim::get_pin_port(this->io_pins[i]);
+        uint32_t mask = HostSim::get_pin_mask(this->io_pins[i]);
+        if(set_mask & (1UL << i))
+            prepared->set[port] = prepared->set[port] | mask;
+        else if(clear_mask & (1UL << i))
+            prepared->clear[port] = prepared->clear[port] | mask;
+    }
+
+    return true;
+}
+
+/* Write prepared ports masks (each port is written once) */
+THE_HAL_INLINE bool DigitalOutBus::write_prepared(
+        const the_hal_digital_out_bus_prepared* prepared)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        if(prepared->set[port] | prepared->clear[port])
+            HostSim::write_port(port, prepared->set[port] |
+                    prepared->clear[port], prepared->set[port]);
+    }
+
+    return true;
+}
 
 /*****************************************************************************/
 
@@ -76,6 +210,8 @@ bool DigitalOut::set_high(void)
 
 /*****************************************************************************/
 
+#endif /* THE_HAL_DUMMY_DIGITAL_OUT_CPP_ */
+
 #endif /* !defined(ARDUINO) and !defined(ESP_IDF) and ... */
 
 /*****************************************************************************/
@@ -43,10 +43,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "../../host_sim_controller/host_sim.h"
+
 /*****************************************************************************/
 
 /* Constants */
 
+/* Maximum number of GPIOs that can be grouped in a DigitalOutBus */
+#define THE_HAL_DIGITAL_OUT_BUS_MAX_PINS 32
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Bus values translated to ports masks (see DigitalOutBus::prepare()) */
+typedef struct
+{
+    uint32_t set[THE_HAL_HOST_SIM_NUM_PORTS];
+    uint32_t clear[THE_HAL_HOST_SIM_NUM_PORTS];
+} the_hal_digital_out_bus_prepared;
 
 /*****************************************************************************/
 
@@ -59,10 +74,44 @@ class DigitalOut
         ~DigitalOut();
 
         bool setup(const uint8_t initial_value);
+        bool setup_open_drain(const uint8_t initial_value);
         bool set_low(void);
         bool set_high(void);
+        bool toggle(void);
+        bool read(void);
+
+    private:
+        int8_t io_pin;
+};
+
+class DigitalOutBus
+{
+    public:
+        DigitalOutBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalOutBus();
+
+        bool setup(const uint32_t initial_values);
+        bool write(const uint32_t values);
+        bool write_masked(const uint32_t set_mask, const uint32_t clear_mask);
+
+        bool prepare(const uint32_t set_mask, const uint32_t clear_mask,
+                the_hal_digital_out_bus_prepared* prepared);
+        bool write_prepared(const the_hal_digital_out_bus_prepared* prepared);
+
+    private:
+        int8_t io_pins[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        uint8_t num_pins;
+        uint32_t bus_mask;
 };
 
 /*****************************************************************************/
 
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "dummy_digital_out.cpp"
+#endif
+
+/*****************************************************************************/
+
 #endif /* THE_HAL_DUMMY_DIGITAL_OUT_H_ */
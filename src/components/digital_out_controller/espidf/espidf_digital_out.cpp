@@ -30,10 +30,21 @@
 
 /*****************************************************************************/
 
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
 /* Build Guard */
 
 #if defined(ESP_IDF)
 
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_ESPIDF_DIGITAL_OUT_CPP_
+#define THE_HAL_ESPIDF_DIGITAL_OUT_CPP_
+
 /*****************************************************************************/
 
 /* Libraries */
@@ -41,6 +52,8 @@
 #include "espidf_digital_out.h"
 
 #include <driver/gpio.h>
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
 
 /*****************************************************************************/
 
@@ -48,22 +61,24 @@
 
 typedef enum
 {
-    UNDEFINED = -1
-} the_hal_digital_out_constants;
+    THE_HAL_ESPIDF_DIGITAL_OUT_UNDEFINED = -1,
+    THE_HAL_ESPIDF_GPIO_REG_BITS = 32
+} the_hal_espidf_digital_out_constants;
 
 /*****************************************************************************/
 
 /* Constructor */
 
 /* DigitalOut constructor */
-DigitalOut::DigitalOut(const int8_t io_pin)
+THE_HAL_INLINE DigitalOut::DigitalOut(const int8_t io_pin)
 {
     this->io_pin = io_pin;
     this->io_val = -1;
+    this->open_drain = false;
 }
 
 /* DigitalOut destructor */
-DigitalOut::~DigitalOut()
+THE_HAL_INLINE DigitalOut::~DigitalOut()
 {}
 
 /*****************************************************************************/
@@ -71,12 +86,13 @@ DigitalOut::~DigitalOut()
 /* Public Methods */
 
 /* Initialize GPIO as digital output and set them to an initial logic value */
-bool DigitalOut::setup(const uint8_t initial_value)
+THE_HAL_INLINE bool DigitalOut::setup(const uint8_t initial_value)
 {
     if(is_a_invalid_digital_value(initial_value))
         return false;
 
     this->io_val = initial_value;
+    this->open_drain = false;
     gpio_pad_select_gpio((gpio_num_t)this->io_pin);
     if(gpio_set_level((gpio_num_t)this->io_pin, (uint32_t)initial_value) != ESP_OK)
         return false;
@@ -86,46 +102,87 @@ bool DigitalOut::setup(const uint8_t initial_value)
     return true;
 }
 
+/* Initialize GPIO as open-drain output (high releases the line), with the
+ * input kept enabled to read the line level */
+THE_HAL_INLINE bool DigitalOut::setup_open_drain(const uint8_t initial_value)
+{
+    if(is_a_invalid_digital_value(initial_value))
+        return false;
+
+    this->io_val = initial_value;
+    this->open_drain = true;
+    gpio_pad_select_gpio((gpio_num_t)this->io_pin);
+    if(gpio_set_level((gpio_num_t)this->io_pin,
+            (uint32_t)initial_value) != ESP_OK)
+        return false;
+    if(gpio_set_direction((gpio_num_t)this->io_pin,
+            GPIO_MODE_INPUT_OUTPUT_OD) != ESP_OK)
+        return false;
+
+    return true;
+}
+
 /* Set GPIO digital out value to logical low */
-bool DigitalOut::set_low(void)
+THE_HAL_INLINE bool DigitalOut::set_low(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = 0;
-    if(gpio_set_level((gpio_num_t)gpio, this->io_val) != ESP_OK)
+    if(gpio_set_level((gpio_num_t)this->io_pin, this->io_val) != ESP_OK)
         return false;
 
     return true;
 }
 
 /* Set GPIO digital out value to logical high */
-bool DigitalOut::set_high(void)
+THE_HAL_INLINE bool DigitalOut::set_high(void)
 {
     if(gpio_is_not_initialized())
         return false;
 
     this->io_val = 1;
-    if(gpio_set_level((gpio_num_t)gpio, this->io_val) != ESP_OK)
+    if(gpio_set_level((gpio_num_t)this->io_pin, this->io_val) != ESP_OK)
+        return false;
+
+    return true;
+}
+
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOut::toggle(void)
+{
+    if(gpio_is_not_initialized())
+        return false;
+
+    this->io_val = (this->io_val == 0) ? 1 : 0;
+    if(gpio_set_level((gpio_num_t)this->io_pin, this->io_val) != ESP_OK)
         return false;
 
     return true;
 }
 
+/* Get GPIO line level (i.e. an open-drain line held low by a device) */
+THE_HAL_INLINE bool DigitalOut::read(void)
+{
+    if(!this->open_drain)
+        return (this->io_val == 1);
+    return (gpio_get_level((gpio_num_t)this->io_pin) != 0);
+}
+
 /*****************************************************************************/
 
 /* Private Methods */
 
 /* Check if GPIO is not configured (setup() was not called). */
-bool DigitalOut::gpio_is_not_initialized(void)
+THE_HAL_INLINE bool DigitalOut::gpio_is_not_initialized(void)
 {
-    if(this->io_val == UNDEFINED)
+    if(this->io_val != THE_HAL_ESPIDF_DIGITAL_OUT_UNDEFINED)
         return false;
     return true;
 }
 
 /* Check if provided value is not a valid digital value */
-bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
+THE_HAL_INLINE bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
 {
     if((value == 0) || (value == 1))
         return false;
@@ -134,6 +191,142 @@ bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
 
 /*****************************************************************************/
 
+/* DigitalOutBus Constructor */
+
+/* DigitalOutBus constructor */
+THE_HAL_INLINE DigitalOutBus::DigitalOutBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->bus_mask = 0;
+    this->initialized = false;
+    if(num_pins > THE_HAL_DIGITAL_OUT_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+    {
+        this->io_pins[i] = io_pins[i];
+        this->bus_mask = this->bus_mask | (1UL << i);
+    }
+    this->num_pins = num_pins;
+}
+
+/* DigitalOutBus destructor */
+THE_HAL_INLINE DigitalOutBus::~DigitalOutBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Public Methods */
+
+/* Initialize all bus GPIOs as digital outputs with initial logic values */
+THE_HAL_INLINE bool DigitalOutBus::setup(const uint32_t initial_values)
+{
+    gpio_config_t config = {};
+
+    if(this->num_pins == 0)
+        return false;
+
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(!GPIO_IS_VALID_OUTPUT_GPIO(this->io_pins[i]))
+            return false;
+        config.pin_bit_mask |= (1ULL << this->io_pins[i]);
+    }
+    config.mode = GPIO_MODE_OUTPUT;
+
+    this->initialized = true;
+    write(initial_values);
+    if(gpio_config(&config) != ESP_OK)
+    {
+        this->initialized = false;
+        return false;
+    }
+
+    return true;
+}
+
+/* Set all bus GPIOs values (bit N is the value of the Nth GPIO) */
+THE_HAL_INLINE bool DigitalOutBus::write(const uint32_t values)
+{
+    return write_masked(values & this->bus_mask, ~values & this->bus_mask);
+}
+
+/* Set to high the bus GPIOs of set_mask and to low the ones of clear_mask */
+THE_HAL_INLINE bool DigitalOutBus::write_masked(const uint32_t set_mask,
+        const uint32_t clear_mask)
+{
+    the_hal_digital_out_bus_prepared prepared;
+
+    if(!prepare(set_mask, clear_mask, &prepared))
+        return false;
+
+    return write_prepared(&prepared);
+}
+
+/* Translate bus set/clear masks once, so the same write can be repeated
+ * later at a fixed cost (i.e. from an interrupt) */
+THE_HAL_INLINE bool DigitalOutBus::prepare(const uint32_t set_mask,
+        const uint32_t clear_mask, the_hal_digital_out_bus_prepared* prepared)
+{
+    if(!this->initialized)
+        return false;
+
+    // Translate bus bits into GPIO numbers bits
+    prepared->gpio_set = 0;
+    prepared->gpio_clear = 0;
+    for(uint8_t i = 0; i < this->num_pins; i++)
+    {
+        if(set_mask & (1UL << i))
+            prepared->gpio_set = prepared->gpio_set |
+                    (1ULL << this->io_pins[i]);
+        else if(clear_mask & (1UL << i))
+            prepared->gpio_clear = prepared->gpio_clear |
+                    (1ULL << this->io_pins[i]);
+    }
+
+    return true;
+}
+
+/* Write prepared GPIO masks (no translation nor read-modify-write) */
+THE_HAL_INLINE bool DigitalOutBus::write_prepared(
+        const the_hal_digital_out_bus_prepared* prepared)
+{
+    if(!this->initialized)
+        return false;
+
+    gpio_write_masks(prepared->gpio_set, prepared->gpio_clear);
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Private Methods */
+
+/* Low Level function to set/clear GPIOs through the W1TS/W1TC Registers */
+THE_HAL_INLINE void DigitalOutBus::gpio_write_masks(const uint64_t gpio_set,
+        const uint64_t gpio_clear)
+{
+    // Write 1 to set/clear registers are atomic, no read-modify-write
+    if((uint32_t)gpio_set)
+        REG_WRITE(GPIO_OUT_W1TS_REG, (uint32_t)gpio_set);
+    if((uint32_t)gpio_clear)
+        REG_WRITE(GPIO_OUT_W1TC_REG, (uint32_t)gpio_clear);
+#if defined(GPIO_OUT1_W1TS_REG)
+    if(gpio_set >> THE_HAL_ESPIDF_GPIO_REG_BITS)
+        REG_WRITE(GPIO_OUT1_W1TS_REG,
+                (uint32_t)(gpio_set >> THE_HAL_ESPIDF_GPIO_REG_BITS));
+    if(gpio_clear >> THE_HAL_ESPIDF_GPIO_REG_BITS)
+        REG_WRITE(GPIO_OUT1_W1TC_REG,
+                (uint32_t)(gpio_clear >> THE_HAL_ESPIDF_GPIO_REG_BITS));
+#endif
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_ESPIDF_DIGITAL_OUT_CPP_ */
+
 #endif /* defined(ESP_IDF) */
 
 /*****************************************************************************/
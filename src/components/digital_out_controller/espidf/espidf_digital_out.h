@@ -47,6 +47,19 @@
 
 /* Constants */
 
+/* Maximum number of GPIOs that can be grouped in a DigitalOutBus */
+#define THE_HAL_DIGITAL_OUT_BUS_MAX_PINS 32
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Bus values translated to GPIO masks (see DigitalOutBus::prepare()) */
+typedef struct
+{
+    uint64_t gpio_set;
+    uint64_t gpio_clear;
+} the_hal_digital_out_bus_prepared;
 
 /*****************************************************************************/
 
@@ -59,17 +72,53 @@ class DigitalOut
         ~DigitalOut();
 
         bool setup(const uint8_t initial_value = 0);
+        bool setup_open_drain(const uint8_t initial_value = 1);
         bool set_low(void);
         bool set_high(void);
+        bool toggle(void);
+        bool read(void);
 
     private:
         int8_t io_pin;
         int8_t io_val;
+        bool open_drain;
 
         bool gpio_is_not_initialized(void);
         bool is_a_invalid_digital_value(const uint8_t value);
 };
 
+class DigitalOutBus
+{
+    public:
+        DigitalOutBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalOutBus();
+
+        bool setup(const uint32_t initial_values);
+        bool write(const uint32_t values);
+        bool write_masked(const uint32_t set_mask, const uint32_t clear_mask);
+
+        bool prepare(const uint32_t set_mask, const uint32_t clear_mask,
+                the_hal_digital_out_bus_prepared* prepared);
+        bool write_prepared(const the_hal_digital_out_bus_prepared* prepared);
+
+    private:
+        int8_t io_pins[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        uint8_t num_pins;
+        uint32_t bus_mask;
+        bool initialized;
+
+        void gpio_write_masks(const uint64_t gpio_set,
+                const uint64_t gpio_clear);
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "espidf_digital_out.cpp"
+#endif
+
 /*****************************************************************************/
 
 #endif /* THE_HAL_ESPIDF_DIGITAL_OUT_H_ */
@@ -0,0 +1,260 @@
+
+/**
+ * @file    linux_digital_out.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Output Controller for Linux devices (gpiochip character
+ * device v2 uAPI, i.e. SBC gateways).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(LINUX_GPIO)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_LINUX_DIGITAL_OUT_CPP_
+#define THE_HAL_LINUX_DIGITAL_OUT_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "linux_digital_out.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_LINUX_DIGITAL_OUT_UNDEFINED = -1
+} the_hal_linux_digital_out_constants;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalOut constructor */
+THE_HAL_INLINE DigitalOut::DigitalOut(const int8_t io_pin)
+{
+    this->io_pin = io_pin;
+    this->io_val = THE_HAL_LINUX_DIGITAL_OUT_UNDEFINED;
+}
+
+/* DigitalOut destructor */
+THE_HAL_INLINE DigitalOut::~DigitalOut()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize GPIO as digital output and set them to an initial logic value */
+THE_HAL_INLINE bool DigitalOut::setup(const uint8_t initial_value)
+{
+    return setup_line(GPIO_V2_LINE_FLAG_OUTPUT, initial_value);
+}
+
+/* Initialize GPIO as open-drain output (high releases the line) */
+THE_HAL_INLINE bool DigitalOut::setup_open_drain(const uint8_t initial_value)
+{
+    return setup_line(GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN,
+            initial_value);
+}
+
+/* Set GPIO digital out value to logical low */
+THE_HAL_INLINE bool DigitalOut::set_low(void)
+{
+    if(!this->line.set_values(0, 1))
+        return false;
+
+    this->io_val = 0;
+    return true;
+}
+
+/* Set GPIO digital out value to logical high */
+THE_HAL_INLINE bool DigitalOut::set_high(void)
+{
+    if(!this->line.set_values(1, 1))
+        return false;
+
+    this->io_val = 1;
+    return true;
+}
+
+/* Invert GPIO digital out value */
+THE_HAL_INLINE bool DigitalOut::toggle(void)
+{
+    int8_t value = (this->io_val == 0) ? 1 : 0;
+
+    if(!this->line.set_values(value, 1))
+        return false;
+
+    this->io_val = value;
+    return true;
+}
+
+/* Get GPIO line level (i.e. an open-drain line held low by a device) */
+THE_HAL_INLINE bool DigitalOut::read(void)
+{
+    uint32_t values = 0;
+
+    this->line.get_values(&values);
+    return (values != 0);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Check if provided value is not a valid digital value */
+THE_HAL_INLINE bool DigitalOut::is_a_invalid_digital_value(const uint8_t value)
+{
+    if((value == 0) || (value == 1))
+        return false;
+    return true;
+}
+
+/* Request the line, or change the flags of the already requested one (i.e.
+ * from open-drain back to push-pull output) */
+THE_HAL_INLINE bool DigitalOut::setup_line(const uint64_t flags,
+        const uint8_t initial_value)
+{
+    if(is_a_invalid_digital_value(initial_value))
+        return false;
+
+    if(this->line.is_requested())
+    {
+        if(!this->line.reconfigure(flags, initial_value))
+            return false;
+    }
+    else if(!this->line.request(&this->io_pin, 1, flags, initial_value))
+        return false;
+    this->io_val = initial_value;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Constructor */
+
+/* DigitalOutBus constructor */
+THE_HAL_INLINE DigitalOutBus::DigitalOutBus(const int8_t* io_pins,
+        const uint8_t num_pins)
+{
+    this->num_pins = 0;
+    this->bus_mask = 0;
+    if(num_pins > THE_HAL_DIGITAL_OUT_BUS_MAX_PINS)
+        return;
+
+    for(uint8_t i = 0; i < num_pins; i++)
+    {
+        this->io_pins[i] = io_pins[i];
+        this->bus_mask = this->bus_mask | (1UL << i);
+    }
+    this->num_pins = num_pins;
+}
+
+/* DigitalOutBus destructor */
+THE_HAL_INLINE DigitalOutBus::~DigitalOutBus()
+{}
+
+/*****************************************************************************/
+
+/* DigitalOutBus Public Methods */
+
+/* Initialize all bus GPIOs as digital outputs with initial logic values */
+THE_HAL_INLINE bool DigitalOutBus::setup(const uint32_t initial_values)
+{
+    if(this->num_pins == 0)
+        return false;
+
+    if(this->lines.is_requested())
+        return write(initial_values);
+
+    return this->lines.request(this->io_pins, this->num_pins,
+            GPIO_V2_LINE_FLAG_OUTPUT, initial_values & this->bus_mask);
+}
+
+/* Set all bus GPIOs values (bit N is the value of the Nth GPIO) */
+THE_HAL_INLINE bool DigitalOutBus::write(const uint32_t values)
+{
+    return write_masked(values & this->bus_mask, ~values & this->bus_mask);
+}
+
+/* Set to high the bus GPIOs of set_mask and to low the ones of clear_mask */
+THE_HAL_INLINE bool DigitalOutBus::write_masked(const uint32_t set_mask,
+        const uint32_t clear_mask)
+{
+    the_hal_digital_out_bus_prepared prepared;
+
+    if(!prepare(set_mask, clear_mask, &prepared))
+        return false;
+
+    return write_prepared(&prepared);
+}
+
+/* Translate bus set/clear masks once, so the same write can be repeated
+ * later at a fixed cost (i.e. from an interrupt) */
+THE_HAL_INLINE bool DigitalOutBus::prepare(const uint32_t set_mask,
+        const uint32_t clear_mask, the_hal_digital_out_bus_prepared* prepared)
+{
+    if(!this->lines.is_requested())
+        return false;
+
+    // Bus bit N is the Nth line of the request, no translation is needed
+    prepared->values = set_mask;
+    prepared->mask = (set_mask | clear_mask) & this->bus_mask;
+
+    return true;
+}
+
+/* Write prepared line values (a single ioctl) */
+THE_HAL_INLINE bool DigitalOutBus::write_prepared(
+        const the_hal_digital_out_bus_prepared* prepared)
+{
+    if(prepared->mask == 0)
+        return this->lines.is_requested();
+
+    return this->lines.set_values(prepared->values, prepared->mask);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_DIGITAL_OUT_CPP_ */
+
+#endif /* defined(LINUX_GPIO) */
+
+/*****************************************************************************/
@@ -0,0 +1,125 @@
+
+/**
+ * @file    linux_digital_out.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * GPIO Digital Output Controller for Linux devices (gpiochip character
+ * device v2 uAPI, i.e. SBC gateways).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_LINUX_DIGITAL_OUT_H_
+#define THE_HAL_LINUX_DIGITAL_OUT_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../linux_gpio_controller/linux_gpio.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Maximum number of GPIOs that can be grouped in a DigitalOutBus */
+#define THE_HAL_DIGITAL_OUT_BUS_MAX_PINS THE_HAL_LINUX_GPIO_MAX_LINES
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Bus values ready for a line request write (see DigitalOutBus::prepare()) */
+typedef struct
+{
+    uint32_t values;
+    uint32_t mask;
+} the_hal_digital_out_bus_prepared;
+
+/*****************************************************************************/
+
+/* Class */
+
+class DigitalOut
+{
+    public:
+        DigitalOut(const int8_t io_pin);
+        ~DigitalOut();
+
+        bool setup(const uint8_t initial_value);
+        bool setup_open_drain(const uint8_t initial_value);
+        bool set_low(void);
+        bool set_high(void);
+        bool toggle(void);
+        bool read(void);
+
+    private:
+        LinuxGpioLines line;
+        int8_t io_pin;
+        int8_t io_val;
+
+        bool is_a_invalid_digital_value(const uint8_t value);
+        bool setup_line(const uint64_t flags, const uint8_t initial_value);
+};
+
+/* All bus GPIOs share one line request, so each write is a single ioctl */
+class DigitalOutBus
+{
+    public:
+        DigitalOutBus(const int8_t* io_pins, const uint8_t num_pins);
+        ~DigitalOutBus();
+
+        bool setup(const uint32_t initial_values);
+        bool write(const uint32_t values);
+        bool write_masked(const uint32_t set_mask, const uint32_t clear_mask);
+
+        bool prepare(const uint32_t set_mask, const uint32_t clear_mask,
+                the_hal_digital_out_bus_prepared* prepared);
+        bool write_prepared(const the_hal_digital_out_bus_prepared* prepared);
+
+    private:
+        LinuxGpioLines lines;
+        int8_t io_pins[THE_HAL_DIGITAL_OUT_BUS_MAX_PINS];
+        uint8_t num_pins;
+        uint32_t bus_mask;
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "linux_digital_out.cpp"
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_DIGITAL_OUT_H_ */
@@ -0,0 +1,212 @@
+
+/**
+ * @file    digital_out_queue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free Multiple Producer Single Consumer GPIO Digital Output Commands
+ * Queue.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE == 1
+
+#if defined(__AVR__)
+    #error "DigitalOutQueue requires 32 bits atomic operations"
+#endif
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "digital_out_queue.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    QUEUE_MASK = (THE_HAL_DIGITAL_OUT_QUEUE_SIZE - 1),
+    MAX_BUS_PINS = 32
+} the_hal_digital_out_queue_constants;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DigitalOutQueue constructor */
+DigitalOutQueue::DigitalOutQueue(DigitalOutBus* bus)
+{
+    this->bus = bus;
+    this->enqueue_position = 0;
+    this->dequeue_position = 0;
+    this->dropped_commands = 0;
+
+    // Slot N is free for the producer that gets enqueue position N
+    for(uint32_t i = 0; i < THE_HAL_DIGITAL_OUT_QUEUE_SIZE; i++)
+        this->slots[i].sequence = i;
+}
+
+/* DigitalOutQueue destructor */
+DigitalOutQueue::~DigitalOutQueue()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Queue a command to set a bus GPIO to logical high (any thread) */
+bool DigitalOutQueue::set_high(const uint8_t bus_pin)
+{
+    if(bus_pin >= MAX_BUS_PINS)
+        return false;
+
+    return push((1UL << bus_pin), 0);
+}
+
+/* Queue a command to set a bus GPIO to logical low (any thread) */
+bool DigitalOutQueue::set_low(const uint8_t bus_pin)
+{
+    if(bus_pin >= MAX_BUS_PINS)
+        return false;
+
+    return push(0, (1UL << bus_pin));
+}
+
+/* Queue a command to set/clear several bus GPIOs at once (any thread) */
+bool DigitalOutQueue::push(const uint32_t set_mask, const uint32_t clear_mask)
+{
+    the_hal_digital_out_queue_slot* slot;
+    uint32_t position;
+    int32_t diff;
+
+    position = __atomic_load_n(&this->enqueue_position, __ATOMIC_RELAXED);
+    while(true)
+    {
+        slot = &(this->slots[position & QUEUE_MASK]);
+        diff = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE)
+                - position);
+
+        // Slot is free, try to claim it (position is reloaded on failure)
+        if(diff == 0)
+        {
+            if(__atomic_compare_exchange_n(&this->enqueue_position,
+                    &position, position + 1, true, __ATOMIC_RELAXED,
+                    __ATOMIC_RELAXED))
+                break;
+        }
+        else if(diff < 0)
+        {
+            __atomic_fetch_add(&this->dropped_commands, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+        else
+            position = __atomic_load_n(&this->enqueue_position,
+                    __ATOMIC_RELAXED);
+    }
+
+    slot->set_mask = set_mask;
+    slot->clear_mask = clear_mask;
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/* Apply queued commands to the bus (GPIO owner loop, single thread) */
+uint16_t DigitalOutQueue::process(void)
+{
+    uint32_t set_mask = 0;
+    uint32_t clear_mask = 0;
+    uint32_t command_set;
+    uint32_t command_clear;
+    uint16_t num_commands = 0;
+
+    while(num_commands < THE_HAL_DIGITAL_OUT_QUEUE_MAX_BATCH)
+    {
+        if(!pop(&command_set, &command_clear))
+            break;
+
+        // A command that reverts a pending pin change would hide it (i.e.
+        // a pulse), so flush what has been merged until now
+        if((command_set & clear_mask) || (command_clear & set_mask))
+        {
+            this->bus->write_masked(set_mask, clear_mask);
+            set_mask = 0;
+            clear_mask = 0;
+        }
+        set_mask = set_mask | command_set;
+        clear_mask = (clear_mask | command_clear) & ~set_mask;
+        num_commands = num_commands + 1;
+    }
+
+    if(set_mask | clear_mask)
+        this->bus->write_masked(set_mask, clear_mask);
+
+    return num_commands;
+}
+
+/* Get number of commands dropped due to full queue */
+uint32_t DigitalOutQueue::get_dropped_commands(void)
+{
+    return __atomic_load_n(&this->dropped_commands, __ATOMIC_RELAXED);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Get next published command and release its slot to producers */
+bool DigitalOutQueue::pop(uint32_t* set_mask, uint32_t* clear_mask)
+{
+    uint32_t position = this->dequeue_position;
+    the_hal_digital_out_queue_slot* slot =
+            &(this->slots[position & QUEUE_MASK]);
+
+    if(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != (position + 1))
+        return false;
+
+    *set_mask = slot->set_mask;
+    *clear_mask = slot->clear_mask;
+    __atomic_store_n(&slot->sequence,
+            position + THE_HAL_DIGITAL_OUT_QUEUE_SIZE, __ATOMIC_RELEASE);
+    this->dequeue_position = position + 1;
+
+    return true;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,109 @@
+
+/**
+ * @file    digital_out_queue.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free Multiple Producer Single Consumer GPIO Digital Output Commands
+ * Queue.
+ *
+ * Any task/thread/core can push set/clear commands for the pins of a
+ * DigitalOutBus, while a single GPIO owner loop calls process() to drain
+ * them, merging consecutive commands into one set/clear masks write.
+ * Producers never block, when the queue is full the command is dropped and
+ * counted.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE == 1
+
+/* Include Guard */
+#ifndef THE_HAL_DIGITAL_OUT_QUEUE_H_
+#define THE_HAL_DIGITAL_OUT_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of commands slots of each queue (must be a power of 2) */
+#define THE_HAL_DIGITAL_OUT_QUEUE_SIZE 64
+
+/* Maximum number of commands merged by each process() call */
+#define THE_HAL_DIGITAL_OUT_QUEUE_MAX_BATCH 32
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t set_mask;
+    uint32_t clear_mask;
+} the_hal_digital_out_queue_slot;
+
+/*****************************************************************************/
+
+/* Class */
+
+class DigitalOutQueue
+{
+    public:
+        DigitalOutQueue(DigitalOutBus* bus);
+        ~DigitalOutQueue();
+
+        bool set_high(const uint8_t bus_pin);
+        bool set_low(const uint8_t bus_pin);
+        bool push(const uint32_t set_mask, const uint32_t clear_mask);
+
+        uint16_t process(void);
+        uint32_t get_dropped_commands(void);
+
+    private:
+        DigitalOutBus* bus;
+        the_hal_digital_out_queue_slot slots[THE_HAL_DIGITAL_OUT_QUEUE_SIZE];
+        uint32_t enqueue_position;
+        uint32_t dequeue_position;
+        uint32_t dropped_commands;
+
+        bool pop(uint32_t* set_mask, uint32_t* clear_mask);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_DIGITAL_OUT_QUEUE_H_
+#endif // THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE
@@ -0,0 +1,286 @@
+
+/**
+ * @file    display_mux.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Multiplexed Display Controller (LED matrices and 7-segment displays
+ * driven row by row from a DigitalOutBus).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_DISPLAY_MUX == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "display_mux.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Segments of hexadecimal digits 0 to F */
+static const uint8_t HEX_DIGITS_SEGMENTS[16] =
+{
+    0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07,
+    0x7f, 0x6f, 0x77, 0x7c, 0x39, 0x5e, 0x79, 0x71
+};
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* DisplayMux constructor */
+DisplayMux::DisplayMux(DigitalOutBus* bus, const uint8_t num_columns,
+        const uint8_t num_rows, const bool columns_active_high,
+        const bool rows_active_high)
+{
+    this->bus = bus;
+    this->num_columns = num_columns;
+    this->num_rows = num_rows;
+    this->columns_active_high = columns_active_high;
+    this->rows_active_high = rows_active_high;
+    this->columns_mask = 0;
+    this->rows_mask = 0;
+    this->row = 0;
+    this->front = 0;
+    this->swap_pending = false;
+    this->initialized = false;
+    for(uint8_t i = 0; i < THE_HAL_DISPLAY_MUX_MAX_ROWS; i++)
+        this->pixels[i] = 0;
+}
+
+/* DisplayMux destructor */
+DisplayMux::~DisplayMux()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize the bus with all rows off and prepare the blank frames */
+bool DisplayMux::setup(void)
+{
+    if(this->bus == nullptr)
+        return false;
+    if((this->num_columns == 0) || (this->num_rows == 0))
+        return false;
+    if(this->num_rows > THE_HAL_DISPLAY_MUX_MAX_ROWS)
+        return false;
+    if((this->num_columns + this->num_rows) > 32)
+        return false;
+
+    this->columns_mask = (this->num_columns >= 32) ?
+            0xffffffffUL : ((1UL << this->num_columns) - 1);
+    this->rows_mask = ((1UL << this->num_rows) - 1) << this->num_columns;
+
+    // Columns off and no row selected
+    if(!this->bus->setup(get_row_values(this->num_rows)))
+        return false;
+
+    this->initialized = true;
+    this->row = 0;
+    this->front = 0;
+    this->swap_pending = false;
+    if(!prepare_blank())
+        return false;
+    if(!prepare_frame(0))
+        return false;
+
+    return prepare_frame(1);
+}
+
+/* Turn off all the pixels of the back frame */
+void DisplayMux::clear(void)
+{
+    for(uint8_t i = 0; i < THE_HAL_DISPLAY_MUX_MAX_ROWS; i++)
+        this->pixels[i] = 0;
+}
+
+/* Set all the pixels of a row of the back frame (bit N is column N) */
+bool DisplayMux::set_row(const uint8_t row, const uint32_t columns)
+{
+    if(row >= this->num_rows)
+        return false;
+
+    this->pixels[row] = columns;
+    return true;
+}
+
+/* Turn on or off a pixel of the back frame */
+bool DisplayMux::set_pixel(const uint8_t row, const uint8_t column,
+        const bool on)
+{
+    if((row >= this->num_rows) || (column >= this->num_columns))
+        return false;
+
+    if(on)
+        this->pixels[row] = this->pixels[row] | (1UL << column);
+    else
+        this->pixels[row] = this->pixels[row] & ~(1UL << column);
+
+    return true;
+}
+
+/* Show an hexadecimal digit in a 7-segment display of the back frame */
+bool DisplayMux::set_digit(const uint8_t row, const uint8_t value,
+        const bool dot)
+{
+    uint32_t segments;
+
+    if(value > 0x0f)
+        return false;
+
+    segments = HEX_DIGITS_SEGMENTS[value];
+    if(dot)
+        segments = segments | THE_HAL_DISPLAY_MUX_SEGMENT_DP;
+
+    return set_row(row, segments);
+}
+
+/* Translate the back frame into bus writes and request it to be shown at
+ * the start of the next scan (false if last frame has not been shown yet) */
+bool DisplayMux::present(void)
+{
+    if(!this->initialized)
+        return false;
+    if(is_present_pending())
+        return false;
+
+    // The interrupt does not read the back frame until the swap request
+    if(!prepare_frame(this->front ^ 1))
+        return false;
+
+#if defined(__AVR__)
+    this->swap_pending = true;
+#else
+    __atomic_store_n(&this->swap_pending, true, __ATOMIC_RELEASE);
+#endif
+
+    return true;
+}
+
+/* Check if last presented frame is still waiting to be shown */
+bool DisplayMux::is_present_pending(void)
+{
+#if defined(__AVR__)
+    return this->swap_pending;
+#else
+    return __atomic_load_n(&this->swap_pending, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/* Light the next row (to be called periodically from a timer interrupt) */
+void DisplayMux::refresh(void)
+{
+    if(!this->initialized)
+        return;
+
+    // Swap frames only between scans, so rows are never mixed
+    if((this->row == 0) && is_present_pending())
+    {
+        this->front = this->front ^ 1;
+#if defined(__AVR__)
+        this->swap_pending = false;
+#else
+        __atomic_store_n(&this->swap_pending, false, __ATOMIC_RELEASE);
+#endif
+    }
+
+    // All off before lighting the next row, so whatever the order in which
+    // the row write updates the ports, no row shows the columns of another
+    this->bus->write_prepared(&(this->blank));
+    this->bus->write_prepared(&(this->frames[this->front][this->row]));
+
+    this->row = this->row + 1;
+    if(this->row >= this->num_rows)
+        this->row = 0;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Translate the selection and the columns of each row of a frame into a
+ * single bus write */
+bool DisplayMux::prepare_frame(const uint8_t frame)
+{
+    uint32_t mask = this->columns_mask | this->rows_mask;
+    uint32_t values;
+
+    for(uint8_t row = 0; row < this->num_rows; row++)
+    {
+        values = get_row_values(row);
+        if(!this->bus->prepare(values, ~values & mask,
+                &(this->frames[frame][row])))
+            return false;
+    }
+
+    return true;
+}
+
+/* Translate the columns off and no row selected into a bus write */
+bool DisplayMux::prepare_blank(void)
+{
+    uint32_t mask = this->columns_mask | this->rows_mask;
+    uint32_t values;
+
+    values = get_row_values(this->num_rows);
+    return this->bus->prepare(values, ~values & mask, &(this->blank));
+}
+
+/* Get bus logic values to light a row (num_rows to turn off all of them) */
+uint32_t DisplayMux::get_row_values(const uint8_t row)
+{
+    uint32_t columns = 0;
+    uint32_t rows;
+
+    if(row < this->num_rows)
+        columns = this->pixels[row] & this->columns_mask;
+    if(!this->columns_active_high)
+        columns = ~columns & this->columns_mask;
+
+    rows = (row < this->num_rows) ? (1UL << (this->num_columns + row)) : 0;
+    if(!this->rows_active_high)
+        rows = ~rows & this->rows_mask;
+
+    return (columns | rows);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_DISPLAY_MUX == 1 */
+
+/*****************************************************************************/
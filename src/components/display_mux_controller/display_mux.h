@@ -0,0 +1,144 @@
+
+/**
+ * @file    display_mux.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Multiplexed Display Controller (LED matrices and 7-segment displays
+ * driven row by row from a DigitalOutBus).
+ *
+ * Bus bits 0 to (columns - 1) are the columns (or the segments of a
+ * 7-segment display) and the next bits are the rows (or the digits). Only
+ * one row is lit at a time, refresh() is called from a timer interrupt to
+ * move to the next row, so the frame rate is the interrupt rate divided by
+ * the number of rows.
+ *
+ * Frames are translated to ports masks when they are presented, one
+ * combined row selection and columns write per row, so each refresh() is
+ * two prepared bus writes (all off, then the next row with its columns)
+ * that take the same time whatever the number of lit segments (no
+ * brightness differences between rows). Everything is off before the next
+ * row is lit, so when columns and rows are in different ports a row never
+ * shows the columns of another one (no ghosting).
+ * Drawing is done on a back frame that is swapped with the front one at
+ * the start of the next scan, so a frame is never shown half drawn.
+ *
+ * Not available with the AVR bare-metal backend (it has no DigitalOutBus).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_DISPLAY_MUX == 1
+
+/* Include Guard */
+#ifndef THE_HAL_DISPLAY_MUX_H_
+#define THE_HAL_DISPLAY_MUX_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of multiplexed rows (or digits) */
+#define THE_HAL_DISPLAY_MUX_MAX_ROWS 8
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* 7-segment display segments (columns) */
+typedef enum
+{
+    THE_HAL_DISPLAY_MUX_SEGMENT_A = 0x01,
+    THE_HAL_DISPLAY_MUX_SEGMENT_B = 0x02,
+    THE_HAL_DISPLAY_MUX_SEGMENT_C = 0x04,
+    THE_HAL_DISPLAY_MUX_SEGMENT_D = 0x08,
+    THE_HAL_DISPLAY_MUX_SEGMENT_E = 0x10,
+    THE_HAL_DISPLAY_MUX_SEGMENT_F = 0x20,
+    THE_HAL_DISPLAY_MUX_SEGMENT_G = 0x40,
+    THE_HAL_DISPLAY_MUX_SEGMENT_DP = 0x80
+} the_hal_display_mux_segments;
+
+/*****************************************************************************/
+
+/* Class */
+
+class DisplayMux
+{
+    public:
+        DisplayMux(DigitalOutBus* bus, const uint8_t num_columns,
+                const uint8_t num_rows, const bool columns_active_high = true,
+                const bool rows_active_high = false);
+        ~DisplayMux();
+
+        bool setup(void);
+
+        void clear(void);
+        bool set_row(const uint8_t row, const uint32_t columns);
+        bool set_pixel(const uint8_t row, const uint8_t column,
+                const bool on);
+        bool set_digit(const uint8_t row, const uint8_t value,
+                const bool dot = false);
+        bool present(void);
+        bool is_present_pending(void);
+
+        void refresh(void);
+
+    private:
+        DigitalOutBus* bus;
+        the_hal_digital_out_bus_prepared
+                frames[2][THE_HAL_DISPLAY_MUX_MAX_ROWS];
+        the_hal_digital_out_bus_prepared blank;
+        uint32_t pixels[THE_HAL_DISPLAY_MUX_MAX_ROWS];
+        uint32_t columns_mask;
+        uint32_t rows_mask;
+        uint8_t num_columns;
+        uint8_t num_rows;
+        uint8_t row;
+        volatile uint8_t front;
+        volatile bool swap_pending;
+        bool columns_active_high;
+        bool rows_active_high;
+        bool initialized;
+
+        bool prepare_frame(const uint8_t frame);
+        bool prepare_blank(void);
+        uint32_t get_row_values(const uint8_t row);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_DISPLAY_MUX_H_
+#endif // THE_HAL_COMPONENT_DISPLAY_MUX
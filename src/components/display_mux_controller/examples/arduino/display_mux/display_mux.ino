@@ -0,0 +1,53 @@
+// Requires THE_HAL_COMPONENT_DISPLAY_MUX enabled in thehal.h
+// Counts seconds in a 4 digits common cathode 7-segment display refreshed
+// at 2 kHz (AVR Timer1), 500 frames per second
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_SEGMENTS 8
+#define NUM_DIGITS 4
+
+/*****************************************************************************/
+
+// Segments a..g and dp, then digits 1..4 cathodes
+const int8_t DISPLAY_PINS[NUM_SEGMENTS + NUM_DIGITS] =
+{
+    2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13
+};
+
+DigitalOutBus MyBus(DISPLAY_PINS, NUM_SEGMENTS + NUM_DIGITS);
+DisplayMux MyDisplay(&MyBus, NUM_SEGMENTS, NUM_DIGITS, true, false);
+
+uint16_t counter = 0;
+
+/*****************************************************************************/
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyDisplay.refresh();
+}
+
+void setup()
+{
+    MyDisplay.setup();
+
+    // Timer1 CTC mode, prescaler 8, 2 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / 2000) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    MyDisplay.set_digit(0, (counter / 1000) % 10);
+    MyDisplay.set_digit(1, (counter / 100) % 10);
+    MyDisplay.set_digit(2, (counter / 10) % 10, true);
+    MyDisplay.set_digit(3, counter % 10);
+    while(!MyDisplay.present());
+
+    counter = counter + 1;
+    delay(1000);
+}
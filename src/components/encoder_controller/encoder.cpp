@@ -0,0 +1,196 @@
+
+/**
+ * @file    encoder.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Quadrature Encoder Controller.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_ENCODER == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "encoder.h"
+
+#if defined(__AVR__)
+    #include <util/atomic.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    ILLEGAL = 2,
+    CHANNELS_MASK = 0x03,
+    TRANSITION_MASK = 0x0f
+} the_hal_encoder_constants;
+
+/* Position increment for each (previous << 2 | current) channels state,
+ * where channel A is bit 0 and channel B is bit 1 of the bus snapshot */
+static const int8_t TRANSITIONS[16] =
+{
+     0,  1, -1,  ILLEGAL,
+    -1,  0,  ILLEGAL,  1,
+     1,  ILLEGAL,  0, -1,
+     ILLEGAL, -1,  1,  0
+};
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* Encoder constructor */
+Encoder::Encoder(const int8_t io_pin_a, const int8_t io_pin_b) :
+    io_pins{io_pin_a, io_pin_b}, channels(io_pins, 2)
+{
+    this->state = 0;
+    this->position = 0;
+    this->illegal_transitions = 0;
+}
+
+/* Encoder destructor */
+Encoder::~Encoder()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize both channels GPIOs and take the initial channels state */
+bool Encoder::setup(const uint8_t pull_resistor_mode)
+{
+    if(!this->channels.setup(pull_resistor_mode))
+        return false;
+
+    this->state = (uint8_t)(this->channels.read() & CHANNELS_MASK);
+    set_position(0);
+
+    return true;
+}
+
+/* Decode channels transition (to be called from a pin change interrupt) */
+void Encoder::isr(void)
+{
+    uint8_t channels = (uint8_t)(this->channels.read() & CHANNELS_MASK);
+    int8_t increment;
+
+    this->state = ((this->state << 2) | channels) & TRANSITION_MASK;
+    increment = TRANSITIONS[this->state];
+    if(increment == 0)
+        return;
+
+    // Both channels changed at once, some transition was lost
+    if(increment == ILLEGAL)
+    {
+#if defined(__AVR__)
+        this->illegal_transitions = this->illegal_transitions + 1;
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+        __atomic_fetch_add(&this->illegal_transitions, 1, __ATOMIC_RELAXED);
+#else
+        __atomic_store_n(&this->illegal_transitions,
+                this->illegal_transitions + 1, __ATOMIC_RELAXED);
+#endif
+        return;
+    }
+
+#if defined(__AVR__)
+    this->position = this->position + increment;
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+    __atomic_fetch_add(&this->position, increment, __ATOMIC_RELAXED);
+#else
+    // No atomic read-modify-write without libatomic (i.e. Cortex-M0), a
+    // load and a store are enough as isr() is not reentrant
+    __atomic_store_n(&this->position, this->position + increment,
+            __ATOMIC_RELAXED);
+#endif
+}
+
+/* Get current encoder position (in channels transitions) */
+int32_t Encoder::get_position(void)
+{
+    int32_t position;
+
+#if defined(__AVR__)
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        position = this->position;
+    }
+#else
+    position = __atomic_load_n(&this->position, __ATOMIC_RELAXED);
+#endif
+
+    return position;
+}
+
+/* Set current encoder position */
+void Encoder::set_position(const int32_t position)
+{
+#if defined(__AVR__)
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->position = position;
+    }
+#else
+    __atomic_store_n(&this->position, position, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Get number of detected illegal transitions (both channels changed) */
+uint32_t Encoder::get_illegal_transitions(void)
+{
+    uint32_t illegal_transitions;
+
+#if defined(__AVR__)
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        illegal_transitions = this->illegal_transitions;
+    }
+#else
+    illegal_transitions = __atomic_load_n(&this->illegal_transitions,
+            __ATOMIC_RELAXED);
+#endif
+
+    return illegal_transitions;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_ENCODER == 1 */
+
+/*****************************************************************************/
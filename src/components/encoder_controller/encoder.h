@@ -0,0 +1,79 @@
+
+/**
+ * @file    encoder.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Quadrature Encoder Controller.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_ENCODER == 1
+
+/* Include Guard */
+#ifndef THE_HAL_ENCODER_H_
+#define THE_HAL_ENCODER_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Class */
+
+class Encoder
+{
+    public:
+        Encoder(const int8_t io_pin_a, const int8_t io_pin_b);
+        ~Encoder();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        void isr(void);
+
+        int32_t get_position(void);
+        void set_position(const int32_t position);
+        uint32_t get_illegal_transitions(void);
+
+    private:
+        int8_t io_pins[2];
+        DigitalInBus channels;
+        uint8_t state;
+        volatile int32_t position;
+        volatile uint32_t illegal_transitions;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_ENCODER_H_
+#endif // THE_HAL_COMPONENT_ENCODER
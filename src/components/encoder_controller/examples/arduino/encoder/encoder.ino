@@ -0,0 +1,38 @@
+
+// Requires THE_HAL_COMPONENT_ENCODER enabled in thehal.h
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define GPIO_ENCODER_A 2
+#define GPIO_ENCODER_B 3
+
+/*****************************************************************************/
+
+Encoder MyEncoder(GPIO_ENCODER_A, GPIO_ENCODER_B);
+
+/*****************************************************************************/
+
+void encoder_isr()
+{
+    MyEncoder.isr();
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    MyEncoder.setup(THE_HAL_DIGITAL_IN_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(GPIO_ENCODER_A), encoder_isr,
+            CHANGE);
+    attachInterrupt(digitalPinToInterrupt(GPIO_ENCODER_B), encoder_isr,
+            CHANGE);
+}
+
+void loop()
+{
+    Serial.print("Position: ");
+    Serial.print(MyEncoder.get_position());
+    Serial.print(" Illegal: ");
+    Serial.println(MyEncoder.get_illegal_transitions());
+    delay(250);
+}
@@ -0,0 +1,244 @@
+
+/**
+ * @file    glitch_filter.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Oversampling Glitch Filter Controller (majority vote of the last N
+ * samples of a DigitalIn or of all the pins of a DigitalInBus).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_GLITCH_FILTER == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "glitch_filter.h"
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Check if window is a valid vote window (odd, so there are no ties) */
+static bool is_a_invalid_window(const uint8_t window)
+{
+    if((window == 0) || (window > THE_HAL_GLITCH_FILTER_MAX_WINDOW))
+        return true;
+    return ((window & 1) == 0);
+}
+
+/*****************************************************************************/
+
+/* GlitchFilter Constructor */
+
+/* GlitchFilter constructor */
+GlitchFilter::GlitchFilter(DigitalIn* pin, const uint8_t window)
+{
+    this->pin = pin;
+    this->window = window;
+    this->window_mask = (1UL << window) - 1;
+    this->history = 0;
+    this->filtered = false;
+}
+
+/* GlitchFilter destructor */
+GlitchFilter::~GlitchFilter()
+{}
+
+/*****************************************************************************/
+
+/* GlitchFilter Public Methods */
+
+/* Initialize GPIO and fill the window with its current level */
+bool GlitchFilter::setup(const uint8_t pull_resistor_mode)
+{
+    if(is_a_invalid_window(this->window))
+        return false;
+    if(!this->pin->setup(pull_resistor_mode))
+        return false;
+
+    this->filtered = this->pin->read();
+    this->history = (this->filtered) ? this->window_mask : 0;
+
+    return true;
+}
+
+/* Take a sample and get the level voted by the window majority */
+bool GlitchFilter::update(void)
+{
+    uint8_t ones;
+
+    this->history = ((this->history << 1) | this->pin->read()) &
+            this->window_mask;
+    ones = (uint8_t)(__builtin_popcountl(this->history));
+    this->filtered = (ones > (this->window >> 1));
+
+    return this->filtered;
+}
+
+/* Get last filtered level */
+bool GlitchFilter::read(void)
+{
+    return this->filtered;
+}
+
+/*****************************************************************************/
+
+/* GlitchFilterBus Constructor */
+
+/* GlitchFilterBus constructor */
+GlitchFilterBus::GlitchFilterBus(DigitalInBus* bus, const uint8_t window,
+        const uint8_t oversampling)
+{
+    this->bus = bus;
+    this->window = window;
+    this->oversampling = oversampling;
+    this->threshold = (window >> 1) + 1;
+    this->oldest = 0;
+    this->filtered = 0;
+    for(uint8_t plane = 0; plane < THE_HAL_GLITCH_FILTER_PLANES; plane++)
+        this->counters[plane] = 0;
+}
+
+/* GlitchFilterBus destructor */
+GlitchFilterBus::~GlitchFilterBus()
+{}
+
+/*****************************************************************************/
+
+/* GlitchFilterBus Public Methods */
+
+/* Initialize bus GPIOs and fill the window with their current levels */
+bool GlitchFilterBus::setup(const uint8_t pull_resistor_mode)
+{
+    uint32_t sample;
+
+    if(is_a_invalid_window(this->window) || (this->oversampling == 0))
+        return false;
+    if(!this->bus->setup(pull_resistor_mode))
+        return false;
+
+    // All the pins that are high start counting a full window
+    sample = this->bus->read();
+    for(uint8_t i = 0; i < this->window; i++)
+        this->history[i] = sample;
+    for(uint8_t plane = 0; plane < THE_HAL_GLITCH_FILTER_PLANES; plane++)
+        this->counters[plane] = ((this->window >> plane) & 1) ? sample : 0;
+    this->oldest = 0;
+    this->filtered = sample;
+
+    return true;
+}
+
+/* Take the oversampling bus samples and get the window majority value of
+ * each bus GPIO (to be called each tick) */
+uint32_t GlitchFilterBus::update(void)
+{
+    for(uint8_t i = 0; i < this->oversampling; i++)
+        add_sample(this->bus->read());
+    this->filtered = vote();
+
+    return this->filtered;
+}
+
+/* Get last filtered bus value */
+uint32_t GlitchFilterBus::read(void)
+{
+    return this->filtered;
+}
+
+/*****************************************************************************/
+
+/* GlitchFilterBus Private Methods */
+
+/* Slide the window: add new sample and remove the oldest one from all the
+ * pins counters at once (ripple carry/borrow through the bit planes) */
+void GlitchFilterBus::add_sample(const uint32_t sample)
+{
+    uint32_t removed = this->history[this->oldest];
+    uint32_t carry;
+    uint32_t borrow;
+    uint32_t next;
+
+    this->history[this->oldest] = sample;
+    this->oldest = this->oldest + 1;
+    if(this->oldest == this->window)
+        this->oldest = 0;
+
+    // Pins where new and removed samples are equal keep their counter, so
+    // increments and decrements never touch the same pin
+    carry = sample & ~removed;
+    borrow = removed & ~sample;
+
+    for(uint8_t plane = 0; plane < THE_HAL_GLITCH_FILTER_PLANES; plane++)
+    {
+        next = this->counters[plane] & carry;
+        this->counters[plane] = this->counters[plane] ^ carry;
+        carry = next;
+
+        next = ~this->counters[plane] & borrow;
+        this->counters[plane] = this->counters[plane] ^ borrow;
+        borrow = next;
+    }
+}
+
+/* Get the pins whose counter reaches the majority threshold (bit-sliced
+ * comparison from the most significant plane) */
+uint32_t GlitchFilterBus::vote(void)
+{
+    uint32_t greater = 0;
+    uint32_t equal = UINT32_MAX;
+    uint8_t plane = THE_HAL_GLITCH_FILTER_PLANES;
+
+    while(plane > 0)
+    {
+        plane = plane - 1;
+        if((this->threshold >> plane) & 1)
+            equal = equal & this->counters[plane];
+        else
+        {
+            greater = greater | (equal & this->counters[plane]);
+            equal = equal & ~this->counters[plane];
+        }
+    }
+
+    return (greater | equal);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_GLITCH_FILTER == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,123 @@
+
+/**
+ * @file    glitch_filter.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Oversampling Glitch Filter Controller (majority vote of the last N
+ * samples of a DigitalIn or of all the pins of a DigitalInBus).
+ *
+ * A spike shorter than half the window never reaches the filtered value,
+ * and a real level change is seen (window + 1) / 2 samples later, so the
+ * window size sets the filter latency.
+ *
+ * Bus votes are bit-sliced: one counter per pin is kept as bit planes
+ * (plane K holds bit K of the 32 counters), so adding the new sample,
+ * removing the oldest one and comparing with the majority threshold are a
+ * few word operations per plane, whatever the number of pins.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_GLITCH_FILTER == 1
+
+/* Include Guard */
+#ifndef THE_HAL_GLITCH_FILTER_H_
+#define THE_HAL_GLITCH_FILTER_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of samples of the vote window (must be 2^PLANES - 1) */
+#define THE_HAL_GLITCH_FILTER_MAX_WINDOW 15
+
+/* Number of bit planes of the bus vote counters */
+#define THE_HAL_GLITCH_FILTER_PLANES 4
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Majority vote filter of a single GPIO */
+class GlitchFilter
+{
+    public:
+        GlitchFilter(DigitalIn* pin, const uint8_t window);
+        ~GlitchFilter();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        bool update(void);
+        bool read(void);
+
+    private:
+        DigitalIn* pin;
+        uint32_t history;
+        uint32_t window_mask;
+        uint8_t window;
+        bool filtered;
+};
+
+/* Bit-sliced majority vote filter of all the GPIOs of a bus */
+class GlitchFilterBus
+{
+    public:
+        GlitchFilterBus(DigitalInBus* bus, const uint8_t window,
+                const uint8_t oversampling = 1);
+        ~GlitchFilterBus();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        uint32_t update(void);
+        uint32_t read(void);
+
+    private:
+        DigitalInBus* bus;
+        uint32_t history[THE_HAL_GLITCH_FILTER_MAX_WINDOW];
+        uint32_t counters[THE_HAL_GLITCH_FILTER_PLANES];
+        uint32_t filtered;
+        uint8_t window;
+        uint8_t oversampling;
+        uint8_t threshold;
+        uint8_t oldest;
+
+        void add_sample(const uint32_t sample);
+        uint32_t vote(void);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_GLITCH_FILTER_H_
+#endif // THE_HAL_COMPONENT_GLITCH_FILTER
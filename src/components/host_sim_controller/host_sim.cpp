@@ -0,0 +1,144 @@
+
+/**
+ * @file    host_sim.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Controller (virtual GPIO ports and virtual clock used by
+ * dummy backends).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "host_sim.h"
+#include "host_sim_stimulus.h"
+#include "host_sim_device.h"
+
+/*****************************************************************************/
+
+/* Static Members */
+
+volatile uint32_t HostSim::ports[THE_HAL_HOST_SIM_NUM_PORTS] = { 0 };
+volatile uint32_t HostSim::pulls[THE_HAL_HOST_SIM_NUM_PORTS] = { 0 };
+volatile uint64_t HostSim::time_ns = 0;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Set all simulated GPIO ports to logical low and virtual clock to zero
+ * (devices events are canceled, their lines released and the stimulus is
+ * replayed again from its first record) */
+void HostSim::reset(void)
+{
+    HostSimDevices::reset();
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        __atomic_store_n(&ports[port], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pulls[port], 0, __ATOMIC_RELAXED);
+    }
+    HostSimStimulus::rewind();
+    set_time_ns(0);
+}
+
+/* Get current virtual clock time (nanoseconds) */
+uint64_t HostSim::get_time_ns(void)
+{
+    return __atomic_load_n(&time_ns, __ATOMIC_RELAXED);
+}
+
+/* Set current virtual clock time (nanoseconds), a time in the past is set
+ * at once and a time in the future goes through the due records and events
+ * in between */
+void HostSim::set_time_ns(const uint64_t time_ns)
+{
+    if(time_ns < get_time_ns())
+        __atomic_store_n(&HostSim::time_ns, time_ns, __ATOMIC_RELAXED);
+    run_until(time_ns);
+}
+
+/* Move forward the virtual clock time (nanoseconds) */
+void HostSim::advance_time_ns(const uint64_t time_ns)
+{
+    run_until(get_time_ns() + time_ns);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Run the devices events and the stimulus records that are due until a
+ * time, in time order and each one with the virtual clock at its time (a
+ * record goes before an event of its same time, so the device sees it) */
+void HostSim::run_until(const uint64_t time_ns)
+{
+    uint64_t record_ns;
+    uint64_t event_ns;
+    bool record_due;
+    bool event_due;
+
+    do
+    {
+        record_due = HostSimStimulus::get_next_time_ns(&record_ns) &&
+                (record_ns <= time_ns);
+        event_due = HostSimDevices::get_next_time_ns(&event_ns) &&
+                (event_ns <= time_ns);
+
+        if(record_due && (!event_due || (record_ns <= event_ns)))
+        {
+            move_time_ns(record_ns);
+            HostSimStimulus::apply_next(record_ns);
+        }
+        else if(event_due)
+        {
+            move_time_ns(event_ns);
+            HostSimDevices::run_next(event_ns);
+        }
+    } while(record_due || event_due);
+
+    move_time_ns(time_ns);
+}
+
+/* Move the virtual clock to a time (records and events that were due
+ * before the current time run at the current time) */
+void HostSim::move_time_ns(const uint64_t time_ns)
+{
+    if(time_ns > get_time_ns())
+        __atomic_store_n(&HostSim::time_ns, time_ns, __ATOMIC_RELAXED);
+}
+
+/*****************************************************************************/
+
+#endif /* !defined(ARDUINO) and !defined(ESP_IDF) and .. */
+
+/*****************************************************************************/
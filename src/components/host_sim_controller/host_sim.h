@@ -0,0 +1,116 @@
+
+/**
+ * @file    host_sim.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Controller (virtual GPIO ports and virtual clock used by
+ * dummy backends).
+ *
+ * Pins and ports access is defined in host_sim_ports.cpp, that header-only
+ * builds include below, so the dummy backends pin operations are inlined
+ * into the calling code (see THE_HAL_HEADER_ONLY).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_HOST_SIM_H_
+#define THE_HAL_HOST_SIM_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of simulated 32 bits GPIO ports (pin N is bit N%32 of port N/32) */
+#define THE_HAL_HOST_SIM_NUM_PORTS 4
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Bits of each simulated port */
+#define THE_HAL_HOST_SIM_PORT_BITS 32
+
+/*****************************************************************************/
+
+/* Class */
+
+class HostSim
+{
+    public:
+        static void reset(void);
+
+        static bool write_pin(const int8_t io_pin, const bool value);
+        static bool read_pin(const int8_t io_pin);
+
+        static bool write_port(const uint8_t port, const uint32_t mask,
+                const uint32_t values);
+        static uint32_t read_port(const uint8_t port);
+
+        static bool is_a_invalid_pin(const int8_t io_pin);
+        static uint8_t get_pin_port(const int8_t io_pin);
+        static uint32_t get_pin_mask(const int8_t io_pin);
+
+        static uint64_t get_time_ns(void);
+        static void set_time_ns(const uint64_t time_ns);
+        static void advance_time_ns(const uint64_t time_ns);
+
+    private:
+        friend class HostSimDevices;
+
+        static volatile uint32_t ports[THE_HAL_HOST_SIM_NUM_PORTS];
+        static volatile uint32_t pulls[THE_HAL_HOST_SIM_NUM_PORTS];
+        static volatile uint64_t time_ns;
+
+        static void run_until(const uint64_t time_ns);
+        static void move_time_ns(const uint64_t time_ns);
+};
+
+/*****************************************************************************/
+
+/* Header-Only Build Implementation */
+
+#if THE_HAL_HEADER_ONLY == 1
+    #include "host_sim_ports.cpp"
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_HOST_SIM_H_ */
@@ -0,0 +1,395 @@
+
+/**
+ * @file    host_sim_device.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Devices (peripheral models attached to the simulated
+ * GPIOs and scheduled on the virtual clock).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "host_sim_device.h"
+
+/*****************************************************************************/
+
+/* Static Members */
+
+HostSimDevice* HostSimDevices::devices = nullptr;
+HostSimDevice* HostSimDevices::next_event = nullptr;
+uint32_t HostSimDevices::watched[THE_HAL_HOST_SIM_NUM_PORTS] = { 0 };
+
+/*****************************************************************************/
+
+/* HostSimDevice Constructor */
+
+/* HostSimDevice constructor */
+HostSimDevice::HostSimDevice()
+{
+    this->next = nullptr;
+    this->event_next = nullptr;
+    this->event_prev = nullptr;
+    this->edge_callback = nullptr;
+    this->event_callback = nullptr;
+    this->arg = nullptr;
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        this->watched[port] = 0;
+        this->pulls[port] = 0;
+    }
+    this->event_time_ns = 0;
+    this->scheduled = false;
+    this->attached = false;
+}
+
+/* HostSimDevice destructor */
+HostSimDevice::~HostSimDevice()
+{
+    HostSimDevices::detach(this);
+}
+
+/*****************************************************************************/
+
+/* HostSimDevice Public Methods */
+
+/* Set the model callbacks (any of them can be nullptr) */
+bool HostSimDevice::setup(the_hal_host_sim_edge_callback edge_callback,
+        the_hal_host_sim_event_callback event_callback, void* arg)
+{
+    if(this->attached)
+        return false;
+
+    this->edge_callback = edge_callback;
+    this->event_callback = event_callback;
+    this->arg = arg;
+
+    return true;
+}
+
+/* Check if the device is attached to the simulated ports */
+bool HostSimDevice::is_attached(void)
+{
+    return this->attached;
+}
+
+/* Check if the device has an event pending */
+bool HostSimDevice::is_scheduled(void)
+{
+    return this->scheduled;
+}
+
+/*****************************************************************************/
+
+/* HostSimDevices Public Methods */
+
+/* Cancel the events of all the devices and release their lines (called by
+ * HostSim::reset(), devices stay attached) */
+void HostSimDevices::reset(void)
+{
+    for(HostSimDevice* device = devices; device != nullptr;
+            device = device->next)
+    {
+        if(device->scheduled)
+            unqueue_event(device);
+        device->scheduled = false;
+        for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+            device->pulls[port] = 0;
+    }
+}
+
+/* Attach a device to the simulated ports */
+bool HostSimDevices::attach(HostSimDevice* device)
+{
+    if((device == nullptr) || device->attached)
+        return false;
+
+    device->next = devices;
+    devices = device;
+    device->attached = true;
+    update_watched();
+
+    return true;
+}
+
+/* Detach a device (its events are canceled and its lines released) */
+bool HostSimDevices::detach(HostSimDevice* device)
+{
+    HostSimDevice** link = &devices;
+
+    if((device == nullptr) || !device->attached)
+        return false;
+
+    while(*link != device)
+        link = &((*link)->next);
+    *link = device->next;
+    device->next = nullptr;
+    device->attached = false;
+    if(device->scheduled)
+        unqueue_event(device);
+    device->scheduled = false;
+
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        device->watched[port] = 0;
+        if(device->pulls[port] != 0)
+        {
+            device->pulls[port] = 0;
+            update_pulls(port);
+        }
+    }
+    update_watched();
+
+    return true;
+}
+
+/* Call the device edge callback when a pin changes */
+bool HostSimDevices::watch_pin(HostSimDevice* device, const int8_t io_pin)
+{
+    if((device == nullptr) || !device->attached)
+        return false;
+    if(HostSim::is_a_invalid_pin(io_pin))
+        return false;
+
+    uint8_t port = HostSim::get_pin_port(io_pin);
+    device->watched[port] = device->watched[port] |
+            HostSim::get_pin_mask(io_pin);
+    watched[port] = watched[port] | HostSim::get_pin_mask(io_pin);
+
+    return true;
+}
+
+/* Pull a line low or release it (open-drain output of the device) */
+bool HostSimDevices::pull_low(HostSimDevice* device, const int8_t io_pin,
+        const bool low)
+{
+    if((device == nullptr) || !device->attached)
+        return false;
+    if(HostSim::is_a_invalid_pin(io_pin))
+        return false;
+
+    uint8_t port = HostSim::get_pin_port(io_pin);
+    uint32_t mask = HostSim::get_pin_mask(io_pin);
+    uint32_t pulls = low ? (device->pulls[port] | mask) :
+            (device->pulls[port] & ~mask);
+
+    if(pulls != device->pulls[port])
+    {
+        device->pulls[port] = pulls;
+        update_pulls(port);
+    }
+
+    return true;
+}
+
+/* Schedule the device event at a virtual clock time (a past time is run
+ * the next time the clock moves), replacing the pending one */
+bool HostSimDevices::schedule_at(HostSimDevice* device,
+        const uint64_t time_ns)
+{
+    uint64_t now_ns = HostSim::get_time_ns();
+
+    if((device == nullptr) || !device->attached)
+        return false;
+
+    if(device->scheduled)
+        unqueue_event(device);
+    device->event_time_ns = (time_ns > now_ns) ? time_ns : now_ns;
+    device->scheduled = true;
+    queue_event(device);
+
+    return true;
+}
+
+/* Schedule the device event after a delay from the current time */
+bool HostSimDevices::schedule_in(HostSimDevice* device,
+        const uint64_t delay_ns)
+{
+    return schedule_at(device, HostSim::get_time_ns() + delay_ns);
+}
+
+/* Cancel the device pending event */
+bool HostSimDevices::cancel(HostSimDevice* device)
+{
+    if((device == nullptr) || !device->scheduled)
+        return false;
+
+    unqueue_event(device);
+    device->scheduled = false;
+
+    return true;
+}
+
+/* Move the virtual clock to the next device event (never backwards) */
+bool HostSimDevices::advance_to_next(void)
+{
+    uint64_t time_ns;
+
+    if(!get_next_time_ns(&time_ns))
+        return false;
+
+    if(time_ns > HostSim::get_time_ns())
+        HostSim::set_time_ns(time_ns);
+    else
+        HostSim::advance_time_ns(0);
+
+    return true;
+}
+
+/* Get the time of the next device event */
+bool HostSimDevices::get_next_time_ns(uint64_t* time_ns)
+{
+    if(next_event == nullptr)
+        return false;
+
+    *time_ns = next_event->event_time_ns;
+    return true;
+}
+
+/* Call the edge callbacks of the devices watching the pins of a port that
+ * changed (called by HostSim on each port write) */
+void HostSimDevices::notify(const uint8_t port, const uint32_t previous,
+        const uint32_t current)
+{
+    uint32_t changed = (previous ^ current) & watched[port];
+    HostSimDevice* device = devices;
+    HostSimDevice* next;
+
+    if(changed == 0)
+        return;
+
+    while(device != nullptr)
+    {
+        // Callbacks may detach their own device
+        next = device->next;
+        if(((device->watched[port] & changed) != 0) &&
+           (device->edge_callback != nullptr))
+        {
+            device->edge_callback(device->arg, port,
+                    device->watched[port] & changed & current,
+                    device->watched[port] & changed & ~current);
+        }
+        device = next;
+    }
+}
+
+/* Run the earliest device event if it is due at a time (called by HostSim
+ * with the virtual clock at the event time) */
+bool HostSimDevices::run_next(const uint64_t until_ns)
+{
+    HostSimDevice* device = next_event;
+
+    if((device == nullptr) || (device->event_time_ns > until_ns))
+        return false;
+
+    unqueue_event(device);
+    device->scheduled = false;
+    if(device->event_callback != nullptr)
+        device->event_callback(device->arg, device->event_time_ns);
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* HostSimDevices Private Methods */
+
+/* Merge the pins watched by all devices */
+void HostSimDevices::update_watched(void)
+{
+    HostSimDevice* device;
+
+    for(uint8_t port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        watched[port] = 0;
+        for(device = devices; device != nullptr; device = device->next)
+            watched[port] = watched[port] | device->watched[port];
+    }
+}
+
+/* Merge the lines pulled low by all devices (wired-AND) and notify the
+ * lines that changed */
+void HostSimDevices::update_pulls(const uint8_t port)
+{
+    uint32_t previous = HostSim::read_port(port);
+    uint32_t pulls = 0;
+
+    for(HostSimDevice* device = devices; device != nullptr;
+            device = device->next)
+        pulls = pulls | device->pulls[port];
+
+    __atomic_store_n(&HostSim::pulls[port], pulls, __ATOMIC_RELAXED);
+    notify(port, previous, HostSim::read_port(port));
+}
+
+/* Link a scheduled device in the events list, after the events of its
+ * same time (next_event is the earliest one) */
+void HostSimDevices::queue_event(HostSimDevice* device)
+{
+    HostSimDevice* prev = nullptr;
+    HostSimDevice* next = next_event;
+
+    while((next != nullptr) && (next->event_time_ns <= device->event_time_ns))
+    {
+        prev = next;
+        next = next->event_next;
+    }
+
+    device->event_prev = prev;
+    device->event_next = next;
+    if(prev != nullptr)
+        prev->event_next = device;
+    else
+        next_event = device;
+    if(next != nullptr)
+        next->event_prev = device;
+}
+
+/* Unlink a scheduled device from the events list */
+void HostSimDevices::unqueue_event(HostSimDevice* device)
+{
+    if(device->event_prev != nullptr)
+        device->event_prev->event_next = device->event_next;
+    else
+        next_event = device->event_next;
+    if(device->event_next != nullptr)
+        device->event_next->event_prev = device->event_prev;
+    device->event_next = nullptr;
+    device->event_prev = nullptr;
+}
+
+/*****************************************************************************/
+
+#endif /* !defined(ARDUINO) and !defined(ESP_IDF) and .. */
+
+/*****************************************************************************/
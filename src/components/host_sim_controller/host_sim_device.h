@@ -0,0 +1,160 @@
+
+/**
+ * @file    host_sim_device.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Devices (peripheral models attached to the simulated
+ * GPIOs and scheduled on the virtual clock).
+ *
+ * A device model is a HostSimDevice with two callbacks: the edge callback
+ * is called each time a watched pin changes (whoever writes it: DigitalOut,
+ * stimulus replay or another device), and the event callback is called
+ * when the virtual clock reaches the device scheduled event. Models never
+ * poll, so a co-simulation only runs code when a wire moves or an event is
+ * due, and HostSimDevices::advance_to_next() jumps the virtual clock from
+ * one event to the next:
+ *
+ *   Device.setup(on_edge, on_event, this);
+ *   HostSimDevices::attach(&Device);
+ *   HostSimDevices::watch_pin(&Device, CLOCK_PIN);
+ *   HostSimDevices::schedule_in(&Device, 1000);
+ *
+ * Devices drive input pins with HostSim::write_pin(), or as open-drain
+ * outputs with pull_low(): a line reads low while any device pulls it low,
+ * whatever level the MCU writes (wired-AND, i.e. I2C lines released with a
+ * open-drain DigitalOut). While the clock moves, each due event runs with the
+ * virtual clock at its own time, in time order with the stimulus records.
+ *
+ * Devices are linked in place (no allocation) and are run from the thread
+ * that writes the pins or moves the virtual clock. Scheduled devices are
+ * also linked in time order, so running the next event does not look
+ * through all the devices.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// First, so in header-only builds host_sim.h gets this header complete
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_HOST_SIM_DEVICE_H_
+#define THE_HAL_HOST_SIM_DEVICE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host_sim.h"
+#include "host_sim_stimulus.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Event callback, time_ns is the scheduled time (current virtual clock) */
+typedef void (*the_hal_host_sim_event_callback)(void* arg,
+        const uint64_t time_ns);
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Simulated device (peripheral model) */
+class HostSimDevice
+{
+    public:
+        HostSimDevice();
+        ~HostSimDevice();
+
+        bool setup(the_hal_host_sim_edge_callback edge_callback,
+                the_hal_host_sim_event_callback event_callback, void* arg);
+
+        bool is_attached(void);
+        bool is_scheduled(void);
+
+    private:
+        friend class HostSimDevices;
+
+        HostSimDevice* next;
+        HostSimDevice* event_next;
+        HostSimDevice* event_prev;
+        the_hal_host_sim_edge_callback edge_callback;
+        the_hal_host_sim_event_callback event_callback;
+        void* arg;
+        uint32_t watched[THE_HAL_HOST_SIM_NUM_PORTS];
+        uint32_t pulls[THE_HAL_HOST_SIM_NUM_PORTS];
+        uint64_t event_time_ns;
+        bool scheduled;
+        bool attached;
+};
+
+/* Registry and scheduler of the simulated devices */
+class HostSimDevices
+{
+    public:
+        static void reset(void);
+        static bool attach(HostSimDevice* device);
+        static bool detach(HostSimDevice* device);
+
+        static bool watch_pin(HostSimDevice* device, const int8_t io_pin);
+        static bool pull_low(HostSimDevice* device, const int8_t io_pin,
+                const bool low);
+
+        static bool schedule_at(HostSimDevice* device,
+                const uint64_t time_ns);
+        static bool schedule_in(HostSimDevice* device,
+                const uint64_t delay_ns);
+        static bool cancel(HostSimDevice* device);
+
+        static bool advance_to_next(void);
+        static bool get_next_time_ns(uint64_t* time_ns);
+
+        static void notify(const uint8_t port, const uint32_t previous,
+                const uint32_t current);
+        static bool run_next(const uint64_t until_ns);
+
+    private:
+        static HostSimDevice* devices;
+        static HostSimDevice* next_event;
+        static uint32_t watched[THE_HAL_HOST_SIM_NUM_PORTS];
+
+        static void update_watched(void);
+        static void update_pulls(const uint8_t port);
+        static void queue_event(HostSimDevice* device);
+        static void unqueue_event(HostSimDevice* device);
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_HOST_SIM_DEVICE_H_ */
@@ -0,0 +1,666 @@
+
+/**
+ * @file    host_sim_models.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Peripheral Models (simulated devices on the other side
+ * of the simulated GPIOs, to test drivers without hardware).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "host_sim_models.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    MAX_SHIFT_REGISTER_CHIPS = 4,
+    BITS_PER_BYTE = 8,
+    WS2812_BITS_PER_LED = 24
+} the_hal_host_sim_models_constants;
+
+/* I2C EEPROM states */
+typedef enum
+{
+    EEPROM_IDLE = 0,
+    EEPROM_DEVICE_ADDRESS = 1,
+    EEPROM_MEMORY_ADDRESS_HIGH = 2,
+    EEPROM_MEMORY_ADDRESS_LOW = 3,
+    EEPROM_WRITE_DATA = 4,
+    EEPROM_READ_START = 5,
+    EEPROM_READ_DATA = 6
+} the_hal_host_sim_eeprom_state;
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Check if a pin is in the changed bits of a port */
+static inline bool pin_changed(const int8_t io_pin, const uint8_t port,
+        const uint32_t bits)
+{
+    return ((HostSim::get_pin_port(io_pin) == port) &&
+            ((bits & HostSim::get_pin_mask(io_pin)) != 0));
+}
+
+/*****************************************************************************/
+
+/* HostSimShiftRegister Constructor */
+
+/* HostSimShiftRegister constructor */
+HostSimShiftRegister::HostSimShiftRegister(const int8_t data_pin,
+        const int8_t clock_pin, const int8_t latch_pin,
+        const uint8_t num_chips)
+{
+    this->data_pin = data_pin;
+    this->clock_pin = clock_pin;
+    this->latch_pin = latch_pin;
+    this->num_chips = num_chips;
+    this->shift = 0;
+    this->outputs = 0;
+    this->num_latches = 0;
+}
+
+/* HostSimShiftRegister destructor */
+HostSimShiftRegister::~HostSimShiftRegister()
+{}
+
+/*****************************************************************************/
+
+/* HostSimShiftRegister Public Methods */
+
+/* Attach the chain to its pins (all outputs low) */
+bool HostSimShiftRegister::setup(void)
+{
+    if((this->num_chips == 0) ||
+       (this->num_chips > MAX_SHIFT_REGISTER_CHIPS))
+        return false;
+    if(HostSim::is_a_invalid_pin(this->data_pin))
+        return false;
+
+    this->device.setup(on_edge, nullptr, this);
+    if(!HostSimDevices::attach(&(this->device)))
+        return false;
+    if(!HostSimDevices::watch_pin(&(this->device), this->clock_pin) ||
+       !HostSimDevices::watch_pin(&(this->device), this->latch_pin))
+    {
+        HostSimDevices::detach(&(this->device));
+        return false;
+    }
+
+    return true;
+}
+
+/* Get latched outputs (bit N % 8 of byte N / 8 is Qx of chip N / 8, chip 0
+ * being the one connected to the data pin) */
+uint32_t HostSimShiftRegister::get_outputs(void)
+{
+    return this->outputs;
+}
+
+/* Get the number of latch rising edges */
+uint32_t HostSimShiftRegister::get_num_latches(void)
+{
+    return this->num_latches;
+}
+
+/*****************************************************************************/
+
+/* HostSimShiftRegister Private Methods */
+
+/* Shift on clock rising edges and latch on latch rising edges */
+void HostSimShiftRegister::on_edge(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t)
+{
+    HostSimShiftRegister* chain = (HostSimShiftRegister*)arg;
+    uint32_t mask = 0xffffffffUL >> (32 - (chain->num_chips * BITS_PER_BYTE));
+
+    // On simultaneous edges the latch gets the shift register before the
+    // shift (as the real chip)
+    if(pin_changed(chain->latch_pin, port, rising))
+    {
+        chain->outputs = chain->shift;
+        chain->num_latches = chain->num_latches + 1;
+    }
+    if(pin_changed(chain->clock_pin, port, rising))
+    {
+        chain->shift = ((chain->shift << 1) |
+                (HostSim::read_pin(chain->data_pin) ? 1 : 0)) & mask;
+    }
+}
+
+/*****************************************************************************/
+
+/* HostSimI2cEeprom Constructor */
+
+/* HostSimI2cEeprom constructor */
+HostSimI2cEeprom::HostSimI2cEeprom(const int8_t scl_pin,
+        const int8_t sda_pin, const uint8_t address, uint8_t* memory,
+        const uint32_t size)
+{
+    this->scl_pin = scl_pin;
+    this->sda_pin = sda_pin;
+    this->address = address;
+    this->memory = memory;
+    this->size = size;
+    this->write_time_ns = 0;
+    this->num_writes = 0;
+    this->pointer = 0;
+    this->page_count = 0;
+    this->page_offset = 0;
+    this->state = EEPROM_IDLE;
+    this->bit_count = 0;
+    this->shift = 0;
+    this->ack_phase = false;
+    this->master_ack = false;
+    this->busy = false;
+    for(uint8_t i = 0; i < THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE; i++)
+    {
+        this->page[i] = 0;
+        this->page_written[i] = false;
+    }
+}
+
+/* HostSimI2cEeprom destructor */
+HostSimI2cEeprom::~HostSimI2cEeprom()
+{}
+
+/*****************************************************************************/
+
+/* HostSimI2cEeprom Public Methods */
+
+/* Attach the EEPROM to the bus with its write cycle time */
+bool HostSimI2cEeprom::setup(const uint32_t write_time_ns)
+{
+    if((this->memory == nullptr) || (this->size == 0) ||
+       (this->size > 65536UL) || (this->address > 0x7f))
+        return false;
+
+    this->write_time_ns = write_time_ns;
+    this->device.setup(on_edge, on_event, this);
+    if(!HostSimDevices::attach(&(this->device)))
+        return false;
+    if(!HostSimDevices::watch_pin(&(this->device), this->scl_pin) ||
+       !HostSimDevices::watch_pin(&(this->device), this->sda_pin))
+    {
+        HostSimDevices::detach(&(this->device));
+        return false;
+    }
+
+    return true;
+}
+
+/* Check if a write cycle is in progress (address is not acknowledged) */
+bool HostSimI2cEeprom::is_busy(void)
+{
+    return this->busy;
+}
+
+/* Get the number of completed page writes */
+uint32_t HostSimI2cEeprom::get_num_writes(void)
+{
+    return this->num_writes;
+}
+
+/*****************************************************************************/
+
+/* HostSimI2cEeprom Private Methods */
+
+/* Decode start and stop conditions (SDA edges with SCL high) and bits (SCL
+ * edges) */
+void HostSimI2cEeprom::on_edge(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t falling)
+{
+    HostSimI2cEeprom* eeprom = (HostSimI2cEeprom*)arg;
+
+    if(HostSim::read_pin(eeprom->scl_pin))
+    {
+        if(pin_changed(eeprom->sda_pin, port, falling))
+            eeprom->start();
+        else if(pin_changed(eeprom->sda_pin, port, rising))
+            eeprom->stop();
+    }
+
+    if(pin_changed(eeprom->scl_pin, port, rising))
+        eeprom->clock_rising();
+    else if(pin_changed(eeprom->scl_pin, port, falling))
+        eeprom->clock_falling();
+}
+
+/* End of the write cycle */
+void HostSimI2cEeprom::on_event(void* arg, const uint64_t)
+{
+    HostSimI2cEeprom* eeprom = (HostSimI2cEeprom*)arg;
+
+    eeprom->busy = false;
+}
+
+/* Start (or repeated start) condition, a pending page write is dropped */
+void HostSimI2cEeprom::start(void)
+{
+    this->state = EEPROM_DEVICE_ADDRESS;
+    this->bit_count = 0;
+    this->shift = 0;
+    this->ack_phase = false;
+    this->page_count = 0;
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, false);
+}
+
+/* Stop condition, the received data starts its write cycle */
+void HostSimI2cEeprom::stop(void)
+{
+    if((this->state == EEPROM_WRITE_DATA) && (this->page_count > 0))
+        write_page();
+
+    this->state = EEPROM_IDLE;
+    this->ack_phase = false;
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, false);
+}
+
+/* Sample a data bit, or the master acknowledge of a sent byte */
+void HostSimI2cEeprom::clock_rising(void)
+{
+    if((this->state == EEPROM_IDLE) || (this->state == EEPROM_READ_START))
+        return;
+
+    if(this->ack_phase)
+    {
+        if(this->state == EEPROM_READ_DATA)
+            this->master_ack = !HostSim::read_pin(this->sda_pin);
+        return;
+    }
+    if(this->state == EEPROM_READ_DATA)
+        return;
+
+    this->shift = (uint8_t)((this->shift << 1) |
+            (HostSim::read_pin(this->sda_pin) ? 1 : 0));
+    this->bit_count = this->bit_count + 1;
+}
+
+/* Drive next bit, the acknowledge or release the line */
+void HostSimI2cEeprom::clock_falling(void)
+{
+    if(this->state == EEPROM_IDLE)
+        return;
+
+    if(this->ack_phase)
+        end_ack();
+    else if(this->state == EEPROM_READ_DATA)
+        send_next_bit();
+    else if(this->bit_count >= BITS_PER_BYTE)
+        ack_byte();
+}
+
+/* End of the acknowledge bit: a read sends its first byte or goes on with
+ * the next one, a write waits for the next byte */
+void HostSimI2cEeprom::end_ack(void)
+{
+    this->ack_phase = false;
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, false);
+
+    if(this->state == EEPROM_READ_START)
+    {
+        this->state = EEPROM_READ_DATA;
+        send_byte();
+    }
+    else if(this->state == EEPROM_READ_DATA)
+    {
+        // A not acknowledged byte ends the read (stop is expected)
+        this->pointer = (uint16_t)((this->pointer + 1) % this->size);
+        if(!this->master_ack)
+        {
+            this->state = EEPROM_IDLE;
+            return;
+        }
+        send_byte();
+    }
+    else
+    {
+        this->bit_count = 0;
+        this->shift = 0;
+    }
+}
+
+/* Drive the next bit of the sent byte, or release the line for the master
+ * acknowledge */
+void HostSimI2cEeprom::send_next_bit(void)
+{
+    if(this->bit_count < BITS_PER_BYTE)
+    {
+        send_bit();
+        return;
+    }
+
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, false);
+    this->master_ack = false;
+    this->ack_phase = true;
+}
+
+/* Acknowledge a received byte (the transfer ends if it is not valid) */
+void HostSimI2cEeprom::ack_byte(void)
+{
+    if(!receive_byte())
+    {
+        this->state = EEPROM_IDLE;
+        return;
+    }
+
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, true);
+    this->ack_phase = true;
+}
+
+/* Process a received byte (returns false if it is not acknowledged) */
+bool HostSimI2cEeprom::receive_byte(void)
+{
+    switch(this->state)
+    {
+        case EEPROM_DEVICE_ADDRESS:
+            if(((this->shift >> 1) != this->address) || this->busy)
+                return false;
+            this->state = ((this->shift & 0x01) != 0) ? EEPROM_READ_START :
+                    EEPROM_MEMORY_ADDRESS_HIGH;
+            return true;
+        case EEPROM_MEMORY_ADDRESS_HIGH:
+            this->pointer = (uint16_t)(this->shift << 8);
+            this->state = EEPROM_MEMORY_ADDRESS_LOW;
+            return true;
+        case EEPROM_MEMORY_ADDRESS_LOW:
+            this->pointer = (uint16_t)((this->pointer | this->shift) %
+                    this->size);
+            this->page_count = 0;
+            this->page_offset = (uint8_t)(this->pointer %
+                    THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE);
+            for(uint8_t i = 0; i < THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE; i++)
+                this->page_written[i] = false;
+            this->state = EEPROM_WRITE_DATA;
+            return true;
+        case EEPROM_WRITE_DATA:
+            // The address counter wraps inside the page (more bytes than
+            // the page size overwrite the first ones)
+            this->page[this->page_offset] = this->shift;
+            this->page_written[this->page_offset] = true;
+            this->page_offset = (uint8_t)((this->page_offset + 1) %
+                    THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE);
+            if(this->page_count < THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE)
+                this->page_count = this->page_count + 1;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Start sending the memory byte at the address pointer */
+void HostSimI2cEeprom::send_byte(void)
+{
+    this->shift = this->memory[this->pointer];
+    this->bit_count = 0;
+    send_bit();
+}
+
+/* Drive the next bit of the byte being sent (MSB first) */
+void HostSimI2cEeprom::send_bit(void)
+{
+    bool bit = ((this->shift & (0x80 >> this->bit_count)) != 0);
+
+    HostSimDevices::pull_low(&(this->device), this->sda_pin, !bit);
+    this->bit_count = this->bit_count + 1;
+}
+
+/* Write the received bytes of the page and start the write cycle */
+void HostSimI2cEeprom::write_page(void)
+{
+    uint32_t page_start = this->pointer -
+            (this->pointer % THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE);
+
+    for(uint8_t i = 0; i < THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE; i++)
+    {
+        if(this->page_written[i] && ((page_start + i) < this->size))
+            this->memory[page_start + i] = this->page[i];
+    }
+    this->num_writes = this->num_writes + 1;
+    this->page_count = 0;
+
+    if(this->write_time_ns == 0)
+        return;
+    this->busy = true;
+    HostSimDevices::schedule_in(&(this->device), this->write_time_ns);
+}
+
+/*****************************************************************************/
+
+/* HostSimWs2812 Constructor */
+
+/* HostSimWs2812 constructor */
+HostSimWs2812::HostSimWs2812(const int8_t data_pin, uint32_t* colors,
+        const uint16_t num_leds)
+{
+    this->data_pin = data_pin;
+    this->colors = colors;
+    this->num_leds = num_leds;
+    this->led = 0;
+    this->bit_count = 0;
+    this->value = 0;
+    this->rise_time_ns = 0;
+    this->num_frames = 0;
+}
+
+/* HostSimWs2812 destructor */
+HostSimWs2812::~HostSimWs2812()
+{}
+
+/*****************************************************************************/
+
+/* HostSimWs2812 Public Methods */
+
+/* Attach the strip to its data pin */
+bool HostSimWs2812::setup(void)
+{
+    if((this->colors == nullptr) || (this->num_leds == 0))
+        return false;
+
+    this->device.setup(on_edge, on_event, this);
+    if(!HostSimDevices::attach(&(this->device)))
+        return false;
+    if(!HostSimDevices::watch_pin(&(this->device), this->data_pin))
+    {
+        HostSimDevices::detach(&(this->device));
+        return false;
+    }
+
+    return true;
+}
+
+/* Get the number of latched frames (reset times after some data) */
+uint32_t HostSimWs2812::get_num_frames(void)
+{
+    return this->num_frames;
+}
+
+/*****************************************************************************/
+
+/* HostSimWs2812 Private Methods */
+
+/* Decode a bit from the high time of each pulse */
+void HostSimWs2812::on_edge(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t)
+{
+    HostSimWs2812* strip = (HostSimWs2812*)arg;
+    uint64_t now_ns = HostSim::get_time_ns();
+
+    if(pin_changed(strip->data_pin, port, rising))
+    {
+        HostSimDevices::cancel(&(strip->device));
+        strip->rise_time_ns = now_ns;
+        return;
+    }
+
+    strip->value = (strip->value << 1) |
+            (((now_ns - strip->rise_time_ns) >=
+            THE_HAL_HOST_SIM_WS2812_T1H_MIN_NS) ? 1 : 0);
+    strip->bit_count = strip->bit_count + 1;
+    if(strip->bit_count == WS2812_BITS_PER_LED)
+    {
+        // Colors for LEDs after the last one go out of the strip
+        if(strip->led < strip->num_leds)
+            strip->colors[strip->led] = strip->value;
+        strip->led = strip->led + 1;
+        strip->bit_count = 0;
+        strip->value = 0;
+    }
+    HostSimDevices::schedule_in(&(strip->device),
+            THE_HAL_HOST_SIM_WS2812_RESET_NS);
+}
+
+/* Reset time reached, latch the frame */
+void HostSimWs2812::on_event(void* arg, const uint64_t)
+{
+    HostSimWs2812* strip = (HostSimWs2812*)arg;
+
+    if((strip->led > 0) || (strip->bit_count > 0))
+        strip->num_frames = strip->num_frames + 1;
+    strip->led = 0;
+    strip->bit_count = 0;
+    strip->value = 0;
+}
+
+/*****************************************************************************/
+
+/* HostSimButton Constructor */
+
+/* HostSimButton constructor */
+HostSimButton::HostSimButton(const int8_t io_pin, const bool pressed_level)
+{
+    this->io_pin = io_pin;
+    this->pressed_level = pressed_level;
+    this->pressed = false;
+    this->remaining_edges = 0;
+    this->bounce_ns = 0;
+}
+
+/* HostSimButton destructor */
+HostSimButton::~HostSimButton()
+{}
+
+/*****************************************************************************/
+
+/* HostSimButton Public Methods */
+
+/* Attach the button with its pin at the released level */
+bool HostSimButton::setup(void)
+{
+    if(HostSim::is_a_invalid_pin(this->io_pin))
+        return false;
+
+    this->device.setup(nullptr, on_event, this);
+    if(!HostSimDevices::attach(&(this->device)))
+        return false;
+
+    this->pressed = false;
+    return HostSim::write_pin(this->io_pin, !this->pressed_level);
+}
+
+/* Press the button, the contact bounces a number of times (one each
+ * bounce_ns) before settling */
+bool HostSimButton::press(const uint8_t bounces, const uint32_t bounce_ns)
+{
+    return change(true, bounces, bounce_ns);
+}
+
+/* Release the button, the contact bounces a number of times (one each
+ * bounce_ns) before settling */
+bool HostSimButton::release(const uint8_t bounces, const uint32_t bounce_ns)
+{
+    return change(false, bounces, bounce_ns);
+}
+
+/* Check if the button is pressed (level after the bounces) */
+bool HostSimButton::is_pressed(void)
+{
+    return this->pressed;
+}
+
+/* Check if the contact is still bouncing */
+bool HostSimButton::is_bouncing(void)
+{
+    return (this->remaining_edges > 0);
+}
+
+/*****************************************************************************/
+
+/* HostSimButton Private Methods */
+
+/* Next bounce edge */
+void HostSimButton::on_event(void* arg, const uint64_t)
+{
+    HostSimButton* button = (HostSimButton*)arg;
+
+    if(button->remaining_edges == 0)
+        return;
+
+    HostSim::write_pin(button->io_pin, !HostSim::read_pin(button->io_pin));
+    button->remaining_edges = button->remaining_edges - 1;
+    if(button->remaining_edges > 0)
+        HostSimDevices::schedule_in(&(button->device), button->bounce_ns);
+}
+
+/* Move the contact to a new state (first edge now, each bounce goes back
+ * and forth so it ends at the new level) */
+bool HostSimButton::change(const bool pressed, const uint8_t bounces,
+        const uint32_t bounce_ns)
+{
+    bool level = pressed ? this->pressed_level : !this->pressed_level;
+
+    if(!this->device.is_attached())
+        return false;
+
+    HostSimDevices::cancel(&(this->device));
+    this->pressed = pressed;
+    this->bounce_ns = bounce_ns;
+    this->remaining_edges = (uint16_t)(bounces * 2);
+    if(!HostSim::write_pin(this->io_pin, level))
+        return false;
+
+    if(this->remaining_edges > 0)
+        HostSimDevices::schedule_in(&(this->device), bounce_ns);
+    return true;
+}
+
+/*****************************************************************************/
+
+#endif /* !defined(ARDUINO) and !defined(ESP_IDF) and .. */
+
+/*****************************************************************************/
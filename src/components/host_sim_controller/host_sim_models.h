@@ -0,0 +1,219 @@
+
+/**
+ * @file    host_sim_models.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Peripheral Models (simulated devices on the other side
+ * of the simulated GPIOs, to test drivers without hardware).
+ *
+ *   - HostSimShiftRegister: 74HC595 chain (up to 4 chips), shifts on the
+ *     clock rising edges and latches on the latch rising edges.
+ *   - HostSimI2cEeprom: 24LC256 like I2C EEPROM (2 bytes memory address,
+ *     page writes and sequential reads) with ACK polling during the write
+ *     cycle. Its SDA is open-drain, so the master must release the line
+ *     (i.e. SoftI2c).
+ *   - HostSimWs2812: WS2812 LED strip, bits are decoded from the high time
+ *     of each pulse on the virtual clock and a low time longer than the
+ *     reset time ends the frame.
+ *   - HostSimButton: push button that bounces a number of times before its
+ *     level settles.
+ *
+ * Models only run on the edges of their pins and on their own events, so
+ * they do not slow down the simulation while idle:
+ *
+ *   uint8_t memory[32768];
+ *   HostSimI2cEeprom Eeprom(SCL_PIN, SDA_PIN, 0x50, memory, sizeof(memory));
+ *
+ *   Eeprom.setup(5000000);
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_HOST_SIM_MODELS_H_
+#define THE_HAL_HOST_SIM_MODELS_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host_sim.h"
+#include "host_sim_device.h"
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* I2C EEPROM page size (a page write wraps inside its page) */
+#define THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE 64
+
+/* WS2812 high time threshold between a 0 (T0H) and a 1 (T1H) */
+#define THE_HAL_HOST_SIM_WS2812_T1H_MIN_NS 625
+
+/* WS2812 low time that latches the frame */
+#define THE_HAL_HOST_SIM_WS2812_RESET_NS 50000
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* 74HC595 shift register chain */
+class HostSimShiftRegister
+{
+    public:
+        HostSimShiftRegister(const int8_t data_pin, const int8_t clock_pin,
+                const int8_t latch_pin, const uint8_t num_chips);
+        ~HostSimShiftRegister();
+
+        bool setup(void);
+        uint32_t get_outputs(void);
+        uint32_t get_num_latches(void);
+
+    private:
+        HostSimDevice device;
+        int8_t data_pin;
+        int8_t clock_pin;
+        int8_t latch_pin;
+        uint8_t num_chips;
+        uint32_t shift;
+        uint32_t outputs;
+        uint32_t num_latches;
+
+        static void on_edge(void* arg, const uint8_t port,
+                const uint32_t rising, const uint32_t falling);
+};
+
+/* I2C EEPROM */
+class HostSimI2cEeprom
+{
+    public:
+        HostSimI2cEeprom(const int8_t scl_pin, const int8_t sda_pin,
+                const uint8_t address, uint8_t* memory, const uint32_t size);
+        ~HostSimI2cEeprom();
+
+        bool setup(const uint32_t write_time_ns);
+        bool is_busy(void);
+        uint32_t get_num_writes(void);
+
+    private:
+        HostSimDevice device;
+        int8_t scl_pin;
+        int8_t sda_pin;
+        uint8_t address;
+        uint8_t* memory;
+        uint32_t size;
+        uint32_t write_time_ns;
+        uint32_t num_writes;
+        uint16_t pointer;
+        uint8_t page[THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE];
+        bool page_written[THE_HAL_HOST_SIM_EEPROM_PAGE_SIZE];
+        uint8_t page_count;
+        uint8_t page_offset;
+        uint8_t state;
+        uint8_t bit_count;
+        uint8_t shift;
+        bool ack_phase;
+        bool master_ack;
+        bool busy;
+
+        static void on_edge(void* arg, const uint8_t port,
+                const uint32_t rising, const uint32_t falling);
+        static void on_event(void* arg, const uint64_t time_ns);
+
+        void start(void);
+        void stop(void);
+        void clock_rising(void);
+        void clock_falling(void);
+        void end_ack(void);
+        void send_next_bit(void);
+        void ack_byte(void);
+        bool receive_byte(void);
+        void send_byte(void);
+        void send_bit(void);
+        void write_page(void);
+};
+
+/* WS2812 LED strip (colors as received, 0xGGRRBB) */
+class HostSimWs2812
+{
+    public:
+        HostSimWs2812(const int8_t data_pin, uint32_t* colors,
+                const uint16_t num_leds);
+        ~HostSimWs2812();
+
+        bool setup(void);
+        uint32_t get_num_frames(void);
+
+    private:
+        HostSimDevice device;
+        int8_t data_pin;
+        uint32_t* colors;
+        uint16_t num_leds;
+        uint16_t led;
+        uint8_t bit_count;
+        uint32_t value;
+        uint64_t rise_time_ns;
+        uint32_t num_frames;
+
+        static void on_edge(void* arg, const uint8_t port,
+                const uint32_t rising, const uint32_t falling);
+        static void on_event(void* arg, const uint64_t time_ns);
+};
+
+/* Push button with contact bounces */
+class HostSimButton
+{
+    public:
+        HostSimButton(const int8_t io_pin, const bool pressed_level);
+        ~HostSimButton();
+
+        bool setup(void);
+        bool press(const uint8_t bounces, const uint32_t bounce_ns);
+        bool release(const uint8_t bounces, const uint32_t bounce_ns);
+        bool is_pressed(void);
+        bool is_bouncing(void);
+
+    private:
+        HostSimDevice device;
+        int8_t io_pin;
+        bool pressed_level;
+        bool pressed;
+        uint16_t remaining_edges;
+        uint32_t bounce_ns;
+
+        static void on_event(void* arg, const uint64_t time_ns);
+
+        bool change(const bool pressed, const uint8_t bounces,
+                const uint32_t bounce_ns);
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_HOST_SIM_MODELS_H_ */
@@ -0,0 +1,144 @@
+/**
+ * @file    host_sim_ports.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Controller pins and ports access (kept apart from the
+ * virtual clock and the simulation state, so header-only builds define it
+ * inline in host_sim.h and the dummy backends pin operations inline down
+ * to the simulated port atomics).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__)
+
+/* Implementation Guard (header-only builds include this file from its
+ * header, see THE_HAL_HEADER_ONLY) */
+#ifndef THE_HAL_HOST_SIM_PORTS_CPP_
+#define THE_HAL_HOST_SIM_PORTS_CPP_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "host_sim.h"
+#include "host_sim_device.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Set the logical value of a simulated GPIO */
+THE_HAL_INLINE bool HostSim::write_pin(const int8_t io_pin,
+        const bool value)
+{
+    if(is_a_invalid_pin(io_pin))
+        return false;
+
+    uint32_t mask = get_pin_mask(io_pin);
+    return write_port(get_pin_port(io_pin), mask, (value) ? mask : 0);
+}
+
+/* Get the logical value of a simulated GPIO */
+THE_HAL_INLINE bool HostSim::read_pin(const int8_t io_pin)
+{
+    if(is_a_invalid_pin(io_pin))
+        return false;
+
+    return ((read_port(get_pin_port(io_pin)) & get_pin_mask(io_pin)) != 0);
+}
+
+/* Set the masked bits of a simulated port to the provided values */
+THE_HAL_INLINE bool HostSim::write_port(const uint8_t port,
+        const uint32_t mask, const uint32_t values)
+{
+    uint32_t clear = mask & ~values;
+    uint32_t set = mask & values;
+    uint32_t previous;
+
+    if(port >= THE_HAL_HOST_SIM_NUM_PORTS)
+        return false;
+
+    previous = read_port(port);
+    // Each operation is atomic by itself, so threads writing different
+    // bits of the same port never lose each other updates (when inlined
+    // with constant values, a single pin write keeps only one of them)
+    if(clear != 0)
+        __atomic_fetch_and(&ports[port], ~clear, __ATOMIC_RELAXED);
+    if(set != 0)
+        __atomic_fetch_or(&ports[port], set, __ATOMIC_RELAXED);
+    HostSimDevices::notify(port, previous, read_port(port));
+
+    return true;
+}
+
+/* Get a snapshot of all the bits of a simulated port (bits pulled low by
+ * simulated devices read low) */
+THE_HAL_INLINE uint32_t HostSim::read_port(const uint8_t port)
+{
+    if(port >= THE_HAL_HOST_SIM_NUM_PORTS)
+        return 0;
+
+    return (__atomic_load_n(&ports[port], __ATOMIC_RELAXED) &
+            ~__atomic_load_n(&pulls[port], __ATOMIC_RELAXED));
+}
+
+/* Check if provided GPIO number is out of simulated ports range */
+THE_HAL_INLINE bool HostSim::is_a_invalid_pin(const int8_t io_pin)
+{
+    if((io_pin >= 0) &&
+       (io_pin < (THE_HAL_HOST_SIM_NUM_PORTS * THE_HAL_HOST_SIM_PORT_BITS)))
+        return false;
+    return true;
+}
+
+/* Get the simulated port that contains the provided GPIO */
+THE_HAL_INLINE uint8_t HostSim::get_pin_port(const int8_t io_pin)
+{
+    return (uint8_t)(io_pin / THE_HAL_HOST_SIM_PORT_BITS);
+}
+
+/* Get the bit mask of the provided GPIO inside its simulated port */
+THE_HAL_INLINE uint32_t HostSim::get_pin_mask(const int8_t io_pin)
+{
+    return (1UL << (io_pin % THE_HAL_HOST_SIM_PORT_BITS));
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_HOST_SIM_PORTS_CPP_ */
+
+#endif /* !defined(ARDUINO) and !defined(ESP_IDF) and ... */
+
+/*****************************************************************************/
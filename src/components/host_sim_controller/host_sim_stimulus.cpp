@@ -0,0 +1,260 @@
+
+/**
+ * @file    host_sim_stimulus.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Stimulus Replay (deterministic inputs from a recorded or
+ * generated stimulus file, driven by the virtual clock).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "host_sim_stimulus.h"
+#include "host_sim.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    FORMAT_VERSION = 1
+} the_hal_host_sim_stimulus_constants;
+
+static const uint8_t MAGIC[4] = { 'T', 'H', 'S', 'T' };
+
+/*****************************************************************************/
+
+/* Static Members */
+
+const the_hal_host_sim_stimulus_record* HostSimStimulus::records = nullptr;
+size_t HostSimStimulus::num_records = 0;
+size_t HostSimStimulus::next_record = 0;
+void* HostSimStimulus::mapped_data = nullptr;
+size_t HostSimStimulus::mapped_size = 0;
+the_hal_host_sim_edge_callback HostSimStimulus::edge_callback = nullptr;
+void* HostSimStimulus::edge_callback_arg = nullptr;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Use a stimulus from memory (data is used in place, not copied) */
+bool HostSimStimulus::load(const void* data, const size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    unload();
+    if((data == nullptr) || (size < THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE))
+        return false;
+    if(((uintptr_t)data % sizeof(uint64_t)) != 0)
+        return false;
+
+    for(uint8_t i = 0; i < sizeof(MAGIC); i++)
+    {
+        if(bytes[i] != MAGIC[i])
+            return false;
+    }
+    if(bytes[4] != FORMAT_VERSION)
+        return false;
+
+    records = (const the_hal_host_sim_stimulus_record*)
+            (bytes + THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE);
+    num_records = (size - THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE) /
+            sizeof(the_hal_host_sim_stimulus_record);
+    next_record = 0;
+
+    // Records that are already due are applied now
+    apply_until(HostSim::get_time_ns());
+
+    return true;
+}
+
+/* Memory-map a stimulus file and use it */
+bool HostSimStimulus::map_file(const char* path)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat file_stat;
+    void* data;
+    int fd;
+
+    unload();
+    fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if((fstat(fd, &file_stat) < 0) || (file_stat.st_size == 0))
+    {
+        close(fd);
+        return false;
+    }
+
+    data = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE,
+            fd, 0);
+    close(fd);
+    if(data == MAP_FAILED)
+        return false;
+
+    // Replay reads the records sequentially
+    madvise(data, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+    if(!load(data, (size_t)file_stat.st_size))
+    {
+        munmap(data, (size_t)file_stat.st_size);
+        return false;
+    }
+    mapped_data = data;
+    mapped_size = (size_t)file_stat.st_size;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* Stop using current stimulus (simulated ports keep their values) */
+void HostSimStimulus::unload(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if(mapped_data != nullptr)
+        munmap(mapped_data, mapped_size);
+#endif
+    mapped_data = nullptr;
+    mapped_size = 0;
+    records = nullptr;
+    num_records = 0;
+    next_record = 0;
+}
+
+/* Replay the stimulus again from the first record */
+bool HostSimStimulus::rewind(void)
+{
+    if(records == nullptr)
+        return false;
+
+    next_record = 0;
+    return true;
+}
+
+/* Apply to simulated ports all the records until a time, each one with the
+ * virtual clock at its own time (the clock is moved to that time, never
+ * backwards), returns the number of applied records */
+uint32_t HostSimStimulus::apply_until(const uint64_t time_ns)
+{
+    size_t first_record = next_record;
+
+    if(time_ns > HostSim::get_time_ns())
+        HostSim::set_time_ns(time_ns);
+    while(apply_next(time_ns));
+
+    return (uint32_t)(next_record - first_record);
+}
+
+/* Apply the next record if it is due at a time (called by HostSim with the
+ * virtual clock at the record time) */
+bool HostSimStimulus::apply_next(const uint64_t until_ns)
+{
+    const the_hal_host_sim_stimulus_record* record;
+    uint32_t previous;
+    uint32_t changed;
+
+    if((next_record >= num_records) ||
+       (records[next_record].time_ns > until_ns))
+        return false;
+
+    record = &(records[next_record]);
+    next_record = next_record + 1;
+
+    previous = HostSim::read_port(record->port);
+    if(!HostSim::write_port(record->port, record->mask, record->values))
+        return true;
+
+    changed = (previous ^ record->values) & record->mask;
+    if((edge_callback != nullptr) && (changed != 0))
+        edge_callback(edge_callback_arg, record->port,
+                changed & record->values, changed & ~record->values);
+
+    return true;
+}
+
+/* Move the virtual clock to the next record time (never backwards) */
+bool HostSimStimulus::advance_to_next(void)
+{
+    uint64_t time_ns;
+
+    if(!get_next_time_ns(&time_ns))
+        return false;
+
+    if(time_ns > HostSim::get_time_ns())
+        HostSim::set_time_ns(time_ns);
+    else
+        apply_until(HostSim::get_time_ns());
+
+    return true;
+}
+
+/* Get the time of the next record to be applied */
+bool HostSimStimulus::get_next_time_ns(uint64_t* time_ns)
+{
+    if(next_record >= num_records)
+        return false;
+
+    *time_ns = records[next_record].time_ns;
+    return true;
+}
+
+/* Check if all the stimulus records have been applied */
+bool HostSimStimulus::is_finished(void)
+{
+    return (next_record >= num_records);
+}
+
+/* Set the function to be called when the stimulus changes some pins */
+void HostSimStimulus::set_edge_callback(
+        the_hal_host_sim_edge_callback callback, void* arg)
+{
+    edge_callback = callback;
+    edge_callback_arg = arg;
+}
+
+/*****************************************************************************/
+
+#endif /* !defined(ARDUINO) and !defined(ESP_IDF) and .. */
+
+/*****************************************************************************/
@@ -0,0 +1,119 @@
+
+/**
+ * @file    host_sim_stimulus.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host Simulation Stimulus Replay (deterministic inputs from a recorded or
+ * generated stimulus file, driven by the virtual clock).
+ *
+ * The stimulus is an array of records that is used in place (i.e. from a
+ * memory-mapped file), so no copy nor allocation is done while replaying.
+ * Each time the virtual clock moves, the records that are due are applied
+ * to the simulated ports, one by one with the clock at the record time, so
+ * DigitalIn::read() and DigitalInBus::read() see the recorded levels, and
+ * the edge callback is called with the pins that changed (as a pin change
+ * interrupt would). advance_to_next() jumps the
+ * virtual clock from one record to the next, so hours of traffic are
+ * replayed as fast as the firmware code under test runs.
+ *
+ * Stimulus format (host endianness):
+ *   Header: "THST", version (u8), reserved (3 bytes).
+ *   Records: time in ns (u64), pins mask (u32), pins values (u32),
+ *            port (u8), reserved (7 bytes). Sorted by time.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_HOST_SIM_STIMULUS_H_
+#define THE_HAL_HOST_SIM_STIMULUS_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define THE_HAL_HOST_SIM_STIMULUS_HEADER_SIZE 8
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef struct
+{
+    uint64_t time_ns;
+    uint32_t mask;
+    uint32_t values;
+    uint8_t port;
+    uint8_t reserved[7];
+} the_hal_host_sim_stimulus_record;
+
+/* Edge callback, rising and falling are the port bits that changed */
+typedef void (*the_hal_host_sim_edge_callback)(void* arg, const uint8_t port,
+        const uint32_t rising, const uint32_t falling);
+
+/*****************************************************************************/
+
+/* Class */
+
+class HostSimStimulus
+{
+    public:
+        static bool load(const void* data, const size_t size);
+        static bool map_file(const char* path);
+        static void unload(void);
+        static bool rewind(void);
+
+        static uint32_t apply_until(const uint64_t time_ns);
+        static bool apply_next(const uint64_t until_ns);
+        static bool advance_to_next(void);
+        static bool get_next_time_ns(uint64_t* time_ns);
+        static bool is_finished(void);
+
+        static void set_edge_callback(
+                the_hal_host_sim_edge_callback callback, void* arg);
+
+    private:
+        static const the_hal_host_sim_stimulus_record* records;
+        static size_t num_records;
+        static size_t next_record;
+        static void* mapped_data;
+        static size_t mapped_size;
+        static the_hal_host_sim_edge_callback edge_callback;
+        static void* edge_callback_arg;
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_HOST_SIM_STIMULUS_H_ */
@@ -0,0 +1,56 @@
+// Requires THE_HAL_COMPONENT_KEYPAD enabled in thehal.h
+// Scans a 4x4 keypad every 5 ms and prints the pressed and released keys
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_ROWS 4
+#define NUM_COLUMNS 4
+
+#define SCAN_PERIOD_MS 5
+
+/*****************************************************************************/
+
+const char KEYS[NUM_ROWS * NUM_COLUMNS + 1] = "123A456B789C*0#D";
+
+const int8_t COLUMN_PINS[NUM_COLUMNS] = { 6, 7, 8, 9 };
+
+DigitalOut Row0(2);
+DigitalOut Row1(3);
+DigitalOut Row2(4);
+DigitalOut Row3(5);
+DigitalOut* Rows[NUM_ROWS] = { &Row0, &Row1, &Row2, &Row3 };
+
+DigitalInBus Columns(COLUMN_PINS, NUM_COLUMNS);
+Keypad MyKeypad(Rows, NUM_ROWS, &Columns, NUM_COLUMNS);
+
+/*****************************************************************************/
+
+void print_keys(const char* event, uint64_t keys)
+{
+    for(uint8_t i = 0; i < NUM_ROWS * NUM_COLUMNS; i++)
+    {
+        if(keys & (1ULL << i))
+        {
+            Serial.print(event);
+            Serial.println(KEYS[i]);
+        }
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    MyKeypad.setup();
+}
+
+void loop()
+{
+    MyKeypad.scan();
+    print_keys("Pressed: ", MyKeypad.get_pressed());
+    print_keys("Released: ", MyKeypad.get_released());
+    if(MyKeypad.get_ghost_keys())
+        Serial.println("Ghosting, too many keys pressed");
+
+    delay(SCAN_PERIOD_MS);
+}
@@ -0,0 +1,245 @@
+
+/**
+ * @file    keypad.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Matrix Keypad Controller (rows driven by DigitalOut pins and columns read
+ * through a DigitalInBus with pull-up resistors).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_KEYPAD == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "keypad.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    COLUMNS_PULLUP = 1,
+    ROW_ACTIVE = 0,
+    ROW_INACTIVE = 1
+} the_hal_keypad_constants;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* Keypad constructor */
+Keypad::Keypad(DigitalOut** rows, const uint8_t num_rows,
+        DigitalInBus* columns, const uint8_t num_columns)
+{
+    this->columns = columns;
+    this->num_rows = 0;
+    this->num_columns = 0;
+    this->keys = 0;
+    this->last_keys = 0;
+    this->counter_low = 0;
+    this->counter_high = 0;
+    this->ghost_keys = 0;
+    this->columns_mask = 0;
+    this->initialized = false;
+    if((num_rows > THE_HAL_KEYPAD_MAX_ROWS) ||
+       (num_columns > THE_HAL_KEYPAD_MAX_COLUMNS))
+        return;
+
+    for(uint8_t i = 0; i < num_rows; i++)
+        this->rows[i] = rows[i];
+    this->num_rows = num_rows;
+    this->num_columns = num_columns;
+    this->columns_mask = (1UL << num_columns) - 1;
+}
+
+/* Keypad destructor */
+Keypad::~Keypad()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize rows as open-drain outputs (released, not selected) and
+ * columns with pull-ups */
+bool Keypad::setup(void)
+{
+    if((this->num_rows == 0) || (this->num_columns == 0))
+        return false;
+    if(this->columns == nullptr)
+        return false;
+
+    for(uint8_t i = 0; i < this->num_rows; i++)
+    {
+        if(this->rows[i] == nullptr)
+            return false;
+        if(!this->rows[i]->setup_open_drain(ROW_INACTIVE))
+            return false;
+    }
+    if(!this->columns->setup(COLUMNS_PULLUP))
+        return false;
+
+    this->initialized = true;
+    return true;
+}
+
+/* Scan all the keypad and debounce it (to be called periodically, i.e.
+ * every 5 ms), returns the debounced keys mask */
+uint64_t Keypad::scan(void)
+{
+    uint32_t rows_columns[THE_HAL_KEYPAD_MAX_ROWS];
+    uint64_t sample;
+
+    if(!this->initialized)
+        return 0;
+
+    sample = read_matrix(rows_columns);
+
+    // Ambiguous keys keep their state until the ghosting pattern is gone
+    this->ghost_keys = find_ghost_keys(rows_columns);
+    sample = (sample & ~this->ghost_keys) | (this->keys & this->ghost_keys);
+
+    this->last_keys = this->keys;
+    debounce(sample);
+
+    return this->keys;
+}
+
+/* Get debounced pressed keys mask (bit row * columns + column) */
+uint64_t Keypad::get_keys(void)
+{
+    return this->keys;
+}
+
+/* Get keys that have been pressed in the last scan */
+uint64_t Keypad::get_pressed(void)
+{
+    return (this->keys & ~this->last_keys);
+}
+
+/* Get keys that have been released in the last scan */
+uint64_t Keypad::get_released(void)
+{
+    return (~this->keys & this->last_keys);
+}
+
+/* Get keys that could not be resolved in the last scan due to ghosting */
+uint64_t Keypad::get_ghost_keys(void)
+{
+    return this->ghost_keys;
+}
+
+/* Check if a key is pressed (debounced) */
+bool Keypad::is_pressed(const uint8_t row, const uint8_t column)
+{
+    if((row >= this->num_rows) || (column >= this->num_columns))
+        return false;
+
+    return ((this->keys >> (row * this->num_columns + column)) & 1);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Select each row and take a snapshot of all the columns at once, returns
+ * the raw keys mask and the pressed columns of each row */
+uint64_t Keypad::read_matrix(uint32_t* rows_columns)
+{
+    uint64_t sample = 0;
+    uint32_t pressed;
+
+    for(uint8_t row = 0; row < this->num_rows; row++)
+    {
+        this->rows[row]->set_low();
+        settle();
+        pressed = ~(this->columns->read()) & this->columns_mask;
+        this->rows[row]->set_high();
+
+        rows_columns[row] = pressed;
+        sample = sample | ((uint64_t)pressed << (row * this->num_columns));
+    }
+
+    return sample;
+}
+
+/* Get keys of any two rows that share 2 or more pressed columns */
+uint64_t Keypad::find_ghost_keys(const uint32_t* rows_columns)
+{
+    uint64_t ghost_keys = 0;
+    uint32_t common;
+
+    for(uint8_t i = 0; i < this->num_rows; i++)
+    {
+        // A row with less than 2 pressed columns can not be part of it
+        if((rows_columns[i] & (rows_columns[i] - 1)) == 0)
+            continue;
+
+        for(uint8_t j = i + 1; j < this->num_rows; j++)
+        {
+            common = rows_columns[i] & rows_columns[j];
+            if((common & (common - 1)) == 0)
+                continue;
+            ghost_keys = ghost_keys |
+                    ((uint64_t)common << (i * this->num_columns)) |
+                    ((uint64_t)common << (j * this->num_columns));
+        }
+    }
+
+    return ghost_keys;
+}
+
+/* Debounce all keys at once with a 2 bits vertical counter per key (the
+ * counter of a key is reset each time its sample equals its state) */
+void Keypad::debounce(const uint64_t sample)
+{
+    uint64_t changed = sample ^ this->keys;
+
+    this->counter_high = (this->counter_high ^ this->counter_low) & changed;
+    this->counter_low = ~this->counter_low & changed;
+
+    // Counter wraps to 0 after 4 scans with a different value
+    this->keys = this->keys ^
+            (changed & ~(this->counter_low | this->counter_high));
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_KEYPAD == 1 */
+
+/*****************************************************************************/
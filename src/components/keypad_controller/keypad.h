@@ -0,0 +1,129 @@
+
+/**
+ * @file    keypad.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Matrix Keypad Controller (rows driven by open-drain DigitalOut pins and
+ * columns read through a DigitalInBus with pull-up resistors).
+ *
+ * Each scan drives low one row at a time and takes a single snapshot of all
+ * the columns, so a full scan is one write and one bus read per row. Rows
+ * that are not selected are released (open-drain high), so two keys pressed
+ * in the same column never short a low row to a high one. The columns are
+ * read a few loops after selecting the row (THE_HAL_KEYPAD_SETTLE_LOOPS),
+ * to let the pull-ups charge the lines of the previous row. Keys
+ * are kept as a bitmask (bit row * columns + column), so all of them are
+ * debounced at once with a vertical counter: a key changes its state after
+ * 4 consecutive scans with the new value.
+ *
+ * Without diodes, pressing 3 corners of a rectangle makes the 4th one look
+ * pressed (ghosting). It is detected as two rows sharing 2 or more pressed
+ * columns; those keys are ambiguous and keep their last debounced state
+ * until the pattern goes away.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_KEYPAD == 1
+
+/* Include Guard */
+#ifndef THE_HAL_KEYPAD_H_
+#define THE_HAL_KEYPAD_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of rows of the keypad */
+#define THE_HAL_KEYPAD_MAX_ROWS 8
+
+/* Maximum number of columns of the keypad (rows * columns up to 64) */
+#define THE_HAL_KEYPAD_MAX_COLUMNS 8
+
+/* Busy loops between selecting a row and reading the columns */
+#define THE_HAL_KEYPAD_SETTLE_LOOPS 8
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Class */
+
+class Keypad
+{
+    public:
+        Keypad(DigitalOut** rows, const uint8_t num_rows,
+                DigitalInBus* columns, const uint8_t num_columns);
+        ~Keypad();
+
+        bool setup(void);
+        uint64_t scan(void);
+
+        uint64_t get_keys(void);
+        uint64_t get_pressed(void);
+        uint64_t get_released(void);
+        uint64_t get_ghost_keys(void);
+        bool is_pressed(const uint8_t row, const uint8_t column);
+
+    private:
+        DigitalOut* rows[THE_HAL_KEYPAD_MAX_ROWS];
+        DigitalInBus* columns;
+        uint64_t keys;
+        uint64_t last_keys;
+        uint64_t counter_low;
+        uint64_t counter_high;
+        uint64_t ghost_keys;
+        uint32_t columns_mask;
+        uint8_t num_rows;
+        uint8_t num_columns;
+        bool initialized;
+
+        uint64_t read_matrix(uint32_t* rows_columns);
+        uint64_t find_ghost_keys(const uint32_t* rows_columns);
+        void debounce(const uint64_t sample);
+
+        /* Wait for the columns to settle (empty asm keeps the loop) */
+        inline void settle(void)
+        {
+            for(uint16_t i = 0; i < THE_HAL_KEYPAD_SETTLE_LOOPS; i++)
+                __asm__ __volatile__("");
+        }
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_KEYPAD_H_
+#endif // THE_HAL_COMPONENT_KEYPAD
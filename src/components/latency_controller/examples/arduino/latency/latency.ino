@@ -0,0 +1,68 @@
+// Requires THE_HAL_COMPONENT_LATENCY enabled in thehal.h
+// Measures the latency from an INT0 edge (pin 2) to the main loop handler
+// and the jitter of a 1 kHz output toggled from the loop, dumping both
+// histograms every second
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define OUTPUT_PERIOD_US 1000
+
+/*****************************************************************************/
+
+DigitalOut MyOutput(13);
+
+LatencyHistogram EdgeLatency;
+LatencyHistogram OutputJitter;
+JitterProbe OutputProbe(&OutputJitter, (F_CPU / 1000000) * OUTPUT_PERIOD_US);
+
+volatile the_hal_cycles edge_time;
+volatile bool edge_pending = false;
+
+uint32_t last_toggle_us = 0;
+uint32_t last_dump_ms = 0;
+
+/*****************************************************************************/
+
+bool serial_writer(void* arg, const uint8_t* data, const uint16_t size)
+{
+    return (Serial.write(data, size) == size);
+}
+
+void on_edge()
+{
+    edge_time = CycleCounter::read();
+    edge_pending = true;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    MyOutput.setup(0);
+    CycleCounter::setup();
+    attachInterrupt(digitalPinToInterrupt(2), on_edge, RISING);
+}
+
+void loop()
+{
+    if(edge_pending)
+    {
+        EdgeLatency.record_since(edge_time);
+        edge_pending = false;
+    }
+
+    if((micros() - last_toggle_us) >= OUTPUT_PERIOD_US)
+    {
+        last_toggle_us = last_toggle_us + OUTPUT_PERIOD_US;
+        MyOutput.toggle();
+        OutputProbe.mark();
+    }
+
+    if((millis() - last_dump_ms) >= 1000)
+    {
+        last_dump_ms = millis();
+        EdgeLatency.dump(serial_writer, nullptr);
+        OutputJitter.dump(serial_writer, nullptr);
+        OutputProbe.reset();
+    }
+}
@@ -0,0 +1,451 @@
+
+/**
+ * @file    latency.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Latency Instrumentation Controller (cycle counter timestamps and latency
+ * histograms that can be updated from interrupts).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_LATENCY == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "latency.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    #include "esp_cpu.h"
+    #include "esp_rom_sys.h"
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+      defined(__ARM_ARCH_8M_MAIN__)
+    #define THE_HAL_LATENCY_DWT
+    extern uint32_t SystemCoreClock;
+#elif defined(ARDUINO)
+    #include <Arduino.h>
+#elif !defined(SAM_ASF)
+    #include <time.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Cortex-M Debug Exception and Monitor Control and DWT registers */
+#if defined(THE_HAL_LATENCY_DWT)
+    #define DEMCR (*(volatile uint32_t*)0xE000EDFCUL)
+    #define DEMCR_TRCENA (1UL << 24)
+    #define DWT_CTRL (*(volatile uint32_t*)0xE0001000UL)
+    #define DWT_CTRL_CYCCNTENA (1UL << 0)
+    #define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004UL)
+#endif
+
+/* Largest value that can be recorded */
+static const uint32_t MAX_VALUE = (THE_HAL_LATENCY_VALUE_BITS >= 32) ?
+        0xffffffffUL : ((1UL << THE_HAL_LATENCY_VALUE_BITS) - 1);
+
+/* Size of the dump text buffer */
+static const uint8_t DUMP_SIZE = 96;
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Get the position of the highest bit set of a non zero value */
+static inline uint8_t highest_bit(const uint32_t value)
+{
+#if defined(__AVR__)
+    return (uint8_t)(31 - __builtin_clzl(value));
+#else
+    return (uint8_t)(31 - __builtin_clz(value));
+#endif
+}
+
+/* Append a text to a text buffer */
+static uint8_t append_text(char* text, uint8_t length, const char* label)
+{
+    while((*label != '\0') && (length < DUMP_SIZE))
+    {
+        text[length] = *label;
+        length = length + 1;
+        label = label + 1;
+    }
+
+    return length;
+}
+
+/* Append a text and an unsigned decimal number to a text buffer */
+static uint8_t append_value(char* text, uint8_t length, const char* label,
+        uint32_t value)
+{
+    char digits[10];
+    uint8_t num_digits = 0;
+
+    length = append_text(text, length, label);
+    do
+    {
+        digits[num_digits] = (char)('0' + (value % 10));
+        num_digits = num_digits + 1;
+        value = value / 10;
+    } while(value != 0);
+    while((num_digits > 0) && (length < DUMP_SIZE))
+    {
+        num_digits = num_digits - 1;
+        text[length] = digits[num_digits];
+        length = length + 1;
+    }
+
+    return length;
+}
+
+/*****************************************************************************/
+
+/* CycleCounter Public Methods */
+
+/* Start the cycle counter (returns false if target has none) */
+bool CycleCounter::setup(void)
+{
+#if defined(__AVR__)
+    #if THE_HAL_LATENCY_AVR_SETUP_TIMER1 == 1
+        TCCR1A = 0;
+        TCCR1B = (1 << CS10);
+    #endif
+    return true;
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    return true;
+#elif defined(THE_HAL_LATENCY_DWT)
+    DEMCR = DEMCR | DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL = DWT_CTRL | DWT_CTRL_CYCCNTENA;
+    return true;
+#elif defined(ARDUINO) || !defined(SAM_ASF)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* Get current cycle counter value (safe to be called from interrupts) */
+the_hal_cycles CycleCounter::read(void)
+{
+#if defined(__AVR__)
+    // 16 bits timer reads share the TEMP register with interrupts
+    uint8_t sreg = SREG;
+    cli();
+    the_hal_cycles cycles = TCNT1;
+    SREG = sreg;
+    return cycles;
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    return (the_hal_cycles)esp_cpu_get_cycle_count();
+#elif defined(THE_HAL_LATENCY_DWT)
+    return DWT_CYCCNT;
+#elif defined(ARDUINO)
+    return (the_hal_cycles)micros();
+#elif !defined(SAM_ASF)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (the_hal_cycles)((now.tv_sec * 1000000000ULL) + now.tv_nsec);
+#else
+    return 0;
+#endif
+}
+
+/* Get cycle counter frequency (0 if unknown) */
+uint32_t CycleCounter::get_hz(void)
+{
+#if defined(__AVR__)
+    return F_CPU;
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    return esp_rom_get_cpu_ticks_per_us() * 1000000UL;
+#elif defined(THE_HAL_LATENCY_DWT)
+    return SystemCoreClock;
+#elif defined(ARDUINO)
+    return 1000000UL;
+#elif !defined(SAM_ASF)
+    return 1000000000UL;
+#else
+    return 0;
+#endif
+}
+
+/* Convert cycle counter units to nanoseconds */
+uint32_t CycleCounter::to_ns(const uint32_t cycles)
+{
+    uint32_t hz = get_hz();
+
+    if(hz == 0)
+        return 0;
+
+    return (uint32_t)(((uint64_t)cycles * 1000000000ULL) / hz);
+}
+
+/*****************************************************************************/
+
+/* LatencyHistogram Constructor */
+
+/* LatencyHistogram constructor */
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+/* LatencyHistogram destructor */
+LatencyHistogram::~LatencyHistogram()
+{}
+
+/*****************************************************************************/
+
+/* LatencyHistogram Public Methods */
+
+/* Clear all the recorded values (not to be used while recording) */
+void LatencyHistogram::reset(void)
+{
+    for(uint16_t i = 0; i < THE_HAL_LATENCY_BUCKETS; i++)
+        this->counts[i] = 0;
+    this->count = 0;
+    this->max = 0;
+}
+
+/* Record a value (can be called from interrupts and main code) */
+void LatencyHistogram::record(const uint32_t value)
+{
+    uint32_t clamped = (value > MAX_VALUE) ? MAX_VALUE : value;
+    uint16_t bucket = get_bucket(clamped);
+
+#if defined(__AVR__)
+    // 32 bits updates take several instructions, an interrupt that records
+    // in the middle of a main code recording would be lost
+    uint8_t sreg = SREG;
+    cli();
+    this->counts[bucket] = this->counts[bucket] + 1;
+    this->count = this->count + 1;
+    if(clamped > this->max)
+        this->max = clamped;
+    SREG = sreg;
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+    uint32_t max = __atomic_load_n(&this->max, __ATOMIC_RELAXED);
+
+    __atomic_fetch_add(&this->counts[bucket], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&this->count, 1, __ATOMIC_RELAXED);
+    while(clamped > max)
+    {
+        if(__atomic_compare_exchange_n(&this->max, &max, clamped, true,
+                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            break;
+    }
+#else
+    // No atomic read-modify-write without libatomic (i.e. Cortex-M0), a
+    // load and a store are enough as long as recordings do not preempt
+    // each other
+    __atomic_store_n(&this->counts[bucket], this->counts[bucket] + 1,
+            __ATOMIC_RELAXED);
+    __atomic_store_n(&this->count, this->count + 1, __ATOMIC_RELAXED);
+    if(clamped > this->max)
+        __atomic_store_n(&this->max, clamped, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Record the cycles elapsed since a cycle counter timestamp */
+void LatencyHistogram::record_since(const the_hal_cycles start)
+{
+    record((the_hal_cycles)(CycleCounter::read() - start));
+}
+
+/* Get number of recorded values */
+uint32_t LatencyHistogram::get_count(void)
+{
+    return load(&this->count);
+}
+
+/* Get largest recorded value */
+uint32_t LatencyHistogram::get_max(void)
+{
+    return load(&this->max);
+}
+
+/* Get the value below which are the given per mille of the recorded values
+ * (i.e. 500 for p50, 990 for p99, 999 for p99.9), it is the highest value
+ * of its bucket */
+uint32_t LatencyHistogram::get_percentile(const uint16_t per_mille)
+{
+    uint32_t count = get_count();
+    uint32_t max = get_max();
+    uint32_t accumulated = 0;
+    uint32_t target;
+
+    if(count == 0)
+        return 0;
+
+    target = (uint32_t)((((uint64_t)count *
+            ((per_mille > 1000) ? 1000 : per_mille)) + 999) / 1000);
+    if(target == 0)
+        target = 1;
+
+    for(uint16_t bucket = 0; bucket < THE_HAL_LATENCY_BUCKETS; bucket++)
+    {
+        accumulated = accumulated + load(&this->counts[bucket]);
+        if(accumulated >= target)
+        {
+            uint32_t value = get_bucket_max(bucket);
+            return (value < max) ? value : max;
+        }
+    }
+
+    return max;
+}
+
+/* Write a text line with the count, p50, p99, p99.9 and max (cycle
+ * counter units) */
+bool LatencyHistogram::dump(the_hal_latency_writer writer, void* arg)
+{
+    char text[DUMP_SIZE];
+    uint8_t length = 0;
+
+    if(writer == nullptr)
+        return false;
+
+    length = append_value(text, length, "count=", get_count());
+    length = append_value(text, length, " p50=", get_percentile(500));
+    length = append_value(text, length, " p99=", get_percentile(990));
+    length = append_value(text, length, " p99.9=", get_percentile(999));
+    length = append_value(text, length, " max=", get_max());
+    length = append_value(text, length, " cycles@", CycleCounter::get_hz());
+    length = append_text(text, length, "Hz\n");
+
+    return writer(arg, (const uint8_t*)text, length);
+}
+
+/* Get the bucket of a value (linear below SUB_BUCKETS, then SUB_BUCKETS
+ * buckets for each power of two) */
+uint16_t LatencyHistogram::get_bucket(const uint32_t value)
+{
+    uint8_t shift;
+
+    if(value < THE_HAL_LATENCY_SUB_BUCKETS)
+        return (uint16_t)value;
+
+    shift = highest_bit(value) - THE_HAL_LATENCY_SUB_BUCKET_BITS;
+    return (uint16_t)(((shift + 1) * THE_HAL_LATENCY_SUB_BUCKETS) +
+            ((value >> shift) & (THE_HAL_LATENCY_SUB_BUCKETS - 1)));
+}
+
+/* Get the highest value of a bucket */
+uint32_t LatencyHistogram::get_bucket_max(const uint16_t bucket)
+{
+    uint8_t shift;
+    uint32_t sub_bucket;
+
+    if(bucket < THE_HAL_LATENCY_SUB_BUCKETS)
+        return bucket;
+
+    shift = (uint8_t)((bucket / THE_HAL_LATENCY_SUB_BUCKETS) - 1);
+    sub_bucket = bucket & (THE_HAL_LATENCY_SUB_BUCKETS - 1);
+    return ((THE_HAL_LATENCY_SUB_BUCKETS + sub_bucket) << shift) +
+            ((1UL << shift) - 1);
+}
+
+/*****************************************************************************/
+
+/* LatencyHistogram Private Methods */
+
+/* Read a counter that can be modified by an interrupt */
+uint32_t LatencyHistogram::load(volatile uint32_t* counter)
+{
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    uint32_t value = *counter;
+    SREG = sreg;
+    return value;
+#else
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+#endif
+}
+
+/*****************************************************************************/
+
+/* JitterProbe Constructor */
+
+/* JitterProbe constructor */
+JitterProbe::JitterProbe(LatencyHistogram* histogram,
+        const the_hal_cycles expected_period)
+{
+    this->histogram = histogram;
+    this->expected_period = expected_period;
+    this->last = 0;
+    this->started = false;
+}
+
+/* JitterProbe destructor */
+JitterProbe::~JitterProbe()
+{}
+
+/*****************************************************************************/
+
+/* JitterProbe Public Methods */
+
+/* Forget last event, next mark() starts a new measurement */
+void JitterProbe::reset(void)
+{
+    this->started = false;
+}
+
+/* Mark an occurrence of the periodic event (i.e. when a DigitalOut edge is
+ * generated) and record its deviation from the expected period */
+void JitterProbe::mark(void)
+{
+    the_hal_cycles now = CycleCounter::read();
+    the_hal_cycles period = (the_hal_cycles)(now - this->last);
+
+    if(this->started)
+    {
+        if(period > this->expected_period)
+            this->histogram->record(period - this->expected_period);
+        else
+            this->histogram->record(this->expected_period - period);
+    }
+    this->last = now;
+    this->started = true;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_LATENCY == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,179 @@
+
+/**
+ * @file    latency.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Latency Instrumentation Controller (cycle counter timestamps and latency
+ * histograms that can be updated from interrupts).
+ *
+ * Timestamps are taken from the cheapest free running counter of each
+ * target: DWT CYCCNT on Cortex-M3 and higher, CCOUNT on ESP32, TCNT1 on AVR
+ * (16 bits, latencies up to 65535 cycles) and CLOCK_MONOTONIC nanoseconds
+ * on Linux and host builds.
+ *
+ * Histograms are log-linear (HDR-style): values below 2^SUB_BUCKET_BITS
+ * have their own bucket, and each power of two above is split in
+ * 2^SUB_BUCKET_BITS buckets, so the relative error of any reported value
+ * is bounded by 2^-SUB_BUCKET_BITS with a fixed and small memory size.
+ * Recording is an index computation and a counter increment, without
+ * locks (on AVR, interrupts are masked for the few instructions of the
+ * 32 bits increments, so main code and interrupts can record into the same
+ * histogram).
+ *
+ *   LatencyHistogram EdgeLatency;
+ *   the_hal_cycles edge_time;
+ *
+ *   void on_edge_isr() { edge_time = CycleCounter::read(); ... }
+ *   void handler() { EdgeLatency.record_since(edge_time); ... }
+ *
+ *   EdgeLatency.dump(writer, nullptr);   // count, p50, p99, p99.9, max
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_LATENCY == 1
+
+/* Include Guard */
+#ifndef THE_HAL_LATENCY_H_
+#define THE_HAL_LATENCY_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Histogram buckets per power of two (2^SUB_BUCKET_BITS) and width of the
+ * recorded values */
+#if defined(__AVR__)
+    #define THE_HAL_LATENCY_SUB_BUCKET_BITS 2
+    #define THE_HAL_LATENCY_VALUE_BITS 16
+#else
+    #define THE_HAL_LATENCY_SUB_BUCKET_BITS 4
+    #define THE_HAL_LATENCY_VALUE_BITS 32
+#endif
+
+/* Let CycleCounter::setup() start AVR Timer1 free running (no prescaler),
+ * set to 0 if Timer1 is configured by the application */
+#define THE_HAL_LATENCY_AVR_SETUP_TIMER1 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_LATENCY_SUB_BUCKETS = (1 << THE_HAL_LATENCY_SUB_BUCKET_BITS),
+    THE_HAL_LATENCY_BUCKETS = ((THE_HAL_LATENCY_VALUE_BITS -
+            THE_HAL_LATENCY_SUB_BUCKET_BITS + 1) *
+            THE_HAL_LATENCY_SUB_BUCKETS)
+} the_hal_latency_constants;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Cycle counter timestamp (differences wrap with the counter width) */
+#if defined(__AVR__)
+    typedef uint16_t the_hal_cycles;
+#else
+    typedef uint32_t the_hal_cycles;
+#endif
+
+/* Report writer, it must return false if data can't be written */
+typedef bool (*the_hal_latency_writer)(void* arg, const uint8_t* data,
+        const uint16_t size);
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Free running cycle counter of the target */
+class CycleCounter
+{
+    public:
+        static bool setup(void);
+        static the_hal_cycles read(void);
+        static uint32_t get_hz(void);
+        static uint32_t to_ns(const uint32_t cycles);
+};
+
+/* Log-linear histogram of latencies (cycle counter units) */
+class LatencyHistogram
+{
+    public:
+        LatencyHistogram();
+        ~LatencyHistogram();
+
+        void reset(void);
+        void record(const uint32_t value);
+        void record_since(const the_hal_cycles start);
+
+        uint32_t get_count(void);
+        uint32_t get_max(void);
+        uint32_t get_percentile(const uint16_t per_mille);
+        bool dump(the_hal_latency_writer writer, void* arg);
+
+        static uint16_t get_bucket(const uint32_t value);
+        static uint32_t get_bucket_max(const uint16_t bucket);
+
+    private:
+        volatile uint32_t counts[THE_HAL_LATENCY_BUCKETS];
+        volatile uint32_t count;
+        volatile uint32_t max;
+
+        uint32_t load(volatile uint32_t* counter);
+};
+
+/* Jitter of a periodic event (deviation from the expected period) */
+class JitterProbe
+{
+    public:
+        JitterProbe(LatencyHistogram* histogram,
+                const the_hal_cycles expected_period);
+        ~JitterProbe();
+
+        void reset(void);
+        void mark(void);
+
+    private:
+        LatencyHistogram* histogram;
+        the_hal_cycles expected_period;
+        the_hal_cycles last;
+        bool started;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_LATENCY_H_
+#endif // THE_HAL_COMPONENT_LATENCY
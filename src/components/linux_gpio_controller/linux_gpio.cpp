@@ -0,0 +1,329 @@
+
+/**
+ * @file    linux_gpio.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Linux GPIO Character Device Controller (gpiochip v2 uAPI line requests
+ * used by linux backends).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if defined(LINUX_GPIO)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "linux_gpio.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    NO_FD = -1,
+    KERNEL_EVENTS_BUFFER = (THE_HAL_LINUX_GPIO_EVENTS_BATCH * 4)
+} the_hal_linux_gpio_constants;
+
+/*****************************************************************************/
+
+/* System Operations */
+
+static int system_open(const char* path, int flags)
+{ return open(path, flags); }
+
+static int system_close(int fd)
+{ return close(fd); }
+
+static int system_ioctl(int fd, unsigned long request, void* arg)
+{ return ioctl(fd, request, arg); }
+
+static ssize_t system_read(int fd, void* buffer, size_t size)
+{ return read(fd, buffer, size); }
+
+static int system_poll(struct pollfd* fds, nfds_t num_fds, int timeout_ms)
+{ return poll(fds, num_fds, timeout_ms); }
+
+static const the_hal_linux_gpio_ops SYSTEM_OPS =
+{
+    system_open,
+    system_close,
+    system_ioctl,
+    system_read,
+    system_poll
+};
+
+/*****************************************************************************/
+
+/* Static Members */
+
+const the_hal_linux_gpio_ops* LinuxGpioLines::ops = &SYSTEM_OPS;
+int LinuxGpioLines::chip_fd = NO_FD;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* LinuxGpioLines constructor */
+LinuxGpioLines::LinuxGpioLines()
+{
+    this->fd = NO_FD;
+    this->num_lines = 0;
+}
+
+/* LinuxGpioLines destructor */
+LinuxGpioLines::~LinuxGpioLines()
+{
+    release();
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Request a group of lines with the same flags (one line file descriptor) */
+bool LinuxGpioLines::request(const int8_t* io_pins, const uint8_t num_pins,
+        const uint64_t flags, const uint32_t initial_values)
+{
+    struct gpio_v2_line_request request;
+
+    if(is_requested())
+        return false;
+    if((num_pins == 0) || (num_pins > THE_HAL_LINUX_GPIO_MAX_LINES))
+        return false;
+    if(!open_chip())
+        return false;
+
+    memset(&request, 0, sizeof(request));
+    for(uint8_t i = 0; i < num_pins; i++)
+    {
+        if(io_pins[i] < 0)
+            return false;
+        request.offsets[i] = (uint32_t)(io_pins[i]);
+        this->offsets[i] = (uint8_t)(io_pins[i]);
+    }
+    strncpy(request.consumer, THE_HAL_LINUX_GPIO_CONSUMER,
+            sizeof(request.consumer) - 1);
+    request.num_lines = num_pins;
+    request.event_buffer_size = KERNEL_EVENTS_BUFFER;
+    this->num_lines = num_pins;
+    fill_config(&request.config, flags, initial_values);
+
+    if(ops->ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &request) < 0)
+    {
+        this->num_lines = 0;
+        return false;
+    }
+    this->fd = request.fd;
+
+    return true;
+}
+
+/* Change flags (and output values) of all the requested lines at once */
+bool LinuxGpioLines::reconfigure(const uint64_t flags, const uint32_t values)
+{
+    struct gpio_v2_line_config config;
+
+    if(!is_requested())
+        return false;
+
+    fill_config(&config, flags, values);
+    return (ops->ioctl(this->fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) >= 0);
+}
+
+/* Release the lines so they can be requested again */
+bool LinuxGpioLines::release(void)
+{
+    int fd = this->fd;
+
+    if(!is_requested())
+        return false;
+
+    this->fd = NO_FD;
+    this->num_lines = 0;
+    return (ops->close(fd) >= 0);
+}
+
+/* Check if the lines are currently requested */
+bool LinuxGpioLines::is_requested(void)
+{
+    return (this->fd >= 0);
+}
+
+/* Set the values of the lines of mask (bit N is the Nth requested line) */
+bool LinuxGpioLines::set_values(const uint32_t values, const uint32_t mask)
+{
+    struct gpio_v2_line_values line_values;
+
+    if(!is_requested())
+        return false;
+
+    line_values.bits = values;
+    line_values.mask = mask;
+    return (ops->ioctl(this->fd, GPIO_V2_LINE_SET_VALUES_IOCTL,
+            &line_values) >= 0);
+}
+
+/* Get the values of all the lines (bit N is the Nth requested line) */
+bool LinuxGpioLines::get_values(uint32_t* values)
+{
+    struct gpio_v2_line_values line_values;
+
+    if(!is_requested())
+        return false;
+
+    line_values.bits = 0;
+    line_values.mask = (this->num_lines >= 32) ?
+            0xffffffffULL : ((1ULL << this->num_lines) - 1);
+    if(ops->ioctl(this->fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &line_values) < 0)
+        return false;
+
+    *values = (uint32_t)(line_values.bits & line_values.mask);
+    return true;
+}
+
+/* Read a batch of pending edge events (waits up to timeout_ms, -1 forever)
+ * returning the number of events read or -1 on error */
+int16_t LinuxGpioLines::read_events(the_hal_linux_gpio_event* events,
+        const uint16_t max_events, const int32_t timeout_ms)
+{
+    struct gpio_v2_line_event kernel_events[THE_HAL_LINUX_GPIO_EVENTS_BATCH];
+    struct pollfd poll_fd;
+    uint16_t num_events = max_events;
+    ssize_t read_bytes;
+    int ready;
+
+    if(!is_requested())
+        return -1;
+    if(num_events > THE_HAL_LINUX_GPIO_EVENTS_BATCH)
+        num_events = THE_HAL_LINUX_GPIO_EVENTS_BATCH;
+    if(num_events == 0)
+        return 0;
+
+    poll_fd.fd = this->fd;
+    poll_fd.events = POLLIN;
+    poll_fd.revents = 0;
+    ready = ops->poll(&poll_fd, 1, timeout_ms);
+    if(ready < 0)
+        return -1;
+    if((ready == 0) || !(poll_fd.revents & POLLIN))
+        return 0;
+
+    // Kernel returns as many whole events as fit in the buffer
+    read_bytes = ops->read(this->fd, kernel_events,
+            num_events * sizeof(struct gpio_v2_line_event));
+    if(read_bytes < 0)
+        return (errno == EAGAIN) ? 0 : -1;
+    num_events = read_bytes / sizeof(struct gpio_v2_line_event);
+
+    for(uint16_t i = 0; i < num_events; i++)
+    {
+        events[i].timestamp_ns = kernel_events[i].timestamp_ns;
+        events[i].rising =
+                (kernel_events[i].id == GPIO_V2_LINE_EVENT_RISING_EDGE);
+        events[i].line = 0;
+        for(uint8_t line = 0; line < this->num_lines; line++)
+        {
+            if(this->offsets[line] == kernel_events[i].offset)
+            {
+                events[i].line = line;
+                break;
+            }
+        }
+    }
+
+    return (int16_t)(num_events);
+}
+
+/* Get line file descriptor (i.e. to be added to an epoll set) */
+int LinuxGpioLines::get_fd(void)
+{
+    return this->fd;
+}
+
+/* Set the system calls used by all line requests (nullptr for system) */
+void LinuxGpioLines::set_ops(const the_hal_linux_gpio_ops* ops)
+{
+    close_chip();
+    LinuxGpioLines::ops = (ops != nullptr) ? ops : &SYSTEM_OPS;
+}
+
+/* Close GPIO chip (already requested lines are not affected) */
+bool LinuxGpioLines::close_chip(void)
+{
+    int fd = chip_fd;
+
+    if(fd < 0)
+        return false;
+
+    chip_fd = NO_FD;
+    return (ops->close(fd) >= 0);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Open GPIO chip once, it is shared by all the line requests */
+bool LinuxGpioLines::open_chip(void)
+{
+    if(chip_fd >= 0)
+        return true;
+
+    chip_fd = ops->open(THE_HAL_LINUX_GPIO_CHIP_PATH, O_RDWR | O_CLOEXEC);
+    return (chip_fd >= 0);
+}
+
+/* Fill lines configuration, output values are applied to all lines */
+void LinuxGpioLines::fill_config(struct gpio_v2_line_config* config,
+        const uint64_t flags, const uint32_t values)
+{
+    memset(config, 0, sizeof(*config));
+    config->flags = flags;
+    if(flags & GPIO_V2_LINE_FLAG_OUTPUT)
+    {
+        config->num_attrs = 1;
+        config->attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        config->attrs[0].attr.values = values;
+        config->attrs[0].mask = (this->num_lines >= 32) ?
+                0xffffffffULL : ((1ULL << this->num_lines) - 1);
+    }
+}
+
+/*****************************************************************************/
+
+#endif /* defined(LINUX_GPIO) */
+
+/*****************************************************************************/
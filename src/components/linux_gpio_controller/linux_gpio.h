@@ -0,0 +1,152 @@
+
+/**
+ * @file    linux_gpio.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Linux GPIO Character Device Controller (gpiochip v2 uAPI line requests
+ * used by linux backends).
+ *
+ * Several GPIOs are grouped in one line request, so reading or writing all
+ * of them is a single ioctl, and edge events of all the lines are read in
+ * batches from the same line file descriptor.
+ *
+ * System calls are done through an injectable operations table, so the
+ * backends can run against an in-process fake chip (see the host tests
+ * extras/tests/linux_gpio_fake_chip.h) instead of a kernel gpiochip.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Include Guard */
+#ifndef THE_HAL_LINUX_GPIO_H_
+#define THE_HAL_LINUX_GPIO_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <poll.h>
+#include <sys/types.h>
+#include <linux/gpio.h>
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* GPIO character device used by linux backends (pin N is line offset N) */
+#define THE_HAL_LINUX_GPIO_CHIP_PATH "/dev/gpiochip0"
+
+/* Consumer label of the line requests (shown by gpioinfo) */
+#define THE_HAL_LINUX_GPIO_CONSUMER "thehal"
+
+/* Maximum number of lines of each line request */
+#define THE_HAL_LINUX_GPIO_MAX_LINES 32
+
+/* Maximum number of edge events read from the kernel in each read() */
+#define THE_HAL_LINUX_GPIO_EVENTS_BATCH 16
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    THE_HAL_LINUX_GPIO_EDGE_NONE = 0,
+    THE_HAL_LINUX_GPIO_EDGE_RISING = 1,
+    THE_HAL_LINUX_GPIO_EDGE_FALLING = 2,
+    THE_HAL_LINUX_GPIO_EDGE_BOTH = 3
+} the_hal_linux_gpio_edge;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* System calls used to access the GPIO character device */
+typedef struct
+{
+    int (*open)(const char* path, int flags);
+    int (*close)(int fd);
+    int (*ioctl)(int fd, unsigned long request, void* arg);
+    ssize_t (*read)(int fd, void* buffer, size_t size);
+    int (*poll)(struct pollfd* fds, nfds_t num_fds, int timeout_ms);
+} the_hal_linux_gpio_ops;
+
+/* Edge event of a line request (line is the index in the request) */
+typedef struct
+{
+    uint64_t timestamp_ns;
+    uint8_t line;
+    bool rising;
+} the_hal_linux_gpio_event;
+
+/*****************************************************************************/
+
+/* Class */
+
+class LinuxGpioLines
+{
+    public:
+        LinuxGpioLines();
+        LinuxGpioLines(const LinuxGpioLines&) = delete;
+        LinuxGpioLines& operator=(const LinuxGpioLines&) = delete;
+        ~LinuxGpioLines();
+
+        bool request(const int8_t* io_pins, const uint8_t num_pins,
+                const uint64_t flags, const uint32_t initial_values);
+        bool reconfigure(const uint64_t flags, const uint32_t values);
+        bool release(void);
+        bool is_requested(void);
+
+        bool set_values(const uint32_t values, const uint32_t mask);
+        bool get_values(uint32_t* values);
+        int16_t read_events(the_hal_linux_gpio_event* events,
+                const uint16_t max_events, const int32_t timeout_ms);
+        int get_fd(void);
+
+        static void set_ops(const the_hal_linux_gpio_ops* ops);
+        static bool close_chip(void);
+
+    private:
+        int fd;
+        uint8_t num_lines;
+        uint8_t offsets[THE_HAL_LINUX_GPIO_MAX_LINES];
+
+        static const the_hal_linux_gpio_ops* ops;
+        static int chip_fd;
+
+        static bool open_chip(void);
+        void fill_config(struct gpio_v2_line_config* config,
+                const uint64_t flags, const uint32_t values);
+};
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_LINUX_GPIO_H_ */
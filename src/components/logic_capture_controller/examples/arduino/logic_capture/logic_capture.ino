@@ -0,0 +1,44 @@
+// Requires THE_HAL_COMPONENT_LOGIC_CAPTURE enabled in thehal.h
+// Samples 4 pins at 10 kHz (AVR Timer1) and streams the capture to Serial
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define SAMPLE_PERIOD_NS 100000
+
+/*****************************************************************************/
+
+const int8_t CAPTURE_PINS[4] = { 2, 3, 4, 5 };
+
+DigitalInBus MyBus(CAPTURE_PINS, 4);
+LogicCapture MyCapture(&MyBus, 4);
+
+/*****************************************************************************/
+
+bool serial_writer(void* arg, const uint8_t* data, const uint16_t size)
+{
+    return (Serial.write(data, size) == size);
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyCapture.sample();
+}
+
+void setup()
+{
+    Serial.begin(1000000);
+    MyBus.setup(THE_HAL_DIGITAL_IN_PULLUP);
+    MyCapture.start(SAMPLE_PERIOD_NS);
+
+    // Timer1 CTC mode, prescaler 8, 10 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / 10000) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    MyCapture.stream(serial_writer, nullptr);
+}
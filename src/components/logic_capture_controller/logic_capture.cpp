@@ -0,0 +1,612 @@
+
+/**
+ * @file    logic_capture.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Logic Capture Controller (run-length encoded DigitalInBus sampling).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_LOGIC_CAPTURE == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "logic_capture.h"
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__) and !defined(LINUX_GPIO)
+    #include "../host_sim_controller/host_sim.h"
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    FORMAT_VERSION = 1,
+    MAX_PINS = 32,
+    MAX_RECORD_SIZE = 9,
+    VARINT_MASK = 0x7f,
+    VARINT_MORE = 0x80
+} the_hal_logic_capture_constants;
+
+static const uint8_t MAGIC[4] = { 'T', 'H', 'L', 'C' };
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Output buffer that is handed to the writer each time it gets full */
+typedef struct
+{
+    uint8_t data[THE_HAL_LOGIC_CAPTURE_CHUNK_SIZE];
+    uint16_t size;
+    the_hal_logic_capture_writer writer;
+    void* arg;
+    bool ok;
+} the_hal_logic_capture_chunk;
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+static void chunk_flush(the_hal_logic_capture_chunk* chunk)
+{
+    if(chunk->ok && (chunk->size > 0))
+        chunk->ok = chunk->writer(chunk->arg, chunk->data, chunk->size);
+    chunk->size = 0;
+}
+
+static void chunk_put(the_hal_logic_capture_chunk* chunk, const uint8_t byte)
+{
+    if(chunk->size == THE_HAL_LOGIC_CAPTURE_CHUNK_SIZE)
+        chunk_flush(chunk);
+    chunk->data[chunk->size] = byte;
+    chunk->size = chunk->size + 1;
+}
+
+static void chunk_put_le(the_hal_logic_capture_chunk* chunk,
+        const uint32_t value, const uint8_t num_bytes)
+{
+    for(uint8_t i = 0; i < num_bytes; i++)
+        chunk_put(chunk, (uint8_t)(value >> (8 * i)));
+}
+
+static void chunk_put_text(the_hal_logic_capture_chunk* chunk,
+        const char* text)
+{
+    while(*text != '\0')
+    {
+        chunk_put(chunk, (uint8_t)(*text));
+        text++;
+    }
+}
+
+static void chunk_put_decimal(the_hal_logic_capture_chunk* chunk,
+        uint64_t value)
+{
+    char digits[21];
+    uint8_t num_digits = 0;
+
+    do
+    {
+        digits[num_digits] = (char)('0' + (value % 10));
+        value = value / 10;
+        num_digits = num_digits + 1;
+    } while(value != 0);
+
+    while(num_digits > 0)
+    {
+        num_digits = num_digits - 1;
+        chunk_put(chunk, (uint8_t)(digits[num_digits]));
+    }
+}
+
+static void vcd_put_header(the_hal_logic_capture_chunk* chunk,
+        const uint8_t num_pins)
+{
+    chunk_put_text(chunk, "$timescale 1 ns $end\n");
+    chunk_put_text(chunk, "$scope module thehal $end\n");
+    for(uint8_t pin = 0; pin < num_pins; pin++)
+    {
+        chunk_put_text(chunk, "$var wire 1 ");
+        chunk_put(chunk, (uint8_t)('!' + pin));
+        chunk_put_text(chunk, " bus");
+        chunk_put_decimal(chunk, pin);
+        chunk_put_text(chunk, " $end\n");
+    }
+    chunk_put_text(chunk, "$upscope $end\n$enddefinitions $end\n");
+}
+
+static void vcd_put_time(the_hal_logic_capture_chunk* chunk,
+        const uint64_t time_ns)
+{
+    chunk_put(chunk, '#');
+    chunk_put_decimal(chunk, time_ns);
+    chunk_put(chunk, '\n');
+}
+
+static void vcd_put_changes(the_hal_logic_capture_chunk* chunk,
+        const uint8_t num_pins, const uint32_t changes, const uint32_t values)
+{
+    for(uint8_t pin = 0; pin < num_pins; pin++)
+    {
+        if(!(changes & (1UL << pin)))
+            continue;
+        chunk_put(chunk, (values & (1UL << pin)) ? '1' : '0');
+        chunk_put(chunk, (uint8_t)('!' + pin));
+        chunk_put(chunk, '\n');
+    }
+}
+
+static uint32_t read_le(const uint8_t* data, const uint8_t num_bytes)
+{
+    uint32_t value = 0;
+
+    for(uint8_t i = 0; i < num_bytes; i++)
+        value = value | ((uint32_t)(data[i]) << (8 * i));
+
+    return value;
+}
+
+/*****************************************************************************/
+
+/* LogicCapture Constructor */
+
+/* LogicCapture constructor */
+LogicCapture::LogicCapture(DigitalInBus* bus, const uint8_t num_pins)
+{
+    this->bus = bus;
+    this->num_pins = (num_pins > MAX_PINS) ? (uint8_t)(MAX_PINS) : num_pins;
+    this->sample_period_ns = 0;
+    this->run_values = 0;
+    this->run_count = 0;
+    this->overruns = 0;
+    this->num_records[0] = 0;
+    this->num_records[1] = 0;
+    this->full[0] = false;
+    this->full[1] = false;
+    this->active = 0;
+    this->flush_buffer = 0;
+    this->running = false;
+    this->header_pending = false;
+}
+
+/* LogicCapture destructor */
+LogicCapture::~LogicCapture()
+{}
+
+/*****************************************************************************/
+
+/* LogicCapture Public Methods */
+
+/* Start a new capture (sample() must be called every sample period) */
+bool LogicCapture::start(const uint32_t sample_period_ns)
+{
+    if(this->running || (this->num_pins == 0) || (sample_period_ns == 0))
+        return false;
+
+    this->sample_period_ns = sample_period_ns;
+    this->run_count = 0;
+    this->overruns = 0;
+    this->num_records[0] = 0;
+    this->num_records[1] = 0;
+    this->full[0] = false;
+    this->full[1] = false;
+    this->active = 0;
+    this->flush_buffer = 0;
+    this->header_pending = true;
+    this->running = true;
+
+    return true;
+}
+
+/* Take a bus sample, a record is only stored when the bus value changes
+ * (to be called at a fixed rate, i.e. from a timer interrupt) */
+void LogicCapture::sample(void)
+{
+    uint32_t values;
+
+    if(!this->running)
+        return;
+
+    values = this->bus->read();
+    if((values == this->run_values) && (this->run_count != 0) &&
+            (this->run_count != UINT32_MAX))
+    {
+        this->run_count = this->run_count + 1;
+        return;
+    }
+
+    if(this->run_count != 0)
+        commit_run();
+    this->run_values = values;
+    this->run_count = 1;
+}
+
+/* Stop sampling and hand the last records to stream() (sample() must not
+ * be running anymore) */
+bool LogicCapture::stop(void)
+{
+    if(!this->running)
+        return false;
+
+    this->running = false;
+    if(this->run_count != 0)
+        commit_run();
+    this->run_count = 0;
+
+    if((this->num_records[this->active] != 0) && !this->full[this->active])
+    {
+#if defined(__AVR__)
+        this->full[this->active] = true;
+#else
+        __atomic_store_n(&this->full[this->active], true, __ATOMIC_RELEASE);
+#endif
+    }
+
+    return true;
+}
+
+/* Write the filled buffers through the writer (main loop or I/O thread),
+ * returns the number of records written or -1 if writer failed */
+int32_t LogicCapture::stream(the_hal_logic_capture_writer writer, void* arg)
+{
+    int32_t num_written = 0;
+    uint8_t buffer = this->flush_buffer;
+
+    if(writer == nullptr)
+        return -1;
+
+    if(this->header_pending)
+    {
+        if(!write_header(writer, arg))
+            return -1;
+        this->header_pending = false;
+    }
+
+#if defined(__AVR__)
+    while(this->full[buffer])
+#else
+    while(__atomic_load_n(&this->full[buffer], __ATOMIC_ACQUIRE))
+#endif
+    {
+        if(!write_records(buffer, writer, arg))
+            return -1;
+        num_written = num_written + this->num_records[buffer];
+
+        // Release the buffer to the sampler
+        this->num_records[buffer] = 0;
+#if defined(__AVR__)
+        this->full[buffer] = false;
+#else
+        __atomic_store_n(&this->full[buffer], false, __ATOMIC_RELEASE);
+#endif
+        buffer = buffer ^ 1;
+        this->flush_buffer = buffer;
+    }
+
+    return num_written;
+}
+
+/* Get number of bus changes lost because both buffers were full */
+uint32_t LogicCapture::get_overruns(void)
+{
+    return this->overruns;
+}
+
+/*****************************************************************************/
+
+/* LogicCapture Private Methods */
+
+/* Store current run in the active buffer, swapping buffers when full */
+void LogicCapture::commit_run(void)
+{
+    uint8_t buffer = this->active;
+    uint16_t num_records = this->num_records[buffer];
+    the_hal_logic_capture_record* record;
+
+    if(num_records == THE_HAL_LOGIC_CAPTURE_RECORDS)
+    {
+        // Streaming is late, the other buffer is not free yet
+#if defined(__AVR__)
+        if(this->full[buffer ^ 1])
+#else
+        if(__atomic_load_n(&this->full[buffer ^ 1], __ATOMIC_ACQUIRE))
+#endif
+        {
+            this->overruns = this->overruns + 1;
+            return;
+        }
+#if defined(__AVR__)
+        this->full[buffer] = true;
+#else
+        __atomic_store_n(&this->full[buffer], true, __ATOMIC_RELEASE);
+#endif
+        buffer = buffer ^ 1;
+        this->active = buffer;
+        num_records = 0;
+    }
+
+    record = &(this->records[buffer][num_records]);
+    record->values = this->run_values;
+    record->count = this->run_count;
+    this->num_records[buffer] = num_records + 1;
+}
+
+/* Write capture file header */
+bool LogicCapture::write_header(the_hal_logic_capture_writer writer,
+        void* arg)
+{
+    the_hal_logic_capture_chunk chunk;
+
+    chunk.size = 0;
+    chunk.writer = writer;
+    chunk.arg = arg;
+    chunk.ok = true;
+
+    for(uint8_t i = 0; i < sizeof(MAGIC); i++)
+        chunk_put(&chunk, MAGIC[i]);
+    chunk_put(&chunk, FORMAT_VERSION);
+    chunk_put(&chunk, this->num_pins);
+    chunk_put_le(&chunk, 0, 2);
+    chunk_put_le(&chunk, this->sample_period_ns, 4);
+    chunk_put_le(&chunk, 0, 4);
+    chunk_flush(&chunk);
+
+    return chunk.ok;
+}
+
+/* Encode the records of a buffer (bus value bytes + LEB128 run length) */
+bool LogicCapture::write_records(const uint8_t buffer,
+        the_hal_logic_capture_writer writer, void* arg)
+{
+    the_hal_logic_capture_chunk chunk;
+    the_hal_logic_capture_record* record;
+    uint8_t value_bytes = (this->num_pins + 7) / 8;
+    uint32_t count;
+
+    chunk.size = 0;
+    chunk.writer = writer;
+    chunk.arg = arg;
+    chunk.ok = true;
+
+    for(uint16_t i = 0; i < this->num_records[buffer]; i++)
+    {
+        record = &(this->records[buffer][i]);
+        chunk_put_le(&chunk, record->values, value_bytes);
+        count = record->count;
+        while(count > VARINT_MASK)
+        {
+            chunk_put(&chunk, (uint8_t)((count & VARINT_MASK) | VARINT_MORE));
+            count = count >> 7;
+        }
+        chunk_put(&chunk, (uint8_t)(count));
+    }
+    chunk_flush(&chunk);
+
+    return chunk.ok;
+}
+
+/*****************************************************************************/
+
+/* LogicCaptureReader Constructor */
+
+/* LogicCaptureReader constructor */
+LogicCaptureReader::LogicCaptureReader()
+{
+    this->data = nullptr;
+    this->size = 0;
+    this->position = 0;
+    this->sample_period_ns = 0;
+    this->num_pins = 0;
+}
+
+/* LogicCaptureReader destructor */
+LogicCaptureReader::~LogicCaptureReader()
+{}
+
+/*****************************************************************************/
+
+/* LogicCaptureReader Public Methods */
+
+/* Check capture header and prepare to read its records (data is not
+ * copied, so it must be kept while reading) */
+bool LogicCaptureReader::begin(const uint8_t* data, const size_t size)
+{
+    this->data = nullptr;
+    if((data == nullptr) || (size < THE_HAL_LOGIC_CAPTURE_HEADER_SIZE))
+        return false;
+
+    for(uint8_t i = 0; i < sizeof(MAGIC); i++)
+    {
+        if(data[i] != MAGIC[i])
+            return false;
+    }
+    if(data[4] != FORMAT_VERSION)
+        return false;
+    if((data[5] == 0) || (data[5] > MAX_PINS))
+        return false;
+
+    this->data = data;
+    this->size = size;
+    this->num_pins = data[5];
+    this->sample_period_ns = read_le(&data[8], 4);
+    this->position = THE_HAL_LOGIC_CAPTURE_HEADER_SIZE;
+
+    return true;
+}
+
+/* Decode next record, returns false at the end of the capture */
+bool LogicCaptureReader::next(uint32_t* values, uint32_t* count)
+{
+    uint8_t value_bytes = (this->num_pins + 7) / 8;
+    size_t position = this->position;
+    uint32_t run_count = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+
+    if(this->data == nullptr)
+        return false;
+    if((position + value_bytes) >= this->size)
+        return false;
+
+    *values = read_le(&this->data[position], value_bytes);
+    position = position + value_bytes;
+    do
+    {
+        if((position >= this->size) || (shift > 28))
+            return false;
+        byte = this->data[position];
+        run_count = run_count | ((uint32_t)(byte & VARINT_MASK) << shift);
+        shift = shift + 7;
+        position = position + 1;
+    } while(byte & VARINT_MORE);
+
+    if(run_count == 0)
+        return false;
+
+    *count = run_count;
+    this->position = position;
+
+    return true;
+}
+
+/* Go back to the first record */
+bool LogicCaptureReader::rewind(void)
+{
+    if(this->data == nullptr)
+        return false;
+
+    this->position = THE_HAL_LOGIC_CAPTURE_HEADER_SIZE;
+    return true;
+}
+
+/* Get number of captured bus pins */
+uint8_t LogicCaptureReader::get_num_pins(void)
+{
+    return this->num_pins;
+}
+
+/* Get capture sample period */
+uint32_t LogicCaptureReader::get_sample_period_ns(void)
+{
+    return this->sample_period_ns;
+}
+
+/* Export the whole capture as a Value Change Dump (sigrok vcd input) */
+bool LogicCaptureReader::export_vcd(the_hal_logic_capture_writer writer,
+        void* arg)
+{
+    the_hal_logic_capture_chunk chunk;
+    uint64_t sample = 0;
+    uint32_t last_values = 0;
+    uint32_t changes;
+    uint32_t values;
+    uint32_t count;
+
+    if((writer == nullptr) || !rewind())
+        return false;
+
+    chunk.size = 0;
+    chunk.writer = writer;
+    chunk.arg = arg;
+    chunk.ok = true;
+
+    vcd_put_header(&chunk, this->num_pins);
+
+    // First record dumps all pins, next ones only the pins that changed
+    while(next(&values, &count))
+    {
+        changes = (sample == 0) ? UINT32_MAX : (values ^ last_values);
+        vcd_put_time(&chunk, sample * this->sample_period_ns);
+        vcd_put_changes(&chunk, this->num_pins, changes, values);
+        last_values = values;
+        sample = sample + count;
+    }
+    vcd_put_time(&chunk, sample * this->sample_period_ns);
+    chunk_flush(&chunk);
+
+    return chunk.ok;
+}
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__) and !defined(LINUX_GPIO)
+
+/* Drive simulated GPIOs with next record and advance the virtual clock the
+ * time that it lasted (replays at full speed), the pins of each port are
+ * written at once so watchers see a single change */
+bool LogicCaptureReader::replay_next(const int8_t* io_pins)
+{
+    uint32_t masks[THE_HAL_HOST_SIM_NUM_PORTS] = { 0 };
+    uint32_t port_values[THE_HAL_HOST_SIM_NUM_PORTS] = { 0 };
+    uint32_t values;
+    uint32_t count;
+    uint8_t port;
+
+    if(!next(&values, &count))
+        return false;
+
+    for(uint8_t pin = 0; pin < this->num_pins; pin++)
+    {
+        if(HostSim::is_a_invalid_pin(io_pins[pin]))
+            continue;
+        port = HostSim::get_pin_port(io_pins[pin]);
+        masks[port] = masks[port] | HostSim::get_pin_mask(io_pins[pin]);
+        if(values & (1UL << pin))
+        {
+            port_values[port] = port_values[port] |
+                    HostSim::get_pin_mask(io_pins[pin]);
+        }
+    }
+    for(port = 0; port < THE_HAL_HOST_SIM_NUM_PORTS; port++)
+    {
+        if(masks[port] != 0)
+            HostSim::write_port(port, masks[port], port_values[port]);
+    }
+    HostSim::advance_time_ns((uint64_t)(count) * this->sample_period_ns);
+
+    return true;
+}
+
+#endif
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_LOGIC_CAPTURE == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,174 @@
+
+/**
+ * @file    logic_capture.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Logic Capture Controller (run-length encoded DigitalInBus sampling).
+ *
+ * sample() is called at a fixed rate (i.e. from a timer interrupt) and only
+ * stores a record when the bus value changes, in one of two preallocated
+ * buffers. While one buffer is being filled, stream() encodes the other one
+ * into a compact binary capture and hands it to a writer function (file,
+ * SD card, socket...), so sampling never waits for the storage.
+ *
+ * Capture format (little endian):
+ *   Header: "THLC", version (u8), number of pins (u8), reserved (u16),
+ *           sample period in ns (u32), reserved (u32).
+ *   Records: bus value ((number of pins + 7) / 8 bytes) followed by the
+ *            number of samples that it lasted (LEB128 varint).
+ *
+ * LogicCaptureReader decodes a capture from memory, exports it as a VCD
+ * file (that can be imported in sigrok/PulseView) and, on host, replays it
+ * into the simulated GPIOs against the virtual clock.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_LOGIC_CAPTURE == 1
+
+/* Include Guard */
+#ifndef THE_HAL_LOGIC_CAPTURE_H_
+#define THE_HAL_LOGIC_CAPTURE_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of run-length records of each one of the two capture buffers */
+#if defined(__AVR__)
+    #define THE_HAL_LOGIC_CAPTURE_RECORDS 32
+#else
+    #define THE_HAL_LOGIC_CAPTURE_RECORDS 512
+#endif
+
+/* Size of the chunks passed to the writer function */
+#define THE_HAL_LOGIC_CAPTURE_CHUNK_SIZE 64
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define THE_HAL_LOGIC_CAPTURE_HEADER_SIZE 16
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Capture data writer, it must return false if data can't be written */
+typedef bool (*the_hal_logic_capture_writer)(void* arg, const uint8_t* data,
+        const uint16_t size);
+
+typedef struct
+{
+    uint32_t values;
+    uint32_t count;
+} the_hal_logic_capture_record;
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Bus sampler with run-length encoding and double buffering */
+class LogicCapture
+{
+    public:
+        LogicCapture(DigitalInBus* bus, const uint8_t num_pins);
+        ~LogicCapture();
+
+        bool start(const uint32_t sample_period_ns);
+        void sample(void);
+        bool stop(void);
+
+        int32_t stream(the_hal_logic_capture_writer writer, void* arg);
+        uint32_t get_overruns(void);
+
+    private:
+        the_hal_logic_capture_record
+                records[2][THE_HAL_LOGIC_CAPTURE_RECORDS];
+        volatile uint16_t num_records[2];
+        volatile bool full[2];
+        DigitalInBus* bus;
+        uint32_t sample_period_ns;
+        uint32_t run_values;
+        uint32_t run_count;
+        volatile uint32_t overruns;
+        uint8_t num_pins;
+        uint8_t active;
+        uint8_t flush_buffer;
+        volatile bool running;
+        bool header_pending;
+
+        void commit_run(void);
+        bool write_header(the_hal_logic_capture_writer writer, void* arg);
+        bool write_records(const uint8_t buffer,
+                the_hal_logic_capture_writer writer, void* arg);
+};
+
+/* Capture decoder from memory (i.e. a memory-mapped capture file) */
+class LogicCaptureReader
+{
+    public:
+        LogicCaptureReader();
+        ~LogicCaptureReader();
+
+        bool begin(const uint8_t* data, const size_t size);
+        bool next(uint32_t* values, uint32_t* count);
+        bool rewind(void);
+
+        uint8_t get_num_pins(void);
+        uint32_t get_sample_period_ns(void);
+
+        bool export_vcd(the_hal_logic_capture_writer writer, void* arg);
+
+#if !defined(ARDUINO) and !defined(ESP_IDF) and !defined(SAM_ASF) and \
+    !defined(__AVR__) and !defined(LINUX_GPIO)
+        bool replay_next(const int8_t* io_pins);
+#endif
+
+    private:
+        const uint8_t* data;
+        size_t size;
+        size_t position;
+        uint32_t sample_period_ns;
+        uint8_t num_pins;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_LOGIC_CAPTURE_H_
+#endif // THE_HAL_COMPONENT_LOGIC_CAPTURE
@@ -0,0 +1,83 @@
+// Requires THE_HAL_COMPONENT_PIN_EVENT_BUS enabled in thehal.h
+// Samples 3 buttons once per millisecond (AVR Timer1) and delivers their
+// edges from the main loop: a constant table subscriber prints the presses
+// of all buttons and a run time subscriber mirrors button 0 on the LED
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_BUTTONS 3
+
+#define SAMPLE_HZ 1000
+
+/*****************************************************************************/
+
+void print_press(void* arg, const the_hal_pin_event* event);
+
+const int8_t BUTTON_PINS[NUM_BUTTONS] = { 4, 5, 6 };
+
+const the_hal_pin_subscriber SUBSCRIBERS[] =
+{
+    { print_press, nullptr, 0x07, THE_HAL_PIN_EVENT_FALLING }
+};
+
+DigitalOut MyLed(13);
+DigitalInBus Buttons(BUTTON_PINS, NUM_BUTTONS);
+PinEventBus MyEvents(&Buttons, SUBSCRIBERS, 1);
+
+/*****************************************************************************/
+
+void print_press(void* arg, const the_hal_pin_event* event)
+{
+    Serial.print("Button ");
+    Serial.print(event->pin);
+    Serial.print(" pressed at ms ");
+    Serial.println(event->tick);
+}
+
+void mirror_button(void* arg, const the_hal_pin_event* event)
+{
+    DigitalOut* led = (DigitalOut*)(arg);
+
+    // Buttons are active low
+    if(event->level)
+        led->set_low();
+    else
+        led->set_high();
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyEvents.sample();
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    MyLed.setup();
+    MyEvents.setup(THE_HAL_DIGITAL_IN_PULLUP);
+    MyEvents.subscribe(mirror_button, &MyLed, 0x01,
+            THE_HAL_PIN_EVENT_BOTH);
+
+    // Timer1 CTC mode, prescaler 8, 1 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / SAMPLE_HZ) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    static uint32_t reported_drops = 0;
+    uint32_t drops;
+
+    MyEvents.dispatch();
+
+    drops = MyEvents.get_dropped_events();
+    if(drops != reported_drops)
+    {
+        Serial.print("Dropped events: ");
+        Serial.println(drops);
+        reported_drops = drops;
+    }
+}
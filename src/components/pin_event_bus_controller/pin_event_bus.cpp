@@ -0,0 +1,410 @@
+
+/**
+ * @file    pin_event_bus.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Pin Events Bus Controller (edges of the GPIOs of a DigitalInBus sampled
+ * once and delivered to several subscribers, without heap use).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_PIN_EVENT_BUS == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "pin_event_bus.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    QUEUE_MASK = (THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE - 1),
+    MAX_BUS_PINS = 32
+} the_hal_pin_event_bus_constants;
+
+// Queue positions are free running bytes, the queue size must divide 256
+// and leave one bit to tell a full queue from an empty one
+static_assert(((THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE &
+        (THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE - 1)) == 0) &&
+        (THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE <= 128),
+        "Pin events queue size must be a power of 2 up to 128");
+
+/*****************************************************************************/
+
+/* Local Functions */
+
+/* Events are published from an interrupt (or another thread) and delivered
+ * from the main loop, so shared values are accessed at once. Queue
+ * positions are single bytes, the barriers keep the events slots accesses
+ * in order with them */
+
+#if defined(__AVR__)
+
+    /* Get a queue position written by the other side */
+    static inline uint8_t load_position(volatile uint8_t* position)
+    {
+        uint8_t value = *position;
+        __asm__ __volatile__("" ::: "memory");
+        return value;
+    }
+
+    /* Publish a queue position to the other side */
+    static inline void store_position(volatile uint8_t* position,
+            const uint8_t value)
+    {
+        __asm__ __volatile__("" ::: "memory");
+        *position = value;
+    }
+
+    /* Get a 32 bits value written by the other side */
+    static inline uint32_t load_value(volatile uint32_t* value)
+    {
+        uint32_t read_value;
+        uint8_t sreg = SREG;
+        cli();
+        read_value = *value;
+        SREG = sreg;
+        return read_value;
+    }
+
+    /* Set a 32 bits value read by the other side */
+    static inline void store_value(volatile uint32_t* value,
+            const uint32_t new_value)
+    {
+        uint8_t sreg = SREG;
+        cli();
+        *value = new_value;
+        SREG = sreg;
+    }
+
+#else
+
+    /* Get a queue position written by the other side */
+    static inline uint8_t load_position(volatile uint8_t* position)
+    { return __atomic_load_n(position, __ATOMIC_ACQUIRE); }
+
+    /* Publish a queue position to the other side */
+    static inline void store_position(volatile uint8_t* position,
+            const uint8_t value)
+    { __atomic_store_n(position, value, __ATOMIC_RELEASE); }
+
+    /* Get a 32 bits value written by the other side */
+    static inline uint32_t load_value(volatile uint32_t* value)
+    { return __atomic_load_n(value, __ATOMIC_RELAXED); }
+
+    /* Set a 32 bits value read by the other side */
+    static inline void store_value(volatile uint32_t* value,
+            const uint32_t new_value)
+    { __atomic_store_n(value, new_value, __ATOMIC_RELAXED); }
+
+#endif
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* PinEventBus constructor (table is a constant subscribers table, that
+ * must exist while the bus is used, or nullptr) */
+PinEventBus::PinEventBus(DigitalInBus* bus,
+        const the_hal_pin_subscriber* table, const uint8_t table_size)
+{
+    this->bus = bus;
+    this->table = table;
+    this->table_size = (table != nullptr) ? table_size : 0;
+    this->num_subscribers = 0;
+    this->enqueue_position = 0;
+    this->dequeue_position = 0;
+    this->levels = 0;
+    this->rising_pins = 0;
+    this->falling_pins = 0;
+    this->published_events = 0;
+    this->dropped_events = 0;
+    this->tick = 0;
+    this->initialized = false;
+    update_subscribed_pins();
+}
+
+/* PinEventBus destructor */
+PinEventBus::~PinEventBus()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize bus GPIOs and take their current levels as reference (a bus
+ * nullptr only gets events from publish()) */
+bool PinEventBus::setup(const uint8_t pull_resistor_mode)
+{
+    uint32_t sample = 0;
+
+    if(this->bus != nullptr)
+    {
+        if(!this->bus->setup(pull_resistor_mode))
+            return false;
+        sample = this->bus->read();
+    }
+
+    store_value(&this->levels, sample);
+    this->initialized = true;
+
+    return true;
+}
+
+/* Add a subscriber to the edges of a set of bus pins (pins mask) */
+bool PinEventBus::subscribe(the_hal_pin_event_callback callback, void* arg,
+        const uint32_t pins, const uint8_t edges)
+{
+    the_hal_pin_subscriber* subscriber;
+
+    if((callback == nullptr) || (pins == 0))
+        return false;
+    if((edges == 0) || (edges > THE_HAL_PIN_EVENT_BOTH))
+        return false;
+    if(this->num_subscribers >= THE_HAL_PIN_EVENT_BUS_MAX_SUBSCRIBERS)
+        return false;
+
+    subscriber = &(this->subscribers[this->num_subscribers]);
+    subscriber->callback = callback;
+    subscriber->arg = arg;
+    subscriber->pins = pins;
+    subscriber->edges = edges;
+    this->num_subscribers = this->num_subscribers + 1;
+    update_subscribed_pins();
+
+    return true;
+}
+
+/* Remove the run time subscriptions of a callback and argument */
+bool PinEventBus::unsubscribe(the_hal_pin_event_callback callback,
+        void* arg)
+{
+    uint8_t kept = 0;
+
+    for(uint8_t i = 0; i < this->num_subscribers; i++)
+    {
+        if((this->subscribers[i].callback == callback) &&
+           (this->subscribers[i].arg == arg))
+            continue;
+        this->subscribers[kept] = this->subscribers[i];
+        kept = kept + 1;
+    }
+
+    if(kept == this->num_subscribers)
+        return false;
+
+    this->num_subscribers = kept;
+    update_subscribed_pins();
+
+    return true;
+}
+
+/* Read the bus once and publish the subscribed edges since the previous
+ * sample (i.e. from a timer interrupt), returns the published events */
+uint8_t PinEventBus::sample(void)
+{
+    uint32_t sample;
+    uint32_t changed;
+    uint32_t wanted;
+    uint8_t num_events = 0;
+    uint8_t pin;
+
+    if(!this->initialized || (this->bus == nullptr))
+        return 0;
+
+    sample = this->bus->read();
+    changed = sample ^ this->levels;
+    store_value(&this->levels, sample);
+    this->tick = this->tick + 1;
+
+    // Only the edges that some subscriber wants take a queue slot
+    wanted = (changed & sample & this->rising_pins) |
+            (changed & ~sample & this->falling_pins);
+    while(wanted != 0)
+    {
+        pin = (uint8_t)(__builtin_ctzl(wanted));
+        if(push(pin, ((sample >> pin) & 1)))
+            num_events = num_events + 1;
+        wanted = wanted & (wanted - 1);
+    }
+
+    return num_events;
+}
+
+/* Publish the level of a bus pin from another source (i.e. a pin change
+ * interrupt handler), not to be called while sample() runs */
+bool PinEventBus::publish(const uint8_t pin, const bool level)
+{
+    uint32_t mask;
+    uint32_t wanted;
+
+    if(!this->initialized || (pin >= MAX_BUS_PINS))
+        return false;
+
+    mask = (1UL << pin);
+    if(level)
+        store_value(&this->levels, this->levels | mask);
+    else
+        store_value(&this->levels, this->levels & ~mask);
+
+    wanted = (level) ? this->rising_pins : this->falling_pins;
+    if((wanted & mask) == 0)
+        return false;
+
+    return push(pin, level);
+}
+
+/* Deliver the queued events to their subscribers (i.e. from the main loop,
+ * single thread), events published while dispatching wait for the next
+ * call, returns the delivered events */
+uint16_t PinEventBus::dispatch(void)
+{
+    uint8_t position = this->dequeue_position;
+    uint8_t last = load_position(&this->enqueue_position);
+    uint16_t num_events = 0;
+
+    while(position != last)
+    {
+        deliver(&(this->events[position & QUEUE_MASK]));
+        position = position + 1;
+        store_position(&this->dequeue_position, position);
+        num_events = num_events + 1;
+    }
+
+    return num_events;
+}
+
+/* Get the bus levels of the last sample (without reading the GPIOs) */
+uint32_t PinEventBus::read(void)
+{
+    return load_value(&this->levels);
+}
+
+/* Get number of events queued since start */
+uint32_t PinEventBus::get_published_events(void)
+{
+    return load_value(&this->published_events);
+}
+
+/* Get number of events dropped due to full queue */
+uint32_t PinEventBus::get_dropped_events(void)
+{
+    return load_value(&this->dropped_events);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Queue an event (single producer) */
+bool PinEventBus::push(const uint8_t pin, const bool level)
+{
+    uint8_t position = this->enqueue_position;
+    uint8_t used = (uint8_t)(position -
+            load_position(&this->dequeue_position));
+    the_hal_pin_event* event;
+
+    if(used >= THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE)
+    {
+        store_value(&this->dropped_events, this->dropped_events + 1);
+        return false;
+    }
+
+    event = &(this->events[position & QUEUE_MASK]);
+    event->tick = this->tick;
+    event->pin = pin;
+    event->level = level;
+    store_position(&this->enqueue_position, position + 1);
+    store_value(&this->published_events, this->published_events + 1);
+
+    return true;
+}
+
+/* Call the subscribers of an event pin and edge (constant table first) */
+void PinEventBus::deliver(const the_hal_pin_event* event)
+{
+    uint32_t mask = (1UL << event->pin);
+    uint8_t edge = (event->level) ? THE_HAL_PIN_EVENT_RISING :
+            THE_HAL_PIN_EVENT_FALLING;
+    const the_hal_pin_subscriber* subscriber;
+
+    for(uint8_t i = 0; i < this->table_size; i++)
+    {
+        subscriber = &(this->table[i]);
+        if((subscriber->pins & mask) && (subscriber->edges & edge) &&
+           (subscriber->callback != nullptr))
+            subscriber->callback(subscriber->arg, event);
+    }
+    for(uint8_t i = 0; i < this->num_subscribers; i++)
+    {
+        subscriber = &(this->subscribers[i]);
+        if((subscriber->pins & mask) && (subscriber->edges & edge))
+            subscriber->callback(subscriber->arg, event);
+    }
+}
+
+/* Merge the pins and edges of all the subscribers, so the producer only
+ * checks two masks */
+void PinEventBus::update_subscribed_pins(void)
+{
+    const the_hal_pin_subscriber* subscriber;
+    uint32_t rising = 0;
+    uint32_t falling = 0;
+    uint16_t num_total = this->table_size + this->num_subscribers;
+
+    for(uint16_t i = 0; i < num_total; i++)
+    {
+        if(i < this->table_size)
+            subscriber = &(this->table[i]);
+        else
+            subscriber = &(this->subscribers[i - this->table_size]);
+        if(subscriber->edges & THE_HAL_PIN_EVENT_RISING)
+            rising = rising | subscriber->pins;
+        if(subscriber->edges & THE_HAL_PIN_EVENT_FALLING)
+            falling = falling | subscriber->pins;
+    }
+
+    store_value(&this->rising_pins, rising);
+    store_value(&this->falling_pins, falling);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_PIN_EVENT_BUS == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,183 @@
+
+/**
+ * @file    pin_event_bus.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Pin Events Bus Controller (edges of the GPIOs of a DigitalInBus sampled
+ * once and delivered to several subscribers, without heap use).
+ *
+ * Each sample() reads the whole bus once (i.e. from a timer interrupt) and
+ * publishes an event for each pin edge that some subscriber wants into a
+ * fixed size queue. dispatch() delivers the queued events in a batch to
+ * the subscribers of each pin (i.e. from the main loop), so modules that
+ * react to the same pins do not read them on their own. read() gives the
+ * levels of the last sample without reading the pins again.
+ *
+ * Subscribers can be bound at compile time with a constant table, and/or
+ * at run time in a fixed capacity table (THE_HAL_PIN_EVENT_BUS_MAX_
+ * SUBSCRIBERS):
+ *
+ *   const the_hal_pin_subscriber SUBSCRIBERS[] =
+ *   {
+ *       { on_button, nullptr, (1UL << 0), THE_HAL_PIN_EVENT_FALLING },
+ *       { on_sensor, nullptr, (1UL << 1) | (1UL << 2),
+ *         THE_HAL_PIN_EVENT_BOTH }
+ *   };
+ *
+ *   PinEventBus Events(&Inputs, SUBSCRIBERS, 2);
+ *
+ * Events can also be published from a pin change interrupt handler with
+ * publish(), as long as only one context publishes (sample() and publish()
+ * must not preempt each other). Events that don't fit in the queue are
+ * dropped and counted.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_PIN_EVENT_BUS == 1
+
+/* Include Guard */
+#ifndef THE_HAL_PIN_EVENT_BUS_H_
+#define THE_HAL_PIN_EVENT_BUS_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of events slots of the queue (power of 2, up to 128) */
+#if defined(__AVR__)
+    #define THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE 16
+#else
+    #define THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE 64
+#endif
+
+/* Number of subscribers that can be added at run time */
+#if defined(__AVR__)
+    #define THE_HAL_PIN_EVENT_BUS_MAX_SUBSCRIBERS 4
+#else
+    #define THE_HAL_PIN_EVENT_BUS_MAX_SUBSCRIBERS 16
+#endif
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Edges of a subscription */
+typedef enum
+{
+    THE_HAL_PIN_EVENT_RISING = 0x01,
+    THE_HAL_PIN_EVENT_FALLING = 0x02,
+    THE_HAL_PIN_EVENT_BOTH = 0x03
+} the_hal_pin_event_edges;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/* Pin edge event (pin is the bus pin index, tick the sample number) */
+typedef struct
+{
+    uint32_t tick;
+    uint8_t pin;
+    bool level;
+} the_hal_pin_event;
+
+/* Subscriber callback (the event is only valid during the call) */
+typedef void (*the_hal_pin_event_callback)(void* arg,
+        const the_hal_pin_event* event);
+
+/* Subscriber of the edges of a set of bus pins (pins mask) */
+typedef struct
+{
+    the_hal_pin_event_callback callback;
+    void* arg;
+    uint32_t pins;
+    uint8_t edges;
+} the_hal_pin_subscriber;
+
+/*****************************************************************************/
+
+/* Class */
+
+class PinEventBus
+{
+    public:
+        PinEventBus(DigitalInBus* bus,
+                const the_hal_pin_subscriber* table = nullptr,
+                const uint8_t table_size = 0);
+        ~PinEventBus();
+
+        bool setup(const uint8_t pull_resistor_mode);
+        bool subscribe(the_hal_pin_event_callback callback, void* arg,
+                const uint32_t pins, const uint8_t edges);
+        bool unsubscribe(the_hal_pin_event_callback callback, void* arg);
+
+        uint8_t sample(void);
+        bool publish(const uint8_t pin, const bool level);
+        uint16_t dispatch(void);
+
+        uint32_t read(void);
+        uint32_t get_published_events(void);
+        uint32_t get_dropped_events(void);
+
+    private:
+        DigitalInBus* bus;
+        const the_hal_pin_subscriber* table;
+        uint8_t table_size;
+        the_hal_pin_subscriber subscribers[
+                THE_HAL_PIN_EVENT_BUS_MAX_SUBSCRIBERS];
+        uint8_t num_subscribers;
+        the_hal_pin_event events[THE_HAL_PIN_EVENT_BUS_QUEUE_SIZE];
+        volatile uint8_t enqueue_position;
+        volatile uint8_t dequeue_position;
+        volatile uint32_t levels;
+        volatile uint32_t rising_pins;
+        volatile uint32_t falling_pins;
+        volatile uint32_t published_events;
+        volatile uint32_t dropped_events;
+        uint32_t tick;
+        bool initialized;
+
+        bool push(const uint8_t pin, const bool level);
+        void deliver(const the_hal_pin_event* event);
+        void update_subscribed_pins(void);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_PIN_EVENT_BUS_H_
+#endif // THE_HAL_COMPONENT_PIN_EVENT_BUS
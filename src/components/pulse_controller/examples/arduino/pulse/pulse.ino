@@ -0,0 +1,69 @@
+// Requires THE_HAL_COMPONENT_PULSE enabled in thehal.h
+// Generates a 10 us strobe and a 20 us latch pulse every 10 ms, and a 500 ms
+// long pulse every 2 s driven by 1 kHz ticks (AVR Timer1)
+// The busy-wait pulses need THE_HAL_PULSE_EDGE_CYCLES defined in pulse.h
+// with the toggle() cost printed at startup (it depends on the core)
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define PIN_STROBE 8
+#define PIN_LATCH 9
+#define PIN_RELAY 10
+
+#define TICK_HZ 1000
+
+/*****************************************************************************/
+
+DigitalOut StrobePin(PIN_STROBE);
+DigitalOut LatchPin(PIN_LATCH);
+DigitalOut RelayPin(PIN_RELAY);
+
+PrecisePulse Strobe(&StrobePin);
+PrecisePulse Latch(&LatchPin);
+PrecisePulse Relay(&RelayPin);
+
+/*****************************************************************************/
+
+ISR(TIMER1_COMPA_vect)
+{
+    Relay.tick();
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    Strobe.setup(0);
+    Latch.setup(1);
+    Relay.setup(0);
+
+    // Measured with Timer1, before it is started for the ticks
+    Serial.print("THE_HAL_PULSE_EDGE_CYCLES ");
+    Serial.println(Strobe.measure_edge_cycles());
+
+    // Timer1 CTC mode, prescaler 8, 1 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / TICK_HZ) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    static uint8_t count = 0;
+
+    // Duration is a compile time constant, so the wait is an exact number
+    // of cycles
+#if THE_HAL_PULSE_EDGE_CYCLES >= 0
+    Strobe.pulse_ns<10000>();
+    Latch.pulse_ns<20000>();
+#endif
+
+    count = count + 1;
+    if(count == 200)
+    {
+        Relay.start(500);
+        count = 0;
+    }
+    delay(10);
+}
@@ -0,0 +1,210 @@
+
+/**
+ * @file    pulse.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Precise Pulse Controller (cycle calibrated busy-wait delays and output
+ * pulses with the duration known at compile time, and timer driven long
+ * pulses).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_PULSE == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "pulse.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    MAX_LEVEL = 1
+} the_hal_pulse_constants;
+
+/*****************************************************************************/
+
+/* PrecisePulse Constructor */
+
+/* PrecisePulse constructor */
+PrecisePulse::PrecisePulse(DigitalOut* pin)
+{
+    this->pin = pin;
+    this->remaining_ticks = 0;
+    this->initialized = false;
+}
+
+/* PrecisePulse destructor */
+PrecisePulse::~PrecisePulse()
+{}
+
+/*****************************************************************************/
+
+/* PrecisePulse Public Methods */
+
+/* Initialize the output at its idle level (pulses go to the other one) */
+bool PrecisePulse::setup(const uint8_t idle_level)
+{
+    if((this->pin == nullptr) || (idle_level > MAX_LEVEL))
+        return false;
+
+    this->remaining_ticks = 0;
+    this->initialized = this->pin->setup(idle_level);
+    return this->initialized;
+}
+
+/* Measure the cycles spent by a toggle() of the pin (the pin returns to
+ * its level, -1 if it can not be measured). On AVR it uses Timer1 at the
+ * CPU clock, so it must be called before Timer1 is started */
+int32_t PrecisePulse::measure_edge_cycles(void)
+{
+    if(!this->initialized || is_active())
+        return -1;
+
+#if defined(__AVR__) && defined(TCNT1)
+    uint8_t sreg = SREG;
+    uint8_t tccr1a = TCCR1A;
+    uint8_t tccr1b = TCCR1B;
+    uint16_t overhead;
+    uint16_t start;
+    uint16_t end;
+
+    cli();
+    TCCR1A = 0;
+    TCCR1B = (1 << CS10);
+    start = TCNT1;
+    end = TCNT1;
+    overhead = end - start;
+    start = TCNT1;
+    this->pin->toggle();
+    end = TCNT1;
+    this->pin->toggle();
+    TCCR1B = tccr1b;
+    TCCR1A = tccr1a;
+    SREG = sreg;
+
+    return (int32_t)((uint16_t)(end - start - overhead));
+#elif defined(THE_HAL_PULSE_COUNTER)
+    uint32_t overhead;
+    uint32_t start;
+    uint32_t end;
+
+    start = PreciseDelay::get_cycles();
+    end = PreciseDelay::get_cycles();
+    overhead = end - start;
+    start = PreciseDelay::get_cycles();
+    this->pin->toggle();
+    end = PreciseDelay::get_cycles();
+    this->pin->toggle();
+    if((end - start) < overhead)
+        return 0;
+
+    return (int32_t)(end - start - overhead);
+#else
+    return -1;
+#endif
+}
+
+/* Start a long pulse of a number of timer ticks (ended by tick()) */
+bool PrecisePulse::start(const uint32_t ticks)
+{
+    if(!this->initialized || (ticks == 0) || is_active())
+        return false;
+
+    // The edge and the counter are set together, so a tick in between
+    // does not see a pulse without its ticks
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    this->pin->toggle();
+    this->remaining_ticks = ticks;
+    SREG = sreg;
+#else
+    this->pin->toggle();
+    __atomic_store_n(&this->remaining_ticks, ticks, __ATOMIC_RELEASE);
+#endif
+
+    return true;
+}
+
+/* Count a tick of the current long pulse and end it after its last tick
+ * (to be called from a fixed rate timer interrupt) */
+void PrecisePulse::tick(void)
+{
+    uint32_t remaining;
+
+#if defined(__AVR__)
+    remaining = this->remaining_ticks;
+#else
+    remaining = __atomic_load_n(&this->remaining_ticks, __ATOMIC_ACQUIRE);
+#endif
+    if(remaining == 0)
+        return;
+
+    remaining = remaining - 1;
+    if(remaining == 0)
+        this->pin->toggle();
+#if defined(__AVR__)
+    this->remaining_ticks = remaining;
+#else
+    __atomic_store_n(&this->remaining_ticks, remaining, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Check if a long pulse is in progress */
+bool PrecisePulse::is_active(void)
+{
+    uint32_t remaining;
+
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    remaining = this->remaining_ticks;
+    SREG = sreg;
+#else
+    remaining = __atomic_load_n(&this->remaining_ticks, __ATOMIC_ACQUIRE);
+#endif
+
+    return (remaining != 0);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_PULSE == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,330 @@
+
+/**
+ * @file    pulse.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Precise Pulse Controller (cycle calibrated busy-wait delays and output
+ * pulses with the duration known at compile time, and timer driven long
+ * pulses).
+ *
+ * The pulse duration is a template argument, so its cycle budget is
+ * computed at compile time from THE_HAL_PULSE_CPU_HZ:
+ *
+ *   - Targets with a cycle counter (ESP32, Cortex-M DWT, Linux clock and
+ *     the HostSim virtual clock) count the budget from before the first
+ *     toggle(), so the cost of both toggle() calls cancels out.
+ *   - AVR subtracts the cost of the pin write of the ending edge
+ *     (THE_HAL_PULSE_EDGE_CYCLES) and the rest is an exact
+ *     __builtin_avr_delay_cycles(), with interrupts disabled.
+ *
+ *   PrecisePulse Strobe(&StrobePin);
+ *
+ *   Strobe.setup(0);
+ *   Strobe.pulse_ns<250>();
+ *   Strobe.pulse_cycles<8>();
+ *
+ * A pulse shorter than the pin write cost, or longer than
+ * THE_HAL_PULSE_MAX_BUSY_CYCLES, does not compile. Long pulses are started
+ * with start() and ended by tick() from a fixed rate timer interrupt, so
+ * the CPU is not blocked.
+ *
+ * The default THE_HAL_PULSE_EDGE_CYCLES are for the bare metal AVR
+ * backend. The toggle() cost of the Arduino cores depends on the core and
+ * the pin, so it must be defined with the value of measure_edge_cycles()
+ * (a Timer1 measure) before using busy-wait pulses there. Host builds count
+ * virtual cycles of 1 ns (THE_HAL_PULSE_CPU_HZ of 1 GHz), and the
+ * busy-waits advance the HostSim clock instead of waiting, so pulse
+ * timings can be checked against the simulated time.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_PULSE == 1
+
+/* Include Guard */
+#ifndef THE_HAL_PULSE_H_
+#define THE_HAL_PULSE_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* CPU frequency (cycles per second) known at compile time (it can be
+ * given by the build, i.e. -DTHE_HAL_PULSE_CPU_HZ=48000000UL) */
+#if defined(THE_HAL_PULSE_CPU_HZ)
+    // Given by the build
+#elif defined(F_CPU)
+    #define THE_HAL_PULSE_CPU_HZ F_CPU
+#elif defined(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ)
+    #define THE_HAL_PULSE_CPU_HZ (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000UL)
+#elif defined(LINUX_GPIO) || (!defined(ARDUINO) && !defined(SAM_ASF) && \
+      !defined(__AVR__) && !defined(ESP_IDF) && !defined(ESP_PLATFORM) && \
+      !defined(__ARM_ARCH_7M__) && !defined(__ARM_ARCH_7EM__) && \
+      !defined(__ARM_ARCH_8M_MAIN__))
+    // Host builds (Linux and HostSim): virtual cycles of 1 ns
+    #define THE_HAL_PULSE_CPU_HZ 1000000000UL
+#else
+    #error "TheHal Pulse: unknown CPU frequency, define THE_HAL_PULSE_CPU_HZ"
+#endif
+
+/* Cycles from the starting edge store to the ending edge store that are
+ * spent by the DigitalOut::toggle() calls themselves (-1 if unknown, then
+ * busy-wait pulses need it defined with the measure_edge_cycles() value) */
+#if defined(THE_HAL_PULSE_EDGE_CYCLES)
+    // Given by the build
+#elif defined(__AVR__) && !defined(ARDUINO) && (THE_HAL_HEADER_ONLY == 1)
+    #define THE_HAL_PULSE_EDGE_CYCLES 16
+#elif defined(__AVR__) && !defined(ARDUINO)
+    #define THE_HAL_PULSE_EDGE_CYCLES 32
+#elif defined(__AVR__)
+    #define THE_HAL_PULSE_EDGE_CYCLES -1
+#endif
+
+/* Longest busy-wait pulse (1 ms), longer ones must use start()/tick() */
+#define THE_HAL_PULSE_MAX_BUSY_CYCLES (THE_HAL_PULSE_CPU_HZ / 1000UL)
+
+/* Cycles of each iteration of the generic busy-wait loop (targets without
+ * cycle counter) */
+#define THE_HAL_PULSE_LOOP_CYCLES 4
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    #define THE_HAL_PULSE_COUNTER
+    #include "esp_cpu.h"
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+      defined(__ARM_ARCH_8M_MAIN__)
+    #define THE_HAL_PULSE_COUNTER
+    #define THE_HAL_PULSE_DWT
+#elif defined(LINUX_GPIO)
+    #define THE_HAL_PULSE_COUNTER
+    #include <time.h>
+#elif !defined(ARDUINO) && !defined(SAM_ASF)
+    #define THE_HAL_PULSE_COUNTER
+    #define THE_HAL_PULSE_HOST_SIM
+    #include "../host_sim_controller/host_sim.h"
+#endif
+
+/* Cycle counter targets do not subtract the edge cost (it cancels out),
+ * other targets have an unknown edge cost unless it is given */
+#if defined(THE_HAL_PULSE_COUNTER) && !defined(THE_HAL_PULSE_EDGE_CYCLES)
+    #define THE_HAL_PULSE_EDGE_CYCLES 0
+#elif !defined(THE_HAL_PULSE_EDGE_CYCLES)
+    #define THE_HAL_PULSE_EDGE_CYCLES -1
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* Cortex-M DWT cycle counter (started by the application or by
+ * CycleCounter::setup() of the latency component) */
+#if defined(THE_HAL_PULSE_DWT)
+    #define THE_HAL_PULSE_DWT_CYCCNT (*(volatile uint32_t*)0xE0001004UL)
+#endif
+
+/*****************************************************************************/
+
+/* Cycle Budget */
+
+/* Get the cycles of a duration in nanoseconds (rounded) */
+constexpr uint32_t the_hal_pulse_ns_to_cycles(const uint32_t ns)
+{
+    return (uint32_t)((((uint64_t)ns * THE_HAL_PULSE_CPU_HZ) +
+            500000000ULL) / 1000000000ULL);
+}
+
+/* Get the nanoseconds of a number of cycles (rounded) */
+constexpr uint32_t the_hal_pulse_cycles_to_ns(const uint32_t cycles)
+{
+    return (uint32_t)((((uint64_t)cycles * 1000000000ULL) +
+            (THE_HAL_PULSE_CPU_HZ / 2)) / THE_HAL_PULSE_CPU_HZ);
+}
+
+/* Get the busy-wait cycles of a pulse (total cycles without edge cost) */
+constexpr uint32_t the_hal_pulse_busy_cycles(const uint32_t cycles)
+{
+    return ((THE_HAL_PULSE_EDGE_CYCLES >= 0) &&
+            (cycles > (uint32_t)(THE_HAL_PULSE_EDGE_CYCLES))) ?
+            (cycles - (uint32_t)(THE_HAL_PULSE_EDGE_CYCLES)) : 0;
+}
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Busy-wait delays with the duration known at compile time */
+class PreciseDelay
+{
+    public:
+        /* Wait an exact number of CPU cycles */
+        template <uint32_t CYCLES>
+        __attribute__((always_inline))
+        static inline void delay_cycles(void)
+        {
+            static_assert(CYCLES <= THE_HAL_PULSE_MAX_BUSY_CYCLES,
+                    "Busy-wait too long, use a timer");
+
+            if(CYCLES == 0)
+                return;
+#if defined(__AVR__)
+            __builtin_avr_delay_cycles(CYCLES);
+#elif defined(THE_HAL_PULSE_COUNTER)
+            wait_since(get_cycles(), CYCLES);
+#else
+            for(uint32_t i = 0; i < (CYCLES / THE_HAL_PULSE_LOOP_CYCLES);
+                    i++)
+                __asm__ __volatile__("");
+#endif
+        }
+
+        /* Wait an exact number of nanoseconds (rounded to CPU cycles) */
+        template <uint32_t NS>
+        __attribute__((always_inline))
+        static inline void delay_ns(void)
+        { delay_cycles<the_hal_pulse_ns_to_cycles(NS)>(); }
+
+#if defined(THE_HAL_PULSE_COUNTER)
+        /* Get the cycle counter (it wraps around) */
+        __attribute__((always_inline))
+        static inline uint32_t get_cycles(void)
+        {
+#if defined(ESP_IDF) || defined(ESP_PLATFORM)
+            return (uint32_t)esp_cpu_get_cycle_count();
+#elif defined(THE_HAL_PULSE_DWT)
+            return THE_HAL_PULSE_DWT_CYCCNT;
+#elif defined(LINUX_GPIO)
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return (uint32_t)(((uint64_t)now.tv_sec * 1000000000ULL) +
+                    (uint64_t)now.tv_nsec);
+#else
+            return (uint32_t)HostSim::get_time_ns();
+#endif
+        }
+
+        /* Wait until a number of cycles have passed since a cycle counter
+         * value (spinning, sleeping would be rescheduled much later) */
+        __attribute__((always_inline))
+        static inline void wait_since(const uint32_t start,
+                const uint32_t cycles)
+        {
+#if defined(THE_HAL_PULSE_HOST_SIM)
+            uint32_t elapsed = get_cycles() - start;
+            if(elapsed < cycles)
+                HostSim::advance_time_ns(cycles - elapsed);
+#else
+            while((get_cycles() - start) < cycles)
+            {}
+#endif
+        }
+#endif
+};
+
+/* Output pulses of a DigitalOut */
+class PrecisePulse
+{
+    public:
+        PrecisePulse(DigitalOut* pin);
+        ~PrecisePulse();
+
+        bool setup(const uint8_t idle_level);
+        int32_t measure_edge_cycles(void);
+        bool start(const uint32_t ticks);
+        void tick(void);
+        bool is_active(void);
+
+        /* Generate a pulse of an exact number of CPU cycles (edge to
+         * edge) */
+        template <uint32_t CYCLES>
+        __attribute__((always_inline))
+        inline bool pulse_cycles(void)
+        {
+            static_assert(THE_HAL_PULSE_EDGE_CYCLES >= 0,
+                    "Pin write cost unknown, define "
+                    "THE_HAL_PULSE_EDGE_CYCLES (see measure_edge_cycles())");
+            static_assert((THE_HAL_PULSE_EDGE_CYCLES < 0) ||
+                    (CYCLES >= (uint32_t)(THE_HAL_PULSE_EDGE_CYCLES)),
+                    "Pulse shorter than the pin write cost");
+            static_assert(the_hal_pulse_busy_cycles(CYCLES) <=
+                    THE_HAL_PULSE_MAX_BUSY_CYCLES,
+                    "Pulse too long, use start() and tick()");
+
+            if(!this->initialized || is_active())
+                return false;
+
+#if defined(THE_HAL_PULSE_COUNTER)
+            // Counted from before the first call, so the cost of the first
+            // toggle() is in the budget as the one of the second one
+            uint32_t start = PreciseDelay::get_cycles();
+            this->pin->toggle();
+            PreciseDelay::wait_since(start, CYCLES);
+            this->pin->toggle();
+#else
+#if defined(__AVR__)
+            uint8_t sreg = SREG;
+            cli();
+#endif
+            this->pin->toggle();
+            PreciseDelay::delay_cycles<the_hal_pulse_busy_cycles(CYCLES)>();
+            this->pin->toggle();
+#if defined(__AVR__)
+            SREG = sreg;
+#endif
+#endif
+
+            return true;
+        }
+
+        /* Generate a pulse of an exact number of nanoseconds (rounded to
+         * CPU cycles) */
+        template <uint32_t NS>
+        __attribute__((always_inline))
+        inline bool pulse_ns(void)
+        { return pulse_cycles<the_hal_pulse_ns_to_cycles(NS)>(); }
+
+    private:
+        DigitalOut* pin;
+        volatile uint32_t remaining_ticks;
+        bool initialized;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_PULSE_H_
+#endif // THE_HAL_COMPONENT_PULSE
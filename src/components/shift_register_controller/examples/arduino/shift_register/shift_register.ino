@@ -0,0 +1,36 @@
+// Requires THE_HAL_COMPONENT_SHIFT_REGISTER enabled in thehal.h
+// Runs a light across 16 LEDs of two chained 74HC595
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_CHIPS 2
+#define NUM_LEDS (NUM_CHIPS * 8)
+
+/*****************************************************************************/
+
+DigitalOut Data(11);
+DigitalOut Clock(13);
+DigitalOut Latch(10);
+
+ShiftRegister<NUM_CHIPS> Chain(&Data, &Clock, &Latch);
+
+uint8_t led = 0;
+
+/*****************************************************************************/
+
+void setup()
+{
+    Chain.setup(0);
+}
+
+void loop()
+{
+    ShiftRegisterOut(&Chain, led).set_low();
+    led = (led + 1) % NUM_LEDS;
+    ShiftRegisterOut(&Chain, led).set_high();
+
+    // Both changes are shifted together
+    Chain.update();
+    delay(100);
+}
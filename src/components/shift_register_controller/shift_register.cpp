@@ -0,0 +1,227 @@
+
+/**
+ * @file    shift_register.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Shift Register Outputs Controller (daisy-chained 74HC595 driven by data,
+ * clock and latch DigitalOut pins).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_SHIFT_REGISTER == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "shift_register.h"
+
+/*****************************************************************************/
+
+/* ShiftRegisterImage Constructor */
+
+/* ShiftRegisterImage constructor */
+ShiftRegisterImage::ShiftRegisterImage(uint8_t* image,
+        const uint8_t num_chips)
+{
+    this->image = image;
+    this->num_chips = num_chips;
+    this->dirty = false;
+}
+
+/* ShiftRegisterImage destructor */
+ShiftRegisterImage::~ShiftRegisterImage()
+{}
+
+/*****************************************************************************/
+
+/* ShiftRegisterImage Public Methods */
+
+/* Set the value of an output in the image */
+bool ShiftRegisterImage::write_output(const uint8_t output, const bool value)
+{
+    uint8_t chip = output >> 3;
+    uint8_t mask = (uint8_t)(1 << (output & 0x07));
+    uint8_t byte;
+
+    if(chip >= this->num_chips)
+        return false;
+
+    byte = value ? (this->image[chip] | mask) : (this->image[chip] & ~mask);
+    if(byte != this->image[chip])
+    {
+        this->image[chip] = byte;
+        this->dirty = true;
+    }
+
+    return true;
+}
+
+/* Get the value of an output in the image */
+bool ShiftRegisterImage::read_output(const uint8_t output)
+{
+    uint8_t chip = output >> 3;
+
+    if(chip >= this->num_chips)
+        return false;
+
+    return ((this->image[chip] >> (output & 0x07)) & 1);
+}
+
+/* Set all the outputs of a chip in the image (bit N is Qn) */
+bool ShiftRegisterImage::write_chip(const uint8_t chip, const uint8_t value)
+{
+    if(chip >= this->num_chips)
+        return false;
+
+    if(value != this->image[chip])
+    {
+        this->image[chip] = value;
+        this->dirty = true;
+    }
+
+    return true;
+}
+
+/* Get all the outputs of a chip in the image (bit N is Qn) */
+uint8_t ShiftRegisterImage::read_chip(const uint8_t chip)
+{
+    if(chip >= this->num_chips)
+        return 0;
+
+    return this->image[chip];
+}
+
+/* Check if the image has changed since last update */
+bool ShiftRegisterImage::is_dirty(void)
+{
+    return this->dirty;
+}
+
+/*****************************************************************************/
+
+/* ShiftRegisterPins Constructor */
+
+/* ShiftRegisterPins constructor */
+ShiftRegisterPins::ShiftRegisterPins(DigitalOut* data, DigitalOut* clock,
+        DigitalOut* latch)
+{
+    this->data = data;
+    this->clock = clock;
+    this->latch = latch;
+    this->data_level = false;
+}
+
+/* ShiftRegisterPins destructor */
+ShiftRegisterPins::~ShiftRegisterPins()
+{}
+
+/*****************************************************************************/
+
+/* ShiftRegisterPins Public Methods */
+
+/* Initialize data, clock and latch pins as low outputs */
+bool ShiftRegisterPins::setup(void)
+{
+    if((this->data == nullptr) || (this->clock == nullptr) ||
+       (this->latch == nullptr))
+        return false;
+
+    if(!this->data->setup(0))
+        return false;
+    if(!this->clock->setup(0))
+        return false;
+    if(!this->latch->setup(0))
+        return false;
+    this->data_level = false;
+
+    return true;
+}
+
+/* Copy shifted bits to the outputs (latch rising edge) */
+void ShiftRegisterPins::latch_outputs(void)
+{
+    this->latch->set_high();
+    this->latch->set_low();
+}
+
+/*****************************************************************************/
+
+/* ShiftRegisterOut Constructor */
+
+/* ShiftRegisterOut constructor */
+ShiftRegisterOut::ShiftRegisterOut(ShiftRegisterImage* chain,
+        const uint8_t output)
+{
+    this->chain = chain;
+    this->output = output;
+}
+
+/* ShiftRegisterOut destructor */
+ShiftRegisterOut::~ShiftRegisterOut()
+{}
+
+/*****************************************************************************/
+
+/* ShiftRegisterOut Public Methods */
+
+/* Set the initial value of the chained output */
+bool ShiftRegisterOut::setup(const uint8_t initial_value)
+{
+    if(this->chain == nullptr)
+        return false;
+
+    return this->chain->write_output(this->output, (initial_value != 0));
+}
+
+/* Set chained output value to logical low */
+bool ShiftRegisterOut::set_low(void)
+{ return this->chain->write_output(this->output, false); }
+
+/* Set chained output value to logical high */
+bool ShiftRegisterOut::set_high(void)
+{ return this->chain->write_output(this->output, true); }
+
+/* Invert chained output value */
+bool ShiftRegisterOut::toggle(void)
+{
+    return this->chain->write_output(this->output,
+            !this->chain->read_output(this->output));
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_SHIFT_REGISTER == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,240 @@
+
+/**
+ * @file    shift_register.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Shift Register Outputs Controller (daisy-chained 74HC595 driven by data,
+ * clock and latch DigitalOut pins).
+ *
+ * All the chained outputs are kept in a shadow image, writes only modify
+ * the image and update() shifts it out (and latches it) just when it has
+ * changed. The chain length is a template parameter, so the loops over
+ * chips and bits are unrolled at compile time, and the data pin is only
+ * written when the next bit differs from the last one.
+ *
+ * Each output can be used as a ShiftRegisterOut, a virtual pin with the
+ * same interface than DigitalOut:
+ *
+ *   ShiftRegister<2> Chain(&Data, &Clock, &Latch);
+ *   ShiftRegisterOut Led(&Chain, 9);
+ *
+ *   Chain.setup(0);
+ *   Led.set_high();
+ *   Chain.update();
+ *
+ * Output N is bit N % 8 (Qx) of the Nth / 8 chip of the chain, the chip 0
+ * being the one connected to the data pin.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_SHIFT_REGISTER == 1
+
+/* Include Guard */
+#ifndef THE_HAL_SHIFT_REGISTER_H_
+#define THE_HAL_SHIFT_REGISTER_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Shadow image of the chained outputs (shared by the virtual pins) */
+class ShiftRegisterImage
+{
+    public:
+        ShiftRegisterImage(uint8_t* image, const uint8_t num_chips);
+        ~ShiftRegisterImage();
+
+        bool write_output(const uint8_t output, const bool value);
+        bool read_output(const uint8_t output);
+        bool write_chip(const uint8_t chip, const uint8_t value);
+        uint8_t read_chip(const uint8_t chip);
+        bool is_dirty(void);
+
+    protected:
+        uint8_t* image;
+        uint8_t num_chips;
+        bool dirty;
+};
+
+/* Data, clock and latch pins of the chain */
+class ShiftRegisterPins
+{
+    public:
+        ShiftRegisterPins(DigitalOut* data, DigitalOut* clock,
+                DigitalOut* latch);
+        ~ShiftRegisterPins();
+
+        bool setup(void);
+        void latch_outputs(void);
+
+        /* Shift a bit (data pin is only written if the level changes) */
+        __attribute__((always_inline))
+        inline void shift_bit(const bool value)
+        {
+            if(value != this->data_level)
+            {
+                if(value)
+                    this->data->set_high();
+                else
+                    this->data->set_low();
+                this->data_level = value;
+            }
+            this->clock->set_high();
+            this->clock->set_low();
+        }
+
+    private:
+        DigitalOut* data;
+        DigitalOut* clock;
+        DigitalOut* latch;
+        bool data_level;
+};
+
+/* Compile time unrolled shift of a chip byte (MSB first, so it ends in Q7) */
+template <uint8_t BIT>
+struct ShiftRegisterBits
+{
+    __attribute__((always_inline))
+    static inline void shift(ShiftRegisterPins* pins, const uint8_t value)
+    {
+        pins->shift_bit((value & (1 << BIT)) != 0);
+        ShiftRegisterBits<BIT - 1>::shift(pins, value);
+    }
+};
+
+template <>
+struct ShiftRegisterBits<0>
+{
+    __attribute__((always_inline))
+    static inline void shift(ShiftRegisterPins* pins, const uint8_t value)
+    { pins->shift_bit((value & 1) != 0); }
+};
+
+/* Compile time unrolled shift of the chain (last chip goes first) */
+template <uint8_t CHIP>
+struct ShiftRegisterChips
+{
+    __attribute__((always_inline))
+    static inline void shift(ShiftRegisterPins* pins, const uint8_t* image)
+    {
+        ShiftRegisterBits<7>::shift(pins, image[CHIP]);
+        ShiftRegisterChips<CHIP - 1>::shift(pins, image);
+    }
+};
+
+template <>
+struct ShiftRegisterChips<0>
+{
+    __attribute__((always_inline))
+    static inline void shift(ShiftRegisterPins* pins, const uint8_t* image)
+    { ShiftRegisterBits<7>::shift(pins, image[0]); }
+};
+
+/* Chain of NUM_CHIPS shift registers */
+template <uint8_t NUM_CHIPS>
+class ShiftRegister : public ShiftRegisterImage
+{
+    static_assert(NUM_CHIPS > 0, "Chain must have at least one chip");
+    static_assert(NUM_CHIPS <= 32, "Outputs are addressed with 8 bits");
+
+    public:
+        /* ShiftRegister constructor */
+        ShiftRegister(DigitalOut* data, DigitalOut* clock, DigitalOut* latch)
+            : ShiftRegisterImage(this->outputs, NUM_CHIPS),
+              pins(data, clock, latch)
+        {}
+
+        /* Initialize pins and set all the outputs to an initial value */
+        bool setup(const uint8_t initial_value = 0)
+        {
+            if(!this->pins.setup())
+                return false;
+
+            for(uint8_t chip = 0; chip < NUM_CHIPS; chip++)
+                this->outputs[chip] = (initial_value != 0) ? 0xff : 0x00;
+            this->dirty = true;
+
+            return update();
+        }
+
+        /* Shift and latch the image if it has changed (returns true if it
+         * has been shifted) */
+        bool update(void)
+        {
+            if(!this->dirty)
+                return false;
+
+            this->dirty = false;
+            ShiftRegisterChips<NUM_CHIPS - 1>::shift(&(this->pins),
+                    this->outputs);
+            this->pins.latch_outputs();
+
+            return true;
+        }
+
+    private:
+        ShiftRegisterPins pins;
+        uint8_t outputs[NUM_CHIPS];
+};
+
+/* Chained output with a DigitalOut interface (applied on chain update()) */
+class ShiftRegisterOut
+{
+    public:
+        ShiftRegisterOut(ShiftRegisterImage* chain, const uint8_t output);
+        ~ShiftRegisterOut();
+
+        bool setup(const uint8_t initial_value = 0);
+        bool set_low(void);
+        bool set_high(void);
+        bool toggle(void);
+
+    private:
+        ShiftRegisterImage* chain;
+        uint8_t output;
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_SHIFT_REGISTER_H_
+#endif // THE_HAL_COMPONENT_SHIFT_REGISTER
@@ -0,0 +1,58 @@
+// Requires THE_HAL_COMPONENT_SOFT_I2C enabled in thehal.h
+// Scans the bus and reads the first bytes of a 24LC256 EEPROM (address
+// 0x50) with a repeated start, through any two pins (with pull-up resistors)
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define PIN_SCL 2
+#define PIN_SDA 3
+
+#define EEPROM_ADDRESS 0x50
+
+#define HALF_PERIOD_LOOPS 0
+
+/*****************************************************************************/
+
+DigitalOut Scl(PIN_SCL);
+DigitalOut Sda(PIN_SDA);
+
+SoftI2c MyI2c(&Scl, &Sda);
+
+/*****************************************************************************/
+
+void setup()
+{
+    Serial.begin(115200);
+    if(!MyI2c.setup(HALF_PERIOD_LOOPS))
+        Serial.println("I2C lines setup fail");
+
+    for(uint8_t address = 0x08; address < 0x78; address++)
+    {
+        if(MyI2c.probe(address))
+        {
+            Serial.print("Device found at 0x");
+            Serial.println(address, HEX);
+        }
+    }
+}
+
+void loop()
+{
+    const uint8_t memory_address[2] = { 0x00, 0x00 };
+    uint8_t data[16];
+
+    if(MyI2c.write_read(EEPROM_ADDRESS, memory_address,
+            sizeof(memory_address), data, sizeof(data)))
+    {
+        for(uint8_t i = 0; i < sizeof(data); i++)
+        {
+            Serial.print(data[i], HEX);
+            Serial.print(" ");
+        }
+        Serial.println();
+    }
+    else
+        Serial.println("EEPROM not answering");
+    delay(1000);
+}
@@ -0,0 +1,275 @@
+
+/**
+ * @file    soft_i2c.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged I2C Master Controller (SCL and SDA open-drain lines with
+ * clock stretching, 7 bits addresses).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_SOFT_I2C == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "soft_i2c.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    MAX_ADDRESS = 0x7f,
+    WRITE = 0,
+    READ = 1,
+    LAST_BIT = 7
+} the_hal_soft_i2c_constants;
+
+/*****************************************************************************/
+
+/* SoftI2cLines Constructor */
+
+/* SoftI2cLines constructor */
+SoftI2cLines::SoftI2cLines(DigitalOut* scl, DigitalOut* sda)
+{
+    this->scl = scl;
+    this->sda = sda;
+    this->half_period_loops = 0;
+}
+
+/* SoftI2cLines destructor */
+SoftI2cLines::~SoftI2cLines()
+{}
+
+/*****************************************************************************/
+
+/* SoftI2cLines Public Methods */
+
+/* Configure both lines as open-drain outputs released (bus idle) */
+bool SoftI2cLines::setup(const uint16_t half_period_loops)
+{
+    if((this->scl == nullptr) || (this->sda == nullptr))
+        return false;
+
+    this->half_period_loops = half_period_loops;
+    if(!this->scl->setup_open_drain(1))
+        return false;
+    if(!this->sda->setup_open_drain(1))
+        return false;
+
+    return true;
+}
+
+/* Check if both lines are high (no device is holding the bus) */
+bool SoftI2cLines::is_bus_free(void)
+{
+    return (this->scl->read() && this->sda->read());
+}
+
+/*****************************************************************************/
+
+/* SoftI2c Constructor */
+
+/* SoftI2c constructor */
+SoftI2c::SoftI2c(DigitalOut* scl, DigitalOut* sda) : lines(scl, sda)
+{
+    this->started = false;
+    this->initialized = false;
+}
+
+/* SoftI2c destructor */
+SoftI2c::~SoftI2c()
+{}
+
+/*****************************************************************************/
+
+/* SoftI2c Public Methods */
+
+/* Initialize lines released, with the loops of each half clock period */
+bool SoftI2c::setup(const uint16_t half_period_loops)
+{
+    this->initialized = this->lines.setup(half_period_loops);
+    this->started = false;
+    return this->initialized;
+}
+
+/* Check if a device acknowledges its address */
+bool SoftI2c::probe(const uint8_t address)
+{
+    if(!this->initialized || (address > MAX_ADDRESS))
+        return false;
+
+    if(!start() || !write_byte((uint8_t)((address << 1) | WRITE)))
+        return fail();
+
+    return stop();
+}
+
+/* Write a burst of bytes to a device (without stop the bus is kept for a
+ * repeated start) */
+bool SoftI2c::write(const uint8_t address, const uint8_t* data,
+        const size_t length, const bool stop)
+{
+    if(!this->initialized || (address > MAX_ADDRESS))
+        return false;
+    if((data == nullptr) && (length > 0))
+        return false;
+
+    if(!start() || !write_byte((uint8_t)((address << 1) | WRITE)))
+        return fail();
+    for(size_t i = 0; i < length; i++)
+    {
+        if(!write_byte(data[i]))
+            return fail();
+    }
+
+    if(stop)
+        return this->stop();
+    return true;
+}
+
+/* Read a burst of bytes from a device (last byte is not acknowledged) */
+bool SoftI2c::read(const uint8_t address, uint8_t* data,
+        const size_t length, const bool stop)
+{
+    if(!this->initialized || (address > MAX_ADDRESS))
+        return false;
+    if((data == nullptr) || (length == 0))
+        return false;
+
+    if(!start() || !write_byte((uint8_t)((address << 1) | READ)))
+        return fail();
+    for(size_t i = 0; i < length; i++)
+    {
+        if(!read_byte(&(data[i]), (i + 1) < length))
+            return fail();
+    }
+
+    if(stop)
+        return this->stop();
+    return true;
+}
+
+/* Write bytes and read the answer with a repeated start (i.e. register or
+ * memory address followed by its data) */
+bool SoftI2c::write_read(const uint8_t address, const uint8_t* tx_data,
+        const size_t tx_length, uint8_t* rx_data, const size_t rx_length)
+{
+    if(!write(address, tx_data, tx_length, false))
+        return false;
+    return read(address, rx_data, rx_length, true);
+}
+
+/*****************************************************************************/
+
+/* SoftI2c Private Methods */
+
+/* Generate a start condition (or a repeated start if the bus is kept) */
+bool SoftI2c::start(void)
+{
+    if(this->started)
+    {
+        if(!this->lines.sda_release())
+            return false;
+        this->lines.wait();
+        if(!this->lines.scl_release())
+            return false;
+        this->lines.wait();
+    }
+    else if(!this->lines.is_bus_free())
+        return false;
+
+    if(!this->lines.sda_low())
+        return false;
+    this->started = true;
+    this->lines.wait();
+
+    return this->lines.scl_low();
+}
+
+/* Generate a stop condition (bus is released, returns false if a line
+ * could not be released) */
+bool SoftI2c::stop(void)
+{
+    bool released = this->lines.sda_low();
+
+    this->lines.wait();
+    released = this->lines.scl_release() && released;
+    this->lines.wait();
+    released = this->lines.sda_release() && released;
+    this->lines.wait();
+    this->started = false;
+
+    return released;
+}
+
+/* Send a byte (returns false if it is not acknowledged) */
+bool SoftI2c::write_byte(const uint8_t value)
+{
+    bool nack = true;
+
+    if(!SoftI2cBits<LAST_BIT>::write(&(this->lines), value))
+        return false;
+    if(!this->lines.read_bit(&nack))
+        return false;
+
+    return !nack;
+}
+
+/* Receive a byte and acknowledge it (or not, for the last byte) */
+bool SoftI2c::read_byte(uint8_t* value, const bool ack)
+{
+    *value = 0;
+    if(!SoftI2cBits<LAST_BIT>::read(&(this->lines), value))
+        return false;
+
+    return this->lines.write_bit(!ack);
+}
+
+/* Abort current transfer releasing the bus */
+bool SoftI2c::fail(void)
+{
+    if(this->started)
+        stop();
+    return false;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_SOFT_I2C == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,246 @@
+
+/**
+ * @file    soft_i2c.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged I2C Master Controller (SCL and SDA open-drain lines with
+ * clock stretching, 7 bits addresses).
+ *
+ * Each line is a DigitalOut configured as open-drain output: low pulls
+ * the line low and high releases it, so the pin is never driven high
+ * against a device holding the line low, and the line level is read back
+ * from the same DigitalOut. The bus needs pull-up resistors.
+ *
+ * The bits of each byte are unrolled at compile time. After releasing SCL
+ * the master waits until the line is high, so devices can stretch the
+ * clock (up to THE_HAL_SOFT_I2C_STRETCH_LOOPS reads). Bursts are written
+ * and read straight from/to the caller buffers:
+ *
+ *   SoftI2c I2c(&Scl, &Sda);
+ *
+ *   I2c.setup(0);
+ *   I2c.write_read(0x50, address, 2, data, sizeof(data));
+ *
+ * The setup() argument is the number of busy loops of each half clock
+ * period, 0 runs as fast as the pins can be reconfigured (check that it
+ * does not exceed the bus speed of the devices on fast MCUs).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_SOFT_I2C == 1
+
+/* Include Guard */
+#ifndef THE_HAL_SOFT_I2C_H_
+#define THE_HAL_SOFT_I2C_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum SCL reads waiting for a device that stretches the clock */
+#define THE_HAL_SOFT_I2C_STRETCH_LOOPS 50000
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Open-drain SCL and SDA lines of the bus */
+class SoftI2cLines
+{
+    public:
+        SoftI2cLines(DigitalOut* scl, DigitalOut* sda);
+        ~SoftI2cLines();
+
+        bool setup(const uint16_t half_period_loops);
+        bool is_bus_free(void);
+
+        /* Wait a half clock period (empty asm keeps the loop) */
+        __attribute__((always_inline))
+        inline void wait(void)
+        {
+            for(uint16_t i = 0; i < this->half_period_loops; i++)
+                __asm__ __volatile__("");
+        }
+
+        /* Pull SDA low */
+        __attribute__((always_inline))
+        inline bool sda_low(void)
+        { return this->sda->set_low(); }
+
+        /* Release SDA (pulled up) */
+        __attribute__((always_inline))
+        inline bool sda_release(void)
+        { return this->sda->set_high(); }
+
+        /* Get SDA level */
+        __attribute__((always_inline))
+        inline bool sda_read(void)
+        { return this->sda->read(); }
+
+        /* Pull SCL low */
+        __attribute__((always_inline))
+        inline bool scl_low(void)
+        { return this->scl->set_low(); }
+
+        /* Release SCL and wait while a device stretches the clock
+         * (returns false on timeout) */
+        __attribute__((always_inline))
+        inline bool scl_release(void)
+        {
+            if(!this->scl->set_high())
+                return false;
+            for(uint16_t i = 0; i < THE_HAL_SOFT_I2C_STRETCH_LOOPS; i++)
+            {
+                if(this->scl->read())
+                    return true;
+            }
+            return false;
+        }
+
+        /* Send a bit (SCL is low before and after it) */
+        __attribute__((always_inline))
+        inline bool write_bit(const bool value)
+        {
+            if(!((value) ? sda_release() : sda_low()))
+                return false;
+            wait();
+            if(!scl_release())
+                return false;
+            wait();
+            return scl_low();
+        }
+
+        /* Receive a bit (SCL is low before and after it) */
+        __attribute__((always_inline))
+        inline bool read_bit(bool* value)
+        {
+            if(!sda_release())
+                return false;
+            wait();
+            if(!scl_release())
+                return false;
+            *value = sda_read();
+            wait();
+            return scl_low();
+        }
+
+    private:
+        DigitalOut* scl;
+        DigitalOut* sda;
+        uint16_t half_period_loops;
+};
+
+/* Compile time unrolled transfer of a byte (MSB first) */
+template <uint8_t BIT>
+struct SoftI2cBits
+{
+    __attribute__((always_inline))
+    static inline bool write(SoftI2cLines* lines, const uint8_t value)
+    {
+        if(!lines->write_bit((value & (1 << BIT)) != 0))
+            return false;
+        return SoftI2cBits<BIT - 1>::write(lines, value);
+    }
+
+    __attribute__((always_inline))
+    static inline bool read(SoftI2cLines* lines, uint8_t* value)
+    {
+        bool bit;
+
+        if(!lines->read_bit(&bit))
+            return false;
+        if(bit)
+            *value = *value | (uint8_t)(1 << BIT);
+        return SoftI2cBits<BIT - 1>::read(lines, value);
+    }
+};
+
+template <>
+struct SoftI2cBits<0>
+{
+    __attribute__((always_inline))
+    static inline bool write(SoftI2cLines* lines, const uint8_t value)
+    { return lines->write_bit((value & 1) != 0); }
+
+    __attribute__((always_inline))
+    static inline bool read(SoftI2cLines* lines, uint8_t* value)
+    {
+        bool bit;
+
+        if(!lines->read_bit(&bit))
+            return false;
+        if(bit)
+            *value = *value | 1;
+        return true;
+    }
+};
+
+/* I2C master */
+class SoftI2c
+{
+    public:
+        SoftI2c(DigitalOut* scl, DigitalOut* sda);
+        ~SoftI2c();
+
+        bool setup(const uint16_t half_period_loops);
+        bool probe(const uint8_t address);
+        bool write(const uint8_t address, const uint8_t* data,
+                const size_t length, const bool stop = true);
+        bool read(const uint8_t address, uint8_t* data,
+                const size_t length, const bool stop = true);
+        bool write_read(const uint8_t address, const uint8_t* tx_data,
+                const size_t tx_length, uint8_t* rx_data,
+                const size_t rx_length);
+
+    private:
+        SoftI2cLines lines;
+        bool started;
+        bool initialized;
+
+        bool start(void);
+        bool stop(void);
+        bool write_byte(const uint8_t value);
+        bool read_byte(uint8_t* value, const bool ack);
+        bool fail(void);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_SOFT_I2C_H_
+#endif // THE_HAL_COMPONENT_SOFT_I2C
@@ -0,0 +1,48 @@
+// Requires THE_HAL_COMPONENT_SOFT_SPI enabled in thehal.h
+// Reads the JEDEC ID of a SPI flash memory (mode 0) through any pins, the
+// command and the answer are shifted in a single burst
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define PIN_SCK 5
+#define PIN_MOSI 6
+#define PIN_MISO 7
+#define PIN_CS 8
+
+#define CMD_READ_JEDEC_ID 0x9f
+
+/*****************************************************************************/
+
+DigitalOut Sck(PIN_SCK);
+DigitalOut Mosi(PIN_MOSI);
+DigitalIn Miso(PIN_MISO);
+DigitalOut Cs(PIN_CS);
+
+SoftSpi MySpi(&Sck, &Mosi, &Miso);
+
+/*****************************************************************************/
+
+void setup()
+{
+    Serial.begin(115200);
+    Cs.setup(1);
+    MySpi.setup(THE_HAL_SOFT_SPI_MODE_0);
+}
+
+void loop()
+{
+    uint8_t tx[4] = { CMD_READ_JEDEC_ID, 0xff, 0xff, 0xff };
+    uint8_t rx[4];
+
+    Cs.set_low();
+    MySpi.transfer(tx, rx, sizeof(tx));
+    Cs.set_high();
+
+    Serial.print("Manufacturer: 0x");
+    Serial.print(rx[1], HEX);
+    Serial.print(", Device: 0x");
+    Serial.print(rx[2], HEX);
+    Serial.println(rx[3], HEX);
+    delay(1000);
+}
@@ -0,0 +1,214 @@
+
+/**
+ * @file    soft_spi.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged SPI Master Controller (SCK and MOSI DigitalOut pins and MISO
+ * DigitalIn pin, any of the four SPI modes, MSB first).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_SOFT_SPI == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "soft_spi.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    NO_PULL_RESISTOR = 0,
+    MODE_CPOL = 0x02,
+    MODE_CPHA = 0x01,
+    LAST_BIT = 7
+} the_hal_soft_spi_constants;
+
+/*****************************************************************************/
+
+/* SoftSpiPins Constructor */
+
+/* SoftSpiPins constructor */
+SoftSpiPins::SoftSpiPins(DigitalOut* sck, DigitalOut* mosi, DigitalIn* miso)
+{
+    this->sck = sck;
+    this->mosi = mosi;
+    this->miso = miso;
+    this->mosi_level = false;
+}
+
+/* SoftSpiPins destructor */
+SoftSpiPins::~SoftSpiPins()
+{}
+
+/*****************************************************************************/
+
+/* SoftSpiPins Public Methods */
+
+/* Initialize clock at its idle level and data out low */
+bool SoftSpiPins::setup(const bool clock_idle_level)
+{
+    if((this->sck == nullptr) || (this->mosi == nullptr))
+        return false;
+
+    if(!this->sck->setup(clock_idle_level ? 1 : 0))
+        return false;
+    if(!this->mosi->setup(0))
+        return false;
+    this->mosi_level = false;
+
+    if(this->miso != nullptr)
+        return this->miso->setup(NO_PULL_RESISTOR);
+    return true;
+}
+
+/*****************************************************************************/
+
+/* SoftSpi Constructor */
+
+/* SoftSpi constructor */
+SoftSpi::SoftSpi(DigitalOut* sck, DigitalOut* mosi, DigitalIn* miso) :
+    pins(sck, mosi, miso)
+{
+    this->mode = THE_HAL_SOFT_SPI_MODE_0;
+    this->initialized = false;
+}
+
+/* SoftSpi destructor */
+SoftSpi::~SoftSpi()
+{}
+
+/*****************************************************************************/
+
+/* SoftSpi Public Methods */
+
+/* Initialize pins for a SPI mode (clock is left at its idle level) */
+bool SoftSpi::setup(const uint8_t mode)
+{
+    this->initialized = false;
+    if(mode > THE_HAL_SOFT_SPI_MODE_3)
+        return false;
+
+    if(!this->pins.setup((mode & MODE_CPOL) != 0))
+        return false;
+
+    this->mode = mode;
+    this->initialized = true;
+    return true;
+}
+
+/* Send a byte and return the byte received at the same time */
+uint8_t SoftSpi::transfer(const uint8_t value)
+{
+    uint8_t received = 0;
+
+    transfer(&value, &received, 1);
+    return received;
+}
+
+/* Send and receive a burst of bytes (tx_data nullptr sends fill bytes,
+ * rx_data nullptr discards received bytes) */
+bool SoftSpi::transfer(const uint8_t* tx_data, uint8_t* rx_data,
+        const size_t length)
+{
+    if(!this->initialized)
+        return false;
+
+    // Mode is resolved once per burst, each mode has its own unrolled loop
+    switch(this->mode)
+    {
+        case THE_HAL_SOFT_SPI_MODE_0:
+            return transfer_bytes<false, false>(tx_data, rx_data, length);
+        case THE_HAL_SOFT_SPI_MODE_1:
+            return transfer_bytes<false, true>(tx_data, rx_data, length);
+        case THE_HAL_SOFT_SPI_MODE_2:
+            return transfer_bytes<true, false>(tx_data, rx_data, length);
+        default:
+            return transfer_bytes<true, true>(tx_data, rx_data, length);
+    }
+}
+
+/* Send a burst of bytes ignoring received data */
+bool SoftSpi::write(const uint8_t* data, const size_t length)
+{
+    if(data == nullptr)
+        return false;
+    return transfer(data, nullptr, length);
+}
+
+/* Receive a burst of bytes sending fill bytes */
+bool SoftSpi::read(uint8_t* data, const size_t length)
+{
+    if(data == nullptr)
+        return false;
+    return transfer(nullptr, data, length);
+}
+
+/*****************************************************************************/
+
+/* SoftSpi Private Methods */
+
+/* Transfer bytes with the unrolled bit sequence of a mode (stops at the
+ * first pin write failure) */
+template <bool CPOL, bool CPHA>
+bool SoftSpi::transfer_bytes(const uint8_t* tx_data, uint8_t* rx_data,
+        const size_t length)
+{
+    uint8_t value;
+    uint8_t received;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        value = (tx_data != nullptr) ? tx_data[i] :
+                (uint8_t)(THE_HAL_SOFT_SPI_FILL_BYTE);
+        received = 0;
+        if(!SoftSpiBits<CPOL, CPHA, LAST_BIT>::transfer(&(this->pins),
+                value, &received))
+            return false;
+        if(rx_data != nullptr)
+            rx_data[i] = received;
+    }
+
+    return true;
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_SOFT_SPI == 1 */
+
+/*****************************************************************************/
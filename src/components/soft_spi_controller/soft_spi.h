@@ -0,0 +1,232 @@
+
+/**
+ * @file    soft_spi.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Bit-Banged SPI Master Controller (SCK and MOSI DigitalOut pins and MISO
+ * DigitalIn pin, any of the four SPI modes, MSB first).
+ *
+ * The bits of each byte are unrolled at compile time for each mode, so
+ * there is no mode nor bit index handling per bit, and MOSI is only
+ * written when the next bit differs from the last one. Bursts are shifted
+ * straight from/to the caller buffers:
+ *
+ *   SoftSpi Spi(&Sck, &Mosi, &Miso);
+ *
+ *   Spi.setup(THE_HAL_SOFT_SPI_MODE_0);
+ *   Cs.set_low();
+ *   Spi.transfer(tx_buffer, rx_buffer, sizeof(tx_buffer));
+ *   Cs.set_high();
+ *
+ * Chip select is handled by the application. MISO may be nullptr for
+ * write-only devices. There are no delays between clock edges, so the bus
+ * runs as fast as the pins can be written (use the header-only build to
+ * get the pin writes inlined). A failed pin write aborts the transfer
+ * (false is returned).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_SOFT_SPI == 1
+
+/* Include Guard */
+#ifndef THE_HAL_SOFT_SPI_H_
+#define THE_HAL_SOFT_SPI_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Byte sent on reads (transfers without transmission buffer) */
+#define THE_HAL_SOFT_SPI_FILL_BYTE 0xff
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../digital_out_controller/digital_out.h"
+#include "../digital_in_controller/digital_in.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/* SPI modes (bit 1 is the clock polarity and bit 0 is the clock phase) */
+typedef enum
+{
+    THE_HAL_SOFT_SPI_MODE_0 = 0,
+    THE_HAL_SOFT_SPI_MODE_1 = 1,
+    THE_HAL_SOFT_SPI_MODE_2 = 2,
+    THE_HAL_SOFT_SPI_MODE_3 = 3
+} the_hal_soft_spi_mode;
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Clock and data pins of the bus */
+class SoftSpiPins
+{
+    public:
+        SoftSpiPins(DigitalOut* sck, DigitalOut* mosi, DigitalIn* miso);
+        ~SoftSpiPins();
+
+        bool setup(const bool clock_idle_level);
+
+        /* Shift out a bit and sample a bit (CPOL is the clock idle level,
+         * CPHA true shifts on the leading edge and samples on trailing),
+         * false if a pin could not be written */
+        template <bool CPOL, bool CPHA>
+        __attribute__((always_inline))
+        inline bool transfer_bit(const bool value, bool* sample)
+        {
+            if(!CPHA && !write_mosi(value))
+                return false;
+            if(!write_clock(!CPOL))
+                return false;
+            if(CPHA)
+            {
+                if(!write_mosi(value))
+                    return false;
+            }
+            else
+                *sample = read_miso();
+            if(!write_clock(CPOL))
+                return false;
+            if(CPHA)
+                *sample = read_miso();
+
+            return true;
+        }
+
+    private:
+        DigitalOut* sck;
+        DigitalOut* mosi;
+        DigitalIn* miso;
+        bool mosi_level;
+
+        /* Set clock level (constant level, so no branch is left) */
+        __attribute__((always_inline))
+        inline bool write_clock(const bool level)
+        {
+            if(level)
+                return this->sck->set_high();
+            return this->sck->set_low();
+        }
+
+        /* Set data out level (pin is only written if the level changes) */
+        __attribute__((always_inline))
+        inline bool write_mosi(const bool level)
+        {
+            if(level == this->mosi_level)
+                return true;
+            if(!((level) ? this->mosi->set_high() : this->mosi->set_low()))
+                return false;
+            this->mosi_level = level;
+            return true;
+        }
+
+        /* Get data in level (low if there is no MISO pin) */
+        __attribute__((always_inline))
+        inline bool read_miso(void)
+        {
+            if(this->miso == nullptr)
+                return false;
+            return this->miso->read();
+        }
+};
+
+/* Compile time unrolled transfer of a byte (MSB first, received bits are
+ * set in the provided byte) */
+template <bool CPOL, bool CPHA, uint8_t BIT>
+struct SoftSpiBits
+{
+    __attribute__((always_inline))
+    static inline bool transfer(SoftSpiPins* pins, const uint8_t value,
+            uint8_t* received)
+    {
+        bool bit = false;
+
+        if(!pins->transfer_bit<CPOL, CPHA>((value & (1 << BIT)) != 0, &bit))
+            return false;
+        if(bit)
+            *received = *received | (uint8_t)(1 << BIT);
+        return SoftSpiBits<CPOL, CPHA, BIT - 1>::transfer(pins, value,
+                received);
+    }
+};
+
+template <bool CPOL, bool CPHA>
+struct SoftSpiBits<CPOL, CPHA, 0>
+{
+    __attribute__((always_inline))
+    static inline bool transfer(SoftSpiPins* pins, const uint8_t value,
+            uint8_t* received)
+    {
+        bool bit = false;
+
+        if(!pins->transfer_bit<CPOL, CPHA>((value & 1) != 0, &bit))
+            return false;
+        if(bit)
+            *received = *received | 1;
+        return true;
+    }
+};
+
+/* SPI master */
+class SoftSpi
+{
+    public:
+        SoftSpi(DigitalOut* sck, DigitalOut* mosi, DigitalIn* miso);
+        ~SoftSpi();
+
+        bool setup(const uint8_t mode);
+        uint8_t transfer(const uint8_t value);
+        bool transfer(const uint8_t* tx_data, uint8_t* rx_data,
+                const size_t length);
+        bool write(const uint8_t* data, const size_t length);
+        bool read(uint8_t* data, const size_t length);
+
+    private:
+        SoftSpiPins pins;
+        uint8_t mode;
+        bool initialized;
+
+        template <bool CPOL, bool CPHA>
+        bool transfer_bytes(const uint8_t* tx_data, uint8_t* rx_data,
+                const size_t length);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_SOFT_SPI_H_
+#endif // THE_HAL_COMPONENT_SOFT_SPI
@@ -0,0 +1,52 @@
+// Requires THE_HAL_COMPONENT_STEPPER enabled in thehal.h
+// Moves 2 axes back and forth with trapezoidal profiles, steps generated at
+// 20 kHz (AVR Timer1). STEP and DIR pins 2 to 5 are all in PORTD of an Uno,
+// so simultaneous steps are a single port write
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define NUM_AXES 2
+
+#define TICK_HZ 20000
+
+/*****************************************************************************/
+
+// STEP X, STEP Y, DIR X, DIR Y
+const int8_t STEPPER_PINS[NUM_AXES * 2] = { 2, 3, 4, 5 };
+
+DigitalOutBus MyBus(STEPPER_PINS, NUM_AXES * 2);
+Stepper MyStepper(&MyBus, NUM_AXES, TICK_HZ);
+
+int32_t target[NUM_AXES] = { 3200, 800 };
+
+/*****************************************************************************/
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyStepper.tick();
+}
+
+void setup()
+{
+    MyStepper.setup();
+    MyStepper.set_max_speed(4000);
+    MyStepper.set_acceleration(8000);
+
+    // Timer1 CTC mode, prescaler 8, 20 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11);
+    OCR1A = (F_CPU / 8 / TICK_HZ) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{
+    if(MyStepper.is_running())
+        return;
+
+    MyStepper.move_to(target);
+    target[0] = -target[0];
+    target[1] = -target[1];
+    delay(500);
+}
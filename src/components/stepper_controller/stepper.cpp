@@ -0,0 +1,503 @@
+
+/**
+ * @file    stepper.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Stepper Motors Controller (coordinated multi-axis moves with trapezoidal
+ * or S-curve speed profiles, STEP/DIR pins driven from a timer interrupt).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_STEPPER == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "stepper.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    STATE_IDLE = 0,
+    STATE_ACCEL = 1,
+    STATE_CRUISE = 2,
+    STATE_DECEL = 3,
+    STATE_FINISH = 4
+} the_hal_stepper_constants;
+
+/* Maximum phase increment per tick (a step every 2 ticks) */
+static const uint32_t MAX_SPEED = 0x80000000UL;
+
+/* Ramp tick not reached yet */
+static const uint32_t NO_TICK = 0xffffffffUL;
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/* Stepper constructor (bus bits 0 to num_axes - 1 are the STEP pins and
+ * bits num_axes to 2 * num_axes - 1 the DIR pins, tick_hz is the tick()
+ * calls frequency) */
+Stepper::Stepper(DigitalOutBus* bus, const uint8_t num_axes,
+        const uint32_t tick_hz)
+{
+    this->bus = bus;
+    this->num_axes = num_axes;
+    this->tick_hz = tick_hz;
+    this->max_speed = 0;
+    this->acceleration = 0;
+    this->jerk = 0;
+    this->rise_ticks = 0;
+    this->rise_gain = 0;
+    this->fall_start = NO_TICK;
+    this->ramp_tick = 0;
+    this->phase = 0;
+    this->speed = 0;
+    this->first_step_speed = 0;
+    this->master_steps = 0;
+    this->total_steps = 0;
+    this->done_steps = 0;
+    this->accel_steps = 0;
+    this->directions = 0;
+    this->step_pulses = 0;
+    this->state = STATE_IDLE;
+    this->stop_requested = false;
+    this->initialized = false;
+    for(uint8_t i = 0; i < THE_HAL_STEPPER_MAX_AXES; i++)
+    {
+        this->positions[i] = 0;
+        this->deltas[i] = 0;
+        this->errors[i] = 0;
+    }
+}
+
+/* Stepper destructor */
+Stepper::~Stepper()
+{}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/* Initialize the bus with all STEP and DIR pins low */
+bool Stepper::setup(void)
+{
+    if((this->bus == nullptr) || (this->tick_hz == 0))
+        return false;
+    if((this->num_axes == 0) || (this->num_axes > THE_HAL_STEPPER_MAX_AXES))
+        return false;
+
+    if(!this->bus->setup(0))
+        return false;
+
+    this->initialized = true;
+    return true;
+}
+
+/* Set cruise speed of the axis with most steps of the moves */
+bool Stepper::set_max_speed(const uint32_t steps_per_second)
+{
+    uint64_t speed;
+
+    if(is_running() || (this->tick_hz == 0))
+        return false;
+
+    speed = ((uint64_t)steps_per_second << 32) / this->tick_hz;
+    if(speed == 0)
+        return false;
+
+    this->max_speed = (speed > MAX_SPEED) ? MAX_SPEED : (uint32_t)speed;
+    return true;
+}
+
+/* Set acceleration (and deceleration) of the moves */
+bool Stepper::set_acceleration(const uint32_t steps_per_second2)
+{
+    uint64_t ticks2 = (uint64_t)this->tick_hz * this->tick_hz;
+    uint64_t acceleration;
+
+    if(is_running() || (this->tick_hz == 0))
+        return false;
+
+    acceleration = ((uint64_t)steps_per_second2 << 32) / ticks2;
+    if(acceleration == 0)
+        return false;
+
+    this->acceleration = (acceleration > MAX_SPEED) ?
+            MAX_SPEED : (uint32_t)acceleration;
+    return true;
+}
+
+/* Set jerk for S-curve moves (0 for trapezoidal moves) */
+bool Stepper::set_jerk(const uint32_t steps_per_second3)
+{
+    uint64_t ticks2 = (uint64_t)this->tick_hz * this->tick_hz;
+    uint64_t jerk;
+
+    if(is_running() || (this->tick_hz == 0))
+        return false;
+
+    jerk = ((uint64_t)steps_per_second3 << 32) / ticks2;
+    jerk = (jerk << THE_HAL_STEPPER_JERK_SHIFT) / this->tick_hz;
+    if((steps_per_second3 != 0) && (jerk == 0))
+        jerk = 1;
+    this->jerk = (jerk > 0xffffffffUL) ? 0xffffffffUL : (uint32_t)jerk;
+
+    return true;
+}
+
+/* Start a relative move of all the axes (returns false if still moving) */
+bool Stepper::move(const int32_t* steps)
+{
+    if(!this->initialized || is_running())
+        return false;
+    if((this->max_speed == 0) || (this->acceleration == 0))
+        return false;
+
+    // S-curve rise is computed in 32 bits
+    if((this->jerk != 0) &&
+       (this->acceleration > (0xffffffffUL >> THE_HAL_STEPPER_JERK_SHIFT)))
+        return false;
+
+    prepare_axes(steps);
+    if(this->master_steps == 0)
+        return true;
+
+    reset_ramp();
+    set_state(STATE_ACCEL);
+
+    return true;
+}
+
+/* Start an absolute move of all the axes (returns false if still moving) */
+bool Stepper::move_to(const int32_t* positions)
+{
+    int32_t steps[THE_HAL_STEPPER_MAX_AXES];
+
+    if(is_running())
+        return false;
+
+    for(uint8_t i = 0; i < this->num_axes; i++)
+        steps[i] = positions[i] - get_position(i);
+
+    return move(steps);
+}
+
+/* Decelerate and stop current move */
+void Stepper::stop(void)
+{
+    this->stop_requested = true;
+}
+
+/* Check if a move is in progress */
+bool Stepper::is_running(void)
+{
+#if defined(__AVR__)
+    return (this->state != STATE_IDLE);
+#else
+    return (__atomic_load_n(&this->state, __ATOMIC_ACQUIRE) != STATE_IDLE);
+#endif
+}
+
+/* Get current position of an axis (steps) */
+int32_t Stepper::get_position(const uint8_t axis)
+{
+    int32_t position;
+
+    if(axis >= this->num_axes)
+        return 0;
+
+#if defined(__AVR__)
+    uint8_t sreg = SREG;
+    cli();
+    position = this->positions[axis];
+    SREG = sreg;
+#else
+    position = this->positions[axis];
+#endif
+
+    return position;
+}
+
+/* Set current position of an axis (i.e. after homing) */
+bool Stepper::set_position(const uint8_t axis, const int32_t position)
+{
+    if((axis >= this->num_axes) || is_running())
+        return false;
+
+    this->positions[axis] = position;
+    return true;
+}
+
+/* Generate the steps of a tick (to be called from a fixed rate timer
+ * interrupt of tick_hz frequency) */
+void Stepper::tick(void)
+{
+    uint32_t last_phase;
+    uint8_t steps = 0;
+
+    if(this->state == STATE_IDLE)
+        return;
+
+    // Last step pulse has been cleared, move is finished
+    if(this->state == STATE_FINISH)
+    {
+        this->bus->write_masked(0, this->step_pulses);
+        this->step_pulses = 0;
+        set_state(STATE_IDLE);
+        return;
+    }
+
+    if(this->stop_requested && (this->state != STATE_DECEL))
+        apply_stop_request();
+
+    update_speed();
+
+    last_phase = this->phase;
+    this->phase = this->phase + this->speed;
+    if(this->phase < last_phase)
+    {
+        steps = step_axes();
+        this->done_steps = this->done_steps + 1;
+        if(this->state == STATE_ACCEL)
+            this->accel_steps = this->accel_steps + 1;
+        if(this->first_step_speed == 0)
+            this->first_step_speed = this->speed;
+    }
+
+    // New steps and clear of last ones in the same write (they are never
+    // in consecutive ticks)
+    if(steps | this->step_pulses)
+        this->bus->write_masked(steps, this->step_pulses);
+    this->step_pulses = steps;
+
+    // Deceleration takes the same steps than the acceleration
+    if(this->done_steps >= this->total_steps)
+        this->state = STATE_FINISH;
+    else if((this->state != STATE_DECEL) &&
+            ((this->total_steps - this->done_steps) <= this->accel_steps))
+        this->state = STATE_DECEL;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/* Get the steps and direction of each axis of a move, set the DIR pins
+ * (master_steps is 0 if no axis moves) */
+void Stepper::prepare_axes(const int32_t* steps)
+{
+    uint8_t axes_mask = (1 << this->num_axes) - 1;
+
+    this->master_steps = 0;
+    this->directions = 0;
+    for(uint8_t i = 0; i < this->num_axes; i++)
+    {
+        if(steps[i] < 0)
+        {
+            this->directions = this->directions | (1 << i);
+            this->deltas[i] = -((int64_t)steps[i]);
+        }
+        else
+            this->deltas[i] = steps[i];
+        if(this->deltas[i] > this->master_steps)
+            this->master_steps = this->deltas[i];
+    }
+    if(this->master_steps == 0)
+        return;
+    for(uint8_t i = 0; i < this->num_axes; i++)
+        this->errors[i] = this->master_steps >> 1;
+
+    // DIR pins are set before the first step
+    this->bus->write_masked(
+            (uint32_t)this->directions << this->num_axes,
+            (uint32_t)(~this->directions & axes_mask) << this->num_axes);
+}
+
+/* Reset the ramp and the steps count for a move of master_steps */
+void Stepper::reset_ramp(void)
+{
+    uint64_t rise_ticks = 0;
+
+    if(this->jerk != 0)
+    {
+        rise_ticks = ((uint64_t)this->acceleration <<
+                THE_HAL_STEPPER_JERK_SHIFT) + this->jerk - 1;
+        rise_ticks = rise_ticks / this->jerk;
+    }
+    this->rise_ticks = (uint32_t)rise_ticks;
+    this->rise_gain = 0;
+    this->fall_start = NO_TICK;
+    this->ramp_tick = 0;
+    this->phase = 0;
+    this->speed = 0;
+    this->first_step_speed = 0;
+    this->total_steps = this->master_steps;
+    this->done_steps = 0;
+    this->accel_steps = 0;
+    this->step_pulses = 0;
+    this->stop_requested = false;
+}
+
+/* Shorten the move to the steps needed to decelerate (stop request) */
+void Stepper::apply_stop_request(void)
+{
+    if((this->total_steps - this->done_steps) > this->accel_steps)
+        this->total_steps = this->done_steps + this->accel_steps;
+    this->state = STATE_DECEL;
+    this->stop_requested = false;
+}
+
+/* Update the speed of the tick following the ramp state */
+void Stepper::update_speed(void)
+{
+    uint32_t acceleration;
+
+    if(this->state == STATE_ACCEL)
+    {
+        acceleration = get_ramp_acceleration(this->ramp_tick);
+        if((acceleration == 0) && (this->fall_start != NO_TICK))
+        {
+            this->state = STATE_CRUISE;
+            return;
+        }
+        if(acceleration >= (this->max_speed - this->speed))
+        {
+            this->speed = this->max_speed;
+            this->state = STATE_CRUISE;
+            return;
+        }
+        this->speed = this->speed + acceleration;
+        this->ramp_tick = this->ramp_tick + 1;
+
+        // Start jerk-down when it would gain the speed of the jerk-up
+        if((this->jerk != 0) && (this->fall_start == NO_TICK))
+        {
+            if(this->ramp_tick <= this->rise_ticks)
+                this->rise_gain = this->rise_gain + acceleration;
+            if(this->rise_gain >= (this->max_speed - this->speed))
+                this->fall_start = this->ramp_tick;
+        }
+    }
+    else if(this->state == STATE_DECEL)
+    {
+        // Replay acceleration ramp backwards, keeping the speed of the
+        // first step when the ramp ends before the last steps
+        if(this->ramp_tick == 0)
+            return;
+        this->ramp_tick = this->ramp_tick - 1;
+        acceleration = get_ramp_acceleration(this->ramp_tick);
+        if(this->speed > (this->first_step_speed + acceleration))
+            this->speed = this->speed - acceleration;
+        else
+            this->speed = this->first_step_speed;
+    }
+}
+
+/* Step the axes that follow the master one (Bresenham), returns the mask
+ * of the STEP pins to be set */
+uint8_t Stepper::step_axes(void)
+{
+    uint8_t steps = 0;
+
+    for(uint8_t i = 0; i < this->num_axes; i++)
+    {
+        this->errors[i] = this->errors[i] + this->deltas[i];
+        if(this->errors[i] < this->master_steps)
+            continue;
+
+        this->errors[i] = this->errors[i] - this->master_steps;
+        steps = steps | (1 << i);
+        if(this->directions & (1 << i))
+            this->positions[i] = this->positions[i] - 1;
+        else
+            this->positions[i] = this->positions[i] + 1;
+    }
+
+    return steps;
+}
+
+/* Get acceleration of a ramp tick (jerk-down mirrors the jerk-up) */
+uint32_t Stepper::get_ramp_acceleration(const uint32_t tick)
+{
+    uint32_t fall_tick;
+    uint32_t rise_end;
+
+    if(this->jerk == 0)
+        return this->acceleration;
+    if(tick < this->fall_start)
+        return get_rise_acceleration(tick);
+
+    fall_tick = tick - this->fall_start;
+    rise_end = (this->fall_start < this->rise_ticks) ?
+            this->fall_start : this->rise_ticks;
+    if(fall_tick >= rise_end)
+        return 0;
+
+    return get_rise_acceleration(rise_end - 1 - fall_tick);
+}
+
+/* Get acceleration of a jerk-up tick (limited to max acceleration) */
+uint32_t Stepper::get_rise_acceleration(const uint32_t tick)
+{
+    if((tick + 1) >= this->rise_ticks)
+        return this->acceleration;
+
+    return ((this->jerk * (tick + 1)) >> THE_HAL_STEPPER_JERK_SHIFT);
+}
+
+/* Publish new move state to the interrupt */
+void Stepper::set_state(const uint8_t state)
+{
+#if defined(__AVR__)
+    this->state = state;
+#else
+    __atomic_store_n(&this->state, state, __ATOMIC_RELEASE);
+#endif
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_STEPPER == 1 */
+
+/*****************************************************************************/
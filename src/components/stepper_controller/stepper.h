@@ -0,0 +1,147 @@
+
+/**
+ * @file    stepper.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Stepper Motors Controller (coordinated multi-axis moves with trapezoidal
+ * or S-curve speed profiles, STEP/DIR pins driven from a timer interrupt).
+ *
+ * All STEP and DIR pins are grouped in a DigitalOutBus, so the steps of all
+ * the axes that happen in the same tick are a single bus write. For N axes,
+ * bus bits 0 to N - 1 are the STEP pins and bits N to 2N - 1 the DIR pins
+ * of the same axes order (DIR high moves backwards), i.e. for 2 axes:
+ *
+ *   const int8_t pins[4] = { X_STEP, Y_STEP, X_DIR, Y_DIR };
+ *   DigitalOutBus Motors(pins, 4);
+ *   Stepper Axes(&Motors, 2, 20000);
+ *
+ * tick() is called from a fixed rate timer interrupt. Speed is a phase
+ * increment that gives a step each time the phase accumulator overflows,
+ * and acceleration is added to the speed each tick, so the profile is
+ * computed incrementally with integer additions (no divisions nor floats
+ * in the interrupt). Deceleration replays the acceleration ramp backwards
+ * and starts when the remaining steps are the steps taken while
+ * accelerating. The axis with most steps sets the profile and the others
+ * follow it with Bresenham error counters.
+ *
+ * Step pulses are 1 tick wide and speed is limited to a step every 2 ticks.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_STEPPER == 1
+
+/* Include Guard */
+#ifndef THE_HAL_STEPPER_H_
+#define THE_HAL_STEPPER_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Maximum number of coordinated axes */
+#define THE_HAL_STEPPER_MAX_AXES 4
+
+/* Extra fractional bits of the jerk (S-curve acceleration resolution) */
+#define THE_HAL_STEPPER_JERK_SHIFT 8
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Class */
+
+class Stepper
+{
+    public:
+        Stepper(DigitalOutBus* bus, const uint8_t num_axes,
+                const uint32_t tick_hz);
+        ~Stepper();
+
+        bool setup(void);
+        bool set_max_speed(const uint32_t steps_per_second);
+        bool set_acceleration(const uint32_t steps_per_second2);
+        bool set_jerk(const uint32_t steps_per_second3);
+
+        bool move(const int32_t* steps);
+        bool move_to(const int32_t* positions);
+        void stop(void);
+        bool is_running(void);
+        int32_t get_position(const uint8_t axis);
+        bool set_position(const uint8_t axis, const int32_t position);
+
+        void tick(void);
+
+    private:
+        DigitalOutBus* bus;
+        volatile int32_t positions[THE_HAL_STEPPER_MAX_AXES];
+        uint32_t deltas[THE_HAL_STEPPER_MAX_AXES];
+        uint32_t errors[THE_HAL_STEPPER_MAX_AXES];
+        uint32_t tick_hz;
+        uint32_t max_speed;
+        uint32_t acceleration;
+        uint32_t jerk;
+        uint32_t rise_ticks;
+        uint32_t rise_gain;
+        uint32_t fall_start;
+        uint32_t ramp_tick;
+        uint32_t phase;
+        uint32_t speed;
+        uint32_t first_step_speed;
+        uint32_t master_steps;
+        uint32_t total_steps;
+        uint32_t done_steps;
+        uint32_t accel_steps;
+        uint8_t directions;
+        uint8_t step_pulses;
+        uint8_t num_axes;
+        volatile uint8_t state;
+        volatile bool stop_requested;
+        bool initialized;
+
+        void prepare_axes(const int32_t* steps);
+        void reset_ramp(void);
+        void apply_stop_request(void);
+        void update_speed(void);
+        uint8_t step_axes(void);
+        uint32_t get_ramp_acceleration(const uint32_t tick);
+        uint32_t get_rise_acceleration(const uint32_t tick);
+        void set_state(const uint8_t state);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_STEPPER_H_
+#endif // THE_HAL_COMPONENT_STEPPER
@@ -0,0 +1,45 @@
+// Requires THE_HAL_COMPONENT_TIMER_WHEEL enabled in thehal.h
+// Tick source is AVR Timer1 (1 ms compare match), 1 tick = 1 ms
+#include <thehal.h>
+
+/*****************************************************************************/
+
+#define GPIO_LED 13
+#define GPIO_STROBE 12
+
+/*****************************************************************************/
+
+DigitalOut MyLed(GPIO_LED);
+DigitalOut MyStrobe(GPIO_STROBE);
+
+TimerWheel MyWheel;
+TimedAction MyBlink;
+TimedAction MyPulse;
+
+/*****************************************************************************/
+
+ISR(TIMER1_COMPA_vect)
+{
+    MyWheel.tick();
+}
+
+void setup()
+{
+    MyLed.setup(0);
+    MyStrobe.setup(0);
+
+    // Toggle LED every 500 ms and 20 ms strobe pulse every second
+    MyBlink.setup(&MyLed, THE_HAL_TIMED_ACTION_TOGGLE, 500);
+    MyPulse.setup_pulse(&MyStrobe, 20, 1000);
+    MyWheel.schedule_in(&MyBlink, 500);
+    MyWheel.schedule_in(&MyPulse, 250);
+
+    // Timer1 CTC mode, prescaler 64, 1 kHz compare match interrupt
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11) | (1 << CS10);
+    OCR1A = (F_CPU / 64 / 1000) - 1;
+    TIMSK1 = (1 << OCIE1A);
+}
+
+void loop()
+{}
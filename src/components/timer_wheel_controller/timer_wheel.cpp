@@ -0,0 +1,500 @@
+
+/**
+ * @file    timer_wheel.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Hierarchical Timer Wheel Scheduler for non-blocking DigitalOut actions.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "../../thehal.h"
+
+/*****************************************************************************/
+
+/* Build Guard */
+
+#if THE_HAL_COMPONENT_TIMER_WHEEL == 1
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "timer_wheel.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+    #include "freertos/FreeRTOS.h"
+#elif defined(ARDUINO)
+    #include <Arduino.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+typedef enum
+{
+    SLOT_MASK = (THE_HAL_TIMER_WHEEL_SLOTS - 1),
+    WHEEL_BITS = (THE_HAL_TIMER_WHEEL_LEVELS * THE_HAL_TIMER_WHEEL_SLOT_BITS)
+} the_hal_timer_wheel_constants;
+
+/* Farthest tick that the wheel can hold without clamping */
+static const uint32_t MAX_DELTA = (WHEEL_BITS >= 32) ?
+        0x7fffffffUL : ((1UL << WHEEL_BITS) - 1);
+
+/*****************************************************************************/
+
+/* Critical Section */
+
+/* Actions are scheduled from main code while tick() runs in the timer ISR,
+ * so the wheel lists are only modified with interrupts masked */
+
+#if defined(__AVR__)
+
+    typedef uint8_t the_hal_timer_wheel_lock;
+
+    static inline the_hal_timer_wheel_lock lock_wheel(void)
+    { uint8_t sreg = SREG; cli(); return sreg; }
+
+    static inline void unlock_wheel(the_hal_timer_wheel_lock sreg)
+    { SREG = sreg; }
+
+#elif defined(ESP_IDF) || defined(ESP_PLATFORM)
+
+    typedef uint8_t the_hal_timer_wheel_lock;
+
+    static portMUX_TYPE wheel_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    static inline the_hal_timer_wheel_lock lock_wheel(void)
+    { portENTER_CRITICAL_SAFE(&wheel_mux); return 0; }
+
+    static inline void unlock_wheel(the_hal_timer_wheel_lock)
+    { portEXIT_CRITICAL_SAFE(&wheel_mux); }
+
+#elif defined(ARDUINO) && defined(__arm__)
+
+    // Interrupts mask is restored (not enabled), as tick() runs in an ISR
+    typedef uint32_t the_hal_timer_wheel_lock;
+
+    static inline the_hal_timer_wheel_lock lock_wheel(void)
+    {
+        uint32_t primask;
+        __asm__ __volatile__("mrs %0, primask" : "=r" (primask));
+        __asm__ __volatile__("cpsid i" ::: "memory");
+        return primask;
+    }
+
+    static inline void unlock_wheel(the_hal_timer_wheel_lock primask)
+    { __asm__ __volatile__("msr primask, %0" :: "r" (primask) : "memory"); }
+
+#elif defined(ARDUINO)
+
+    // Other cores have no portable way to get the interrupts state
+    typedef uint8_t the_hal_timer_wheel_lock;
+
+    static inline the_hal_timer_wheel_lock lock_wheel(void)
+    { noInterrupts(); return 0; }
+
+    static inline void unlock_wheel(the_hal_timer_wheel_lock)
+    { interrupts(); }
+
+#else
+
+    typedef uint8_t the_hal_timer_wheel_lock;
+
+    static inline the_hal_timer_wheel_lock lock_wheel(void)
+    { return 0; }
+
+    static inline void unlock_wheel(the_hal_timer_wheel_lock)
+    {}
+
+#endif
+
+/*****************************************************************************/
+
+/* TimedAction Constructor */
+
+/* TimedAction constructor */
+TimedAction::TimedAction()
+{
+    this->next = nullptr;
+    this->pprev = nullptr;
+    this->pin = nullptr;
+    this->callback = nullptr;
+    this->arg = nullptr;
+    this->expires = 0;
+    this->period_ticks = 0;
+    this->width_ticks = 0;
+    this->action = THE_HAL_TIMED_ACTION_SET;
+    this->pulse_high = false;
+}
+
+/* TimedAction destructor */
+TimedAction::~TimedAction()
+{}
+
+/*****************************************************************************/
+
+/* TimedAction Public Methods */
+
+/* Configure a set/clear/toggle pin action (periodic if period not 0) */
+bool TimedAction::setup(DigitalOut* pin, const uint8_t action,
+        const uint32_t period_ticks)
+{
+    if(pin == nullptr)
+        return false;
+    if(action > THE_HAL_TIMED_ACTION_TOGGLE)
+        return false;
+    if(is_pending())
+        return false;
+
+    this->pin = pin;
+    this->callback = nullptr;
+    this->action = action;
+    this->period_ticks = period_ticks;
+    this->width_ticks = 0;
+    this->pulse_high = false;
+
+    return true;
+}
+
+/* Configure a pin pulse of width ticks (periodic if period not 0) */
+bool TimedAction::setup_pulse(DigitalOut* pin, const uint32_t width_ticks,
+        const uint32_t period_ticks)
+{
+    if(pin == nullptr)
+        return false;
+    if(width_ticks == 0)
+        return false;
+    if((period_ticks != 0) && (period_ticks <= width_ticks))
+        return false;
+    if(is_pending())
+        return false;
+
+    this->pin = pin;
+    this->callback = nullptr;
+    this->action = THE_HAL_TIMED_ACTION_PULSE;
+    this->period_ticks = period_ticks;
+    this->width_ticks = width_ticks;
+    this->pulse_high = false;
+
+    return true;
+}
+
+/* Configure a callback action (periodic if period not 0) */
+bool TimedAction::setup_callback(void (*callback)(void* arg), void* arg,
+        const uint32_t period_ticks)
+{
+    if(callback == nullptr)
+        return false;
+    if(is_pending())
+        return false;
+
+    this->pin = nullptr;
+    this->callback = callback;
+    this->arg = arg;
+    this->action = THE_HAL_TIMED_ACTION_CALLBACK;
+    this->period_ticks = period_ticks;
+    this->width_ticks = 0;
+    this->pulse_high = false;
+
+    return true;
+}
+
+/* Check if the action is scheduled in a wheel */
+bool TimedAction::is_pending(void)
+{
+    return (this->pprev != nullptr);
+}
+
+/*****************************************************************************/
+
+/* TimerWheel Constructor */
+
+/* TimerWheel constructor */
+TimerWheel::TimerWheel()
+{
+    this->now = 0;
+    this->running = false;
+
+    for(uint8_t level = 0; level < THE_HAL_TIMER_WHEEL_LEVELS; level++)
+    {
+        for(uint8_t slot = 0; slot < THE_HAL_TIMER_WHEEL_SLOTS; slot++)
+            this->slots[level][slot] = nullptr;
+    }
+}
+
+/* TimerWheel destructor */
+TimerWheel::~TimerWheel()
+{}
+
+/*****************************************************************************/
+
+/* TimerWheel Public Methods */
+
+/* Schedule an action at an absolute tick (a past tick runs on next tick) */
+bool TimerWheel::schedule_at(TimedAction* action, const uint32_t tick)
+{
+    the_hal_timer_wheel_lock lock;
+
+    if(action == nullptr)
+        return false;
+    if((action->pin == nullptr) && (action->callback == nullptr))
+        return false;
+
+    lock = lock_wheel();
+    if(action->is_pending())
+        remove(action);
+    action->expires = tick;
+    action->pulse_high = false;
+    add(action);
+    unlock_wheel(lock);
+
+    return true;
+}
+
+/* Schedule an action a number of ticks from now */
+bool TimerWheel::schedule_in(TimedAction* action, const uint32_t ticks)
+{
+    return schedule_at(action, this->now + ticks);
+}
+
+/* Remove a pending action from the wheel */
+bool TimerWheel::cancel(TimedAction* action)
+{
+    the_hal_timer_wheel_lock lock;
+    bool was_pending = false;
+
+    if(action == nullptr)
+        return false;
+
+    lock = lock_wheel();
+    if(action->is_pending())
+    {
+        remove(action);
+        was_pending = true;
+    }
+    unlock_wheel(lock);
+
+    return was_pending;
+}
+
+/* Advance the wheel one tick and run the expired actions (timer ISR) */
+void TimerWheel::tick(void)
+{
+    the_hal_timer_wheel_lock lock;
+    TimedAction* action;
+    uint8_t index;
+
+    lock = lock_wheel();
+
+    // When first level wraps, refill it from the upper levels
+    index = this->now & SLOT_MASK;
+    if(index == 0)
+    {
+        for(uint8_t level = 1; level < THE_HAL_TIMER_WHEEL_LEVELS; level++)
+        {
+            if(cascade(level) != 0)
+                break;
+        }
+    }
+
+    // Each action is unlinked before running it, so it can be re-armed
+    this->running = true;
+    while(this->slots[0][index] != nullptr)
+    {
+        action = this->slots[0][index];
+        remove(action);
+        run(action);
+    }
+    this->running = false;
+
+    this->now = this->now + 1;
+
+    unlock_wheel(lock);
+}
+
+/* Advance the wheel up to an absolute tick (i.e. from host virtual clock) */
+uint32_t TimerWheel::tick_until(const uint32_t tick)
+{
+    uint32_t num_ticks = 0;
+
+    while((int32_t)(tick - this->now) > 0)
+    {
+        this->tick();
+        num_ticks = num_ticks + 1;
+    }
+
+    return num_ticks;
+}
+
+/* Get current wheel tick */
+uint32_t TimerWheel::get_time(void)
+{
+    return this->now;
+}
+
+/*****************************************************************************/
+
+/* TimerWheel Private Methods */
+
+/* Link an action in the slot of the level that contains its expire tick */
+void TimerWheel::add(TimedAction* action)
+{
+    TimedAction** head;
+    uint32_t expires = action->expires;
+    uint32_t delta = expires - this->now;
+    uint8_t level = 0;
+    uint8_t index;
+
+    // Past ticks runs in the current slot, far ticks are clamped and will
+    // be placed again when cascaded
+    if((int32_t)delta < 0)
+    {
+        expires = this->now;
+        delta = 0;
+    }
+    else if(delta > MAX_DELTA)
+    {
+        expires = this->now + MAX_DELTA;
+        delta = MAX_DELTA;
+    }
+
+    // An action scheduled with no delay while the current slot runs (i.e.
+    // from its own callback) goes to the next tick, so tick() always ends
+    if(this->running && (delta == 0))
+    {
+        expires = this->now + 1;
+        delta = 1;
+    }
+
+    while((level < (THE_HAL_TIMER_WHEEL_LEVELS - 1)) &&
+            ((delta >> ((level + 1) * THE_HAL_TIMER_WHEEL_SLOT_BITS)) != 0))
+        level = level + 1;
+
+    index = (expires >> (level * THE_HAL_TIMER_WHEEL_SLOT_BITS)) & SLOT_MASK;
+    head = &(this->slots[level][index]);
+    action->next = *head;
+    if(action->next != nullptr)
+        action->next->pprev = &(action->next);
+    action->pprev = head;
+    *head = action;
+}
+
+/* Unlink an action from its slot */
+void TimerWheel::remove(TimedAction* action)
+{
+    *(action->pprev) = action->next;
+    if(action->next != nullptr)
+        action->next->pprev = action->pprev;
+    action->next = nullptr;
+    action->pprev = nullptr;
+}
+
+/* Move the current slot of a level to the lower levels */
+uint8_t TimerWheel::cascade(const uint8_t level)
+{
+    TimedAction* action;
+    TimedAction* list;
+    uint8_t index;
+
+    index = (this->now >> (level * THE_HAL_TIMER_WHEEL_SLOT_BITS)) &
+            SLOT_MASK;
+
+    list = this->slots[level][index];
+    this->slots[level][index] = nullptr;
+    while(list != nullptr)
+    {
+        action = list;
+        list = list->next;
+        action->next = nullptr;
+        action->pprev = nullptr;
+        add(action);
+    }
+
+    return index;
+}
+
+/* Run an expired action and re-arm it if it is a pulse or periodic */
+void TimerWheel::run(TimedAction* action)
+{
+    switch(action->action)
+    {
+        case THE_HAL_TIMED_ACTION_SET:
+            action->pin->set_high();
+            break;
+
+        case THE_HAL_TIMED_ACTION_CLEAR:
+            action->pin->set_low();
+            break;
+
+        case THE_HAL_TIMED_ACTION_TOGGLE:
+            action->pin->toggle();
+            break;
+
+        case THE_HAL_TIMED_ACTION_PULSE:
+            action->pulse_high = !action->pulse_high;
+            if(action->pulse_high)
+            {
+                action->pin->set_high();
+                rearm(action, action->width_ticks);
+                return;
+            }
+            action->pin->set_low();
+            action->expires = action->expires - action->width_ticks;
+            break;
+
+        case THE_HAL_TIMED_ACTION_CALLBACK:
+            action->callback(action->arg);
+            break;
+
+        default:
+            return;
+    }
+
+    // Periodic actions are re-armed from its expire tick to avoid drift
+    if((action->period_ticks != 0) && !action->is_pending())
+        rearm(action, action->period_ticks);
+}
+
+/* Link again an action after its expire tick, at least in the next tick */
+void TimerWheel::rearm(TimedAction* action, const uint32_t ticks)
+{
+    action->expires = action->expires + ticks;
+    if((int32_t)(action->expires - this->now) <= 0)
+        action->expires = this->now + 1;
+    add(action);
+}
+
+/*****************************************************************************/
+
+#endif /* THE_HAL_COMPONENT_TIMER_WHEEL == 1 */
+
+/*****************************************************************************/
@@ -0,0 +1,158 @@
+
+/**
+ * @file    timer_wheel.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    19-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Hierarchical Timer Wheel Scheduler for non-blocking DigitalOut actions.
+ *
+ * Actions (set, clear, toggle, pulse or callback) are scheduled at absolute
+ * or relative ticks and run from tick(), that must be called once per tick
+ * from a hardware timer interrupt (or from the virtual clock on host).
+ * Schedule and cancel are O(1), each tick runs one slot of the first level
+ * and every 2^THE_HAL_TIMER_WHEEL_SLOT_BITS ticks one upper level slot is
+ * cascaded down, so actions are never searched nor sorted.
+ *
+ *   MyBlink.setup(&MyLed, THE_HAL_TIMED_ACTION_TOGGLE, 500);
+ *   MyWheel.schedule_in(&MyBlink, 500);
+ *   ISR(TIMER1_COMPA_vect) { MyWheel.tick(); }
+ *
+ * Actions memory is provided by the user, the scheduler doesn't allocate.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Guards */
+
+/* Component Enabled/Disabled Guard */
+#if THE_HAL_COMPONENT_TIMER_WHEEL == 1
+
+/* Include Guard */
+#ifndef THE_HAL_TIMER_WHEEL_H_
+#define THE_HAL_TIMER_WHEEL_H_
+
+/*****************************************************************************/
+
+/* Component Configurations */
+
+/* Number of wheel levels and slots per level (2^SLOT_BITS), actions can be
+ * scheduled up to 2^(LEVELS*SLOT_BITS) ticks ahead without re-cascading */
+#define THE_HAL_TIMER_WHEEL_LEVELS 4
+#if defined(__AVR__)
+    #define THE_HAL_TIMER_WHEEL_SLOT_BITS 4
+#else
+    #define THE_HAL_TIMER_WHEEL_SLOT_BITS 6
+#endif
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../digital_out_controller/digital_out.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+#define THE_HAL_TIMER_WHEEL_SLOTS (1 << THE_HAL_TIMER_WHEEL_SLOT_BITS)
+
+typedef enum
+{
+    THE_HAL_TIMED_ACTION_SET = 0,
+    THE_HAL_TIMED_ACTION_CLEAR = 1,
+    THE_HAL_TIMED_ACTION_TOGGLE = 2,
+    THE_HAL_TIMED_ACTION_PULSE = 3,
+    THE_HAL_TIMED_ACTION_CALLBACK = 4
+} the_hal_timed_action_type;
+
+/*****************************************************************************/
+
+/* Classes */
+
+/* Action to run in a DigitalOut (or callback) when its tick arrives */
+class TimedAction
+{
+    public:
+        TimedAction();
+        ~TimedAction();
+
+        bool setup(DigitalOut* pin, const uint8_t action,
+                const uint32_t period_ticks=0);
+        bool setup_pulse(DigitalOut* pin, const uint32_t width_ticks,
+                const uint32_t period_ticks=0);
+        bool setup_callback(void (*callback)(void* arg), void* arg,
+                const uint32_t period_ticks=0);
+
+        bool is_pending(void);
+
+    private:
+        friend class TimerWheel;
+
+        TimedAction* next;
+        TimedAction** pprev;
+        DigitalOut* pin;
+        void (*callback)(void* arg);
+        void* arg;
+        uint32_t expires;
+        uint32_t period_ticks;
+        uint32_t width_ticks;
+        uint8_t action;
+        bool pulse_high;
+};
+
+/* Timer wheel that runs the scheduled actions */
+class TimerWheel
+{
+    public:
+        TimerWheel();
+        ~TimerWheel();
+
+        bool schedule_at(TimedAction* action, const uint32_t tick);
+        bool schedule_in(TimedAction* action, const uint32_t ticks);
+        bool cancel(TimedAction* action);
+
+        void tick(void);
+        uint32_t tick_until(const uint32_t tick);
+        uint32_t get_time(void);
+
+    private:
+        TimedAction* slots[THE_HAL_TIMER_WHEEL_LEVELS]
+                [THE_HAL_TIMER_WHEEL_SLOTS];
+        volatile uint32_t now;
+        bool running;
+
+        void add(TimedAction* action);
+        void remove(TimedAction* action);
+        uint8_t cascade(const uint8_t level);
+        void run(TimedAction* action);
+        void rearm(TimedAction* action, const uint32_t ticks);
+};
+
+/*****************************************************************************/
+
+#endif // THE_HAL_TIMER_WHEEL_H_
+#endif // THE_HAL_COMPONENT_TIMER_WHEEL
@@ -44,13 +44,94 @@
 /* Enable/Disable "Digital Input Controller" Component */
 #define THE_HAL_COMPONENT_DIGITAL_IN 1
 
+/* Enable/Disable "Quadrature Encoder Controller" Component */
+#define THE_HAL_COMPONENT_ENCODER 0
+
+/* Enable/Disable "AVR Pin Change Interrupts Dispatcher" Component */
+#define THE_HAL_COMPONENT_PCINT_DISPATCHER 0
+
+/* Enable/Disable "Digital Output Commands Queue" Component */
+#define THE_HAL_COMPONENT_DIGITAL_OUT_QUEUE 0
+
+/* Enable/Disable "Coroutines Asynchronous Controller" Component (C++20) */
+#define THE_HAL_COMPONENT_ASYNC 0
+
+/* Enable/Disable "Timer Wheel Scheduler" Component */
+#define THE_HAL_COMPONENT_TIMER_WHEEL 0
+
+/* Enable/Disable "Logic Capture Controller" Component */
+#define THE_HAL_COMPONENT_LOGIC_CAPTURE 0
+
+/* Enable/Disable "Oversampling Glitch Filter" Component */
+#define THE_HAL_COMPONENT_GLITCH_FILTER 0
+
+/* Enable/Disable "Multiplexed Display Controller" Component */
+#define THE_HAL_COMPONENT_DISPLAY_MUX 0
+
+/* Enable/Disable "Matrix Keypad Controller" Component */
+#define THE_HAL_COMPONENT_KEYPAD 0
+
+/* Enable/Disable "Stepper Motors Controller" Component */
+#define THE_HAL_COMPONENT_STEPPER 0
+
+/* Enable/Disable "Shift Register Outputs Controller" Component */
+#define THE_HAL_COMPONENT_SHIFT_REGISTER 0
+
+/* Enable/Disable "Latency Instrumentation Controller" Component */
+#define THE_HAL_COMPONENT_LATENCY 0
+
+/* Enable/Disable "Direct Digital Synthesis Generator" Component */
+#define THE_HAL_COMPONENT_DDS 0
+
+/* Enable/Disable "Bit-Banged SPI Master" Component */
+#define THE_HAL_COMPONENT_SOFT_SPI 0
+
+/* Enable/Disable "Bit-Banged I2C Master" Component */
+#define THE_HAL_COMPONENT_SOFT_I2C 0
+
+/* Enable/Disable "Precise Pulse Generator" Component */
+#define THE_HAL_COMPONENT_PULSE 0
+
+/* Enable/Disable "Pin Events Publish/Subscribe Bus" Component */
+#define THE_HAL_COMPONENT_PIN_EVENT_BUS 0
+
+/* Enable/Disable Header-Only Build (backends methods are defined inline in
+ * the headers, so pin operations inline into the calling code without LTO) */
+#define THE_HAL_HEADER_ONLY 0
+
+/*****************************************************************************/
+
+/* Header-Only Build */
+
+/* Qualifier of backends methods definitions */
+#if THE_HAL_HEADER_ONLY == 1
+    #define THE_HAL_INLINE inline
+#else
+    #define THE_HAL_INLINE
+#endif
 
 /*****************************************************************************/
 
 /* Components Inclusion */
 
 #include "components/digital_out_controller/digital_out.h"
-//#include "components/digital_in_controller/digital_in.h"
+#include "components/digital_in_controller/digital_in.h"
+#include "components/encoder_controller/encoder.h"
+#include "components/digital_out_queue_controller/digital_out_queue.h"
+#include "components/async_controller/async.h"
+#include "components/timer_wheel_controller/timer_wheel.h"
+#include "components/logic_capture_controller/logic_capture.h"
+#include "components/glitch_filter_controller/glitch_filter.h"
+#include "components/display_mux_controller/display_mux.h"
+#include "components/keypad_controller/keypad.h"
+#include "components/stepper_controller/stepper.h"
+#include "components/shift_register_controller/shift_register.h"
+#include "components/latency_controller/latency.h"
+#include "components/dds_controller/dds.h"
+#include "components/soft_spi_controller/soft_spi.h"
+#include "components/soft_i2c_controller/soft_i2c.h"
+#include "components/pulse_controller/pulse.h"
+#include "components/pin_event_bus_controller/pin_event_bus.h"
 
 /*****************************************************************************/
 